@@ -341,6 +341,9 @@ void Binding::stopSurface(jint surfaceId) {
   }
 
   scheduler->stopSurface(surfaceId);
+
+  std::lock_guard<std::recursive_mutex> lock(commitMutex_);
+  deletedViewTags_.erase(surfaceId);
 }
 
 void Binding::setConstraints(
@@ -787,8 +790,7 @@ void Binding::schedulerDidFinishTransactionIntBuffer(
 
     switch (mutationType) {
       case ShadowViewMutation::Create: {
-        if (disablePreallocateViews_ ||
-            newChildShadowView.props->revision > 1) {
+        if (!isPreallocatedWithCurrentProps(surfaceId, newChildShadowView)) {
           cppCommonMountItems.push_back(
               CppMountItem::CreateMountItem(newChildShadowView));
         }
@@ -804,6 +806,7 @@ void Binding::schedulerDidFinishTransactionIntBuffer(
       case ShadowViewMutation::Delete: {
         cppDeleteMountItems.push_back(
             CppMountItem::DeleteMountItem(oldChildShadowView));
+        didDeleteView(surfaceId, oldChildShadowView);
         break;
       }
       case ShadowViewMutation::Update: {
@@ -849,8 +852,7 @@ void Binding::schedulerDidFinishTransactionIntBuffer(
           cppCommonMountItems.push_back(CppMountItem::InsertMountItem(
               parentShadowView, newChildShadowView, index));
 
-          if (disablePreallocateViews_ ||
-              newChildShadowView.props->revision > 1) {
+          if (!isPreallocatedWithCurrentProps(surfaceId, newChildShadowView)) {
             cppUpdatePropsMountItems.push_back(
                 CppMountItem::UpdatePropsMountItem(newChildShadowView));
           }
@@ -879,6 +881,7 @@ void Binding::schedulerDidFinishTransactionIntBuffer(
             CppMountItem::UpdateEventEmitterMountItem(
                 mutation.newChildShadowView));
 
+        didInsertView(surfaceId, newChildShadowView);
         break;
       }
       default: {
@@ -1261,7 +1264,6 @@ void Binding::schedulerDidFinishTransaction(
       JArrayClass<JMountItem::javaobject>::newArray(size);
 
   auto mountItems = *(mountItemsArray);
-  std::unordered_set<Tag> deletedViewTags;
 
   // Find the set of tags that are removed and deleted in one block
   std::vector<RemoveDeleteMetadata> toRemove;
@@ -1303,10 +1305,8 @@ void Binding::schedulerDidFinishTransaction(
 
     switch (mutation.type) {
       case ShadowViewMutation::Create: {
-        if (disablePreallocateViews_ ||
-            mutation.newChildShadowView.props->revision > 1 ||
-            deletedViewTags.find(mutation.newChildShadowView.tag) !=
-                deletedViewTags.end()) {
+        if (!isPreallocatedWithCurrentProps(
+                surfaceId, mutation.newChildShadowView)) {
           mountItems[position++] =
               createCreateMountItem(localJavaUIManager, mutation, surfaceId);
         }
@@ -1339,7 +1339,7 @@ void Binding::schedulerDidFinishTransaction(
               mutation.oldChildShadowView.tag, -1, -1, false, true});
         }
 
-        deletedViewTags.insert(mutation.oldChildShadowView.tag);
+        didDeleteView(surfaceId, mutation.oldChildShadowView);
         break;
       }
       case ShadowViewMutation::Update: {
@@ -1388,10 +1388,8 @@ void Binding::schedulerDidFinishTransaction(
           mountItems[position++] =
               createInsertMountItem(localJavaUIManager, mutation);
 
-          if (disablePreallocateViews_ ||
-              mutation.newChildShadowView.props->revision > 1 ||
-              deletedViewTags.find(mutation.newChildShadowView.tag) !=
-                  deletedViewTags.end()) {
+          if (!isPreallocatedWithCurrentProps(
+                  surfaceId, mutation.newChildShadowView)) {
             mountItems[position++] =
                 createUpdatePropsMountItem(localJavaUIManager, mutation);
           }
@@ -1427,6 +1425,7 @@ void Binding::schedulerDidFinishTransaction(
           mountItems[position++] = updateEventEmitterMountItem;
         }
 
+        didInsertView(surfaceId, mutation.newChildShadowView);
         break;
       }
       default: {
@@ -1485,6 +1484,32 @@ void Binding::schedulerDidFinishTransaction(
       telemetryTimePointToMilliseconds(finishTransactionEndTime));
 }
 
+bool Binding::isPreallocatedWithCurrentProps(
+    SurfaceId surfaceId,
+    ShadowView const &shadowView) const {
+  if (disablePreallocateViews_ || shadowView.props->revision > 1) {
+    return false;
+  }
+
+  auto iterator = deletedViewTags_.find(surfaceId);
+  return iterator == deletedViewTags_.end() ||
+      iterator->second.find(shadowView.tag) == iterator->second.end();
+}
+
+void Binding::didDeleteView(SurfaceId surfaceId, ShadowView const &shadowView) {
+  // Views with newer props are created again anyway.
+  if (!disablePreallocateViews_ && shadowView.props->revision <= 1) {
+    deletedViewTags_[surfaceId].insert(shadowView.tag);
+  }
+}
+
+void Binding::didInsertView(SurfaceId surfaceId, ShadowView const &shadowView) {
+  auto iterator = deletedViewTags_.find(surfaceId);
+  if (iterator != deletedViewTags_.end()) {
+    iterator->second.erase(shadowView.tag);
+  }
+}
+
 void Binding::setPixelDensity(float pointScaleFactor) {
   pointScaleFactor_ = pointScaleFactor;
 }
@@ -17,6 +17,8 @@
 #include <react/renderer/uimanager/LayoutAnimationStatusDelegate.h>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 #include "ComponentFactory.h"
 #include "EventBeatManager.h"
 #include "JBackgroundExecutor.h"
@@ -175,9 +177,29 @@ class Binding : public jni::HybridClass<Binding>,
   bool disableVirtualNodePreallocation_{false};
   bool enableFabricLogs_{false};
 
+  /*
+   * Tags of views (per surface) which were deleted while they still had the
+   * props they were preallocated with. A view which scrolls out of a culling
+   * ScrollView is deleted and, when it scrolls back in a later transaction,
+   * created again with the same props, so the props revision can't tell that
+   * it was not preallocated. Must be accessed with `commitMutex_` held.
+   */
+  std::unordered_map<SurfaceId, std::unordered_set<Tag>> deletedViewTags_;
+
  private:
   void schedulerDidFinishTransactionIntBuffer(
       MountingCoordinator::Shared const &mountingCoordinator);
+
+  /*
+   * Returns `true` if the view was preallocated with its current props, so
+   * that neither a Create nor an UpdateProps has to be sent for it.
+   */
+  bool isPreallocatedWithCurrentProps(
+      SurfaceId surfaceId,
+      ShadowView const &shadowView) const;
+
+  void didDeleteView(SurfaceId surfaceId, ShadowView const &shadowView);
+  void didInsertView(SurfaceId surfaceId, ShadowView const &shadowView);
 };
 
 } // namespace react
@@ -14,6 +14,7 @@
 #include "MethodCall.h"
 #include "NativeToJsBridge.h"
 #include "RAMBundleRegistry.h"
+#include "ReactMarker.h"
 #include "RecoverableError.h"
 #include "SystraceSection.h"
 
@@ -44,6 +45,7 @@ void Instance::initializeBridge(
     std::shared_ptr<JSExecutorFactory> jsef,
     std::shared_ptr<MessageQueueThread> jsQueue,
     std::shared_ptr<ModuleRegistry> moduleRegistry) {
+  ReactMarker::logMarker(ReactMarker::REACT_INSTANCE_INIT_START);
   callback_ = std::move(callback);
   moduleRegistry_ = std::move(moduleRegistry);
   jsQueue->runOnQueueSync([this, &jsef, jsQueue]() mutable {
@@ -65,6 +67,7 @@ void Instance::initializeBridge(
   });
 
   CHECK(nativeToJsBridge_);
+  ReactMarker::logMarker(ReactMarker::REACT_INSTANCE_INIT_STOP);
 }
 
 void Instance::loadBundle(
@@ -7,6 +7,8 @@
 
 #include "ReactMarker.h"
 
+#include <reactperflogger/StartupTimeline.h>
+
 namespace facebook {
 namespace react {
 namespace ReactMarker {
@@ -24,7 +26,56 @@ LogTaggedMarkerWithInstanceKey logTaggedMarkerWithInstanceKey = nullptr;
 #endif
 
 void logMarker(const ReactMarkerId markerId) {
-  logTaggedMarker(markerId, nullptr);
+  logMarker(markerId, nullptr);
+}
+
+void logMarker(const ReactMarkerId markerId, const char *tag) {
+  StartupTimeline::logEvent(getMarkerName(markerId), tag);
+  if (logTaggedMarker) {
+    logTaggedMarker(markerId, tag);
+  }
+}
+
+void logMarker(
+    const ReactMarkerId markerId,
+    const char *tag,
+    const int instanceKey) {
+  StartupTimeline::logEvent(getMarkerName(markerId), tag, instanceKey);
+  if (logTaggedMarkerWithInstanceKey) {
+    logTaggedMarkerWithInstanceKey(markerId, tag, instanceKey);
+  }
+}
+
+const char *getMarkerName(const ReactMarkerId markerId) {
+  switch (markerId) {
+    case NATIVE_REQUIRE_START:
+      return "NATIVE_REQUIRE_START";
+    case NATIVE_REQUIRE_STOP:
+      return "NATIVE_REQUIRE_STOP";
+    case RUN_JS_BUNDLE_START:
+      return StartupTimeline::kRunJSBundleStart;
+    case RUN_JS_BUNDLE_STOP:
+      return StartupTimeline::kRunJSBundleStop;
+    case CREATE_REACT_CONTEXT_STOP:
+      return "CREATE_REACT_CONTEXT_STOP";
+    case JS_BUNDLE_STRING_CONVERT_START:
+      return "JS_BUNDLE_STRING_CONVERT_START";
+    case JS_BUNDLE_STRING_CONVERT_STOP:
+      return "JS_BUNDLE_STRING_CONVERT_STOP";
+    case NATIVE_MODULE_SETUP_START:
+      return StartupTimeline::kNativeModuleSetupStart;
+    case NATIVE_MODULE_SETUP_STOP:
+      return StartupTimeline::kNativeModuleSetupStop;
+    case REGISTER_JS_SEGMENT_START:
+      return StartupTimeline::kRegisterJSSegmentStart;
+    case REGISTER_JS_SEGMENT_STOP:
+      return StartupTimeline::kRegisterJSSegmentStop;
+    case REACT_INSTANCE_INIT_START:
+      return StartupTimeline::kReactInstanceInitStart;
+    case REACT_INSTANCE_INIT_STOP:
+      return StartupTimeline::kReactInstanceInitStop;
+  }
+  return "UNKNOWN";
 }
 
 } // namespace ReactMarker
@@ -53,6 +53,22 @@ extern RN_EXPORT LogTaggedMarkerWithInstanceKey logTaggedMarkerWithInstanceKey;
 
 extern RN_EXPORT void logMarker(const ReactMarkerId markerId);
 
+/**
+ * Logs a marker with `logTaggedMarkerWithInstanceKey` (or `logTaggedMarker`
+ * when there is no instance key), if set, and records it in the
+ * `StartupTimeline` (when it is recording).
+ */
+extern RN_EXPORT void logMarker(const ReactMarkerId markerId, const char *tag);
+extern RN_EXPORT void logMarker(
+    const ReactMarkerId markerId,
+    const char *tag,
+    const int instanceKey);
+
+/**
+ * Name of the marker in the `StartupTimeline`.
+ */
+extern RN_EXPORT const char *getMarkerName(const ReactMarkerId markerId);
+
 } // namespace ReactMarker
 } // namespace react
 } // namespace facebook
@@ -0,0 +1,475 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "SystraceRecorder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include <unistd.h>
+
+#include <yoga/tracer/ring-buffer.h>
+
+namespace facebook {
+namespace react {
+
+namespace {
+
+enum class EventType : uint8_t {
+  Begin = 1,
+  End = 2,
+};
+
+/*
+ * `text` holds the name of the section followed by its arguments, as
+ * `\0`-separated keys and values.
+ */
+struct Event {
+  static constexpr size_t kTextCapacity = 112;
+
+  uint64_t timestamp;
+  EventType type;
+  uint8_t nameSize;
+  uint8_t textSize;
+  uint8_t padding[5];
+  char text[kTextCapacity];
+};
+
+constexpr size_t Event::kTextCapacity;
+
+constexpr size_t kEventHeaderSize = offsetof(Event, text);
+static_assert(sizeof(Event) == 128, "Events are expected to be 128 bytes");
+static_assert(
+    SystraceRecorder::SectionArgs::kCapacity < Event::kTextCapacity,
+    "Section arguments must fit in an event");
+
+/*
+ * Per-thread buffers are implemented with Yoga's tracer, which also makes
+ * thread ids in both traces match.
+ */
+using Buffer = yoga::tracer::RingBuffer<Event>;
+using Buffers = yoga::tracer::ThreadBuffers<Buffer>;
+
+/*
+ * Only words which hold text are written; the rest of a slot is stale, so
+ * sizes read back are clamped.
+ */
+void push(Event const &event) {
+  Buffers::get().push(event, kEventHeaderSize + event.textSize);
+}
+
+std::vector<Event> read(Buffer const &buffer) {
+  auto events = buffer.read();
+  for (auto &event : events) {
+    event.textSize = std::min<uint8_t>(event.textSize, Event::kTextCapacity);
+    event.nameSize = std::min(event.nameSize, event.textSize);
+  }
+  return events;
+}
+
+/*
+ * `steady_clock` is `CLOCK_MONOTONIC` on Linux and Android, which is what
+ * Perfetto traces are told to use.
+ */
+uint64_t now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+struct Section final {
+  Event const *begin;
+  Event const *end;
+};
+
+/*
+ * Pairs begins and ends of sections. Ends whose begin was overwritten, and
+ * begins of sections still in progress, are left out.
+ */
+std::vector<Section> getSections(std::vector<Event> const &events) {
+  auto sections = std::vector<Section>{};
+  auto begins = std::vector<Event const *>{};
+  for (auto const &event : events) {
+    if (event.type == EventType::Begin) {
+      begins.push_back(&event);
+    } else if (event.type == EventType::End && !begins.empty()) {
+      sections.push_back({begins.back(), &event});
+      begins.pop_back();
+    }
+  }
+  return sections;
+}
+
+template <typename Callback>
+void forEachArg(Event const &event, Callback callback) {
+  auto position = size_t{event.nameSize};
+  auto next = [&]() {
+    auto start = position;
+    while (position < event.textSize && event.text[position] != '\0') {
+      position++;
+    }
+    auto string = std::string(event.text + start, position - start);
+    position++;
+    return string;
+  };
+
+  // The name is not `\0`-terminated; arguments start right after it.
+  while (position < event.textSize) {
+    auto key = next();
+    auto value = position <= event.textSize ? next() : std::string{};
+    callback(key, value);
+  }
+}
+
+std::string getName(Event const &event) {
+  return std::string(event.text, event.nameSize);
+}
+
+void writeJsonString(std::ostream &stream, std::string const &string) {
+  stream << '"';
+  for (auto character : string) {
+    switch (character) {
+      case '"':
+        stream << "\\\"";
+        break;
+      case '\\':
+        stream << "\\\\";
+        break;
+      case '\n':
+        stream << "\\n";
+        break;
+      default:
+        if (static_cast<unsigned char>(character) < 0x20) {
+          char escaped[8];
+          snprintf(escaped, sizeof(escaped), "\\u%04x", character);
+          stream << escaped;
+        } else {
+          stream << character;
+        }
+    }
+  }
+  stream << '"';
+}
+
+/*
+ * Trace event timestamps are in microseconds.
+ */
+void writeJsonTime(std::ostream &stream, uint64_t nanoseconds) {
+  char buffer[32];
+  snprintf(
+      buffer,
+      sizeof(buffer),
+      "%" PRIu64 ".%03u",
+      nanoseconds / 1000,
+      static_cast<unsigned>(nanoseconds % 1000));
+  stream << buffer;
+}
+
+#pragma mark - Protobuf encoding
+
+enum WireType : uint32_t {
+  Varint = 0,
+  LengthDelimited = 2,
+};
+
+void writeVarint(std::string &output, uint64_t value) {
+  while (value >= 0x80) {
+    output.push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  output.push_back(static_cast<char>(value));
+}
+
+void writeVarintField(std::string &output, uint32_t field, uint64_t value) {
+  writeVarint(output, (field << 3) | WireType::Varint);
+  writeVarint(output, value);
+}
+
+void writeBytesField(
+    std::string &output,
+    uint32_t field,
+    std::string const &bytes) {
+  writeVarint(output, (field << 3) | WireType::LengthDelimited);
+  writeVarint(output, bytes.size());
+  output.append(bytes);
+}
+
+/*
+ * Field numbers of the `perfetto.protos` messages which are written.
+ */
+namespace perfetto {
+constexpr uint32_t kTracePacket = 1;
+
+constexpr uint32_t kPacketTimestamp = 8;
+constexpr uint32_t kPacketSequenceId = 10;
+constexpr uint32_t kPacketTrackEvent = 11;
+constexpr uint32_t kPacketSequenceFlags = 13;
+constexpr uint32_t kPacketTimestampClockId = 58;
+constexpr uint32_t kPacketTrackDescriptor = 60;
+
+constexpr uint32_t kTrackDescriptorUuid = 1;
+constexpr uint32_t kTrackDescriptorThread = 4;
+constexpr uint32_t kThreadDescriptorPid = 1;
+constexpr uint32_t kThreadDescriptorTid = 2;
+
+constexpr uint32_t kTrackEventDebugAnnotations = 4;
+constexpr uint32_t kTrackEventType = 9;
+constexpr uint32_t kTrackEventTrackUuid = 11;
+constexpr uint32_t kTrackEventName = 23;
+constexpr uint32_t kDebugAnnotationStringValue = 6;
+constexpr uint32_t kDebugAnnotationName = 10;
+
+constexpr uint64_t kTypeSliceBegin = 1;
+constexpr uint64_t kTypeSliceEnd = 2;
+constexpr uint64_t kSequenceIncrementalStateCleared = 1;
+constexpr uint64_t kBuiltinClockMonotonic = 3;
+constexpr uint64_t kSequenceId = 1;
+
+/*
+ * Track uuids only need to be unique within the trace.
+ */
+uint64_t trackUuid(uint32_t threadId) {
+  return (uint64_t{0x5157} << 32) | threadId;
+}
+} // namespace perfetto
+
+void writePacket(std::ostream &stream, std::string const &packet) {
+  auto field = std::string{};
+  writeBytesField(field, perfetto::kTracePacket, packet);
+  stream.write(field.data(), field.size());
+}
+
+void writePerfettoEvent(
+    std::ostream &stream,
+    Event const &event,
+    uint64_t trackUuid,
+    bool isFirst) {
+  auto trackEvent = std::string{};
+  writeVarintField(
+      trackEvent,
+      perfetto::kTrackEventType,
+      event.type == EventType::Begin ? perfetto::kTypeSliceBegin
+                                     : perfetto::kTypeSliceEnd);
+  writeVarintField(trackEvent, perfetto::kTrackEventTrackUuid, trackUuid);
+  if (event.type == EventType::Begin) {
+    writeBytesField(trackEvent, perfetto::kTrackEventName, getName(event));
+    forEachArg(event, [&](std::string const &key, std::string const &value) {
+      auto annotation = std::string{};
+      writeBytesField(annotation, perfetto::kDebugAnnotationName, key);
+      writeBytesField(annotation, perfetto::kDebugAnnotationStringValue, value);
+      writeBytesField(
+          trackEvent, perfetto::kTrackEventDebugAnnotations, annotation);
+    });
+  }
+
+  auto packet = std::string{};
+  writeVarintField(packet, perfetto::kPacketTimestamp, event.timestamp);
+  writeVarintField(
+      packet,
+      perfetto::kPacketTimestampClockId,
+      perfetto::kBuiltinClockMonotonic);
+  writeVarintField(packet, perfetto::kPacketSequenceId, perfetto::kSequenceId);
+  if (isFirst) {
+    writeVarintField(
+        packet,
+        perfetto::kPacketSequenceFlags,
+        perfetto::kSequenceIncrementalStateCleared);
+  }
+  writeBytesField(packet, perfetto::kPacketTrackEvent, trackEvent);
+  writePacket(stream, packet);
+}
+
+} // namespace
+
+#pragma mark - SectionArgs
+
+void SystraceRecorder::SectionArgs::appendString(char const *string) {
+  appendString(string, string ? strlen(string) : 0);
+}
+
+void SystraceRecorder::SectionArgs::appendString(
+    char const *string,
+    size_t size) {
+  // Strings are `\0`-terminated; the terminator always fits.
+  auto available = kCapacity - size_;
+  if (available == 0) {
+    return;
+  }
+  size = std::min(size, available - 1);
+  if (size > 0) {
+    memcpy(data_ + size_, string, size);
+  }
+  size_ += size;
+  data_[size_++] = '\0';
+}
+
+void SystraceRecorder::SectionArgs::appendNumber(double number) {
+  char string[32];
+  auto size = snprintf(string, sizeof(string), "%g", number);
+  appendString(string, static_cast<size_t>(std::max(size, 0)));
+}
+
+void SystraceRecorder::SectionArgs::appendNumber(int64_t number) {
+  char string[32];
+  auto size = snprintf(string, sizeof(string), "%" PRId64, number);
+  appendString(string, static_cast<size_t>(std::max(size, 0)));
+}
+
+#pragma mark - SystraceRecorder
+
+std::atomic<bool> SystraceRecorder::isRecording_{false};
+
+void SystraceRecorder::start() {
+  start(Options{});
+}
+
+void SystraceRecorder::start(Options const &options) {
+  auto size = uint64_t{2};
+  while (size < options.bufferSize && size < (uint64_t{1} << 24)) {
+    size <<= 1;
+  }
+  Buffers::reset(size);
+  isRecording_ = true;
+}
+
+bool SystraceRecorder::startSampled(double probability) {
+  return startSampled(probability, Options{});
+}
+
+bool SystraceRecorder::startSampled(
+    double probability,
+    Options const &options) {
+  std::random_device device;
+  auto distribution = std::uniform_real_distribution<double>{0, 1};
+  if (!(distribution(device) < probability)) {
+    return false;
+  }
+  start(options);
+  return true;
+}
+
+void SystraceRecorder::stop() {
+  isRecording_ = false;
+}
+
+void SystraceRecorder::beginSection(
+    char const *name,
+    SectionArgs const &args) {
+  Event event;
+  event.timestamp = now();
+  event.type = EventType::Begin;
+
+  // Arguments always fit (`SectionArgs` is smaller than an event), so only
+  // the name can be truncated.
+  auto argsSize = args.size();
+  auto nameSize =
+      std::min(name ? strlen(name) : 0, Event::kTextCapacity - argsSize);
+  if (nameSize > 0) {
+    memcpy(event.text, name, nameSize);
+  }
+  if (argsSize > 0) {
+    memcpy(event.text + nameSize, args.data(), argsSize);
+  }
+  event.nameSize = static_cast<uint8_t>(nameSize);
+  event.textSize = static_cast<uint8_t>(nameSize + argsSize);
+
+  push(event);
+}
+
+void SystraceRecorder::endSection() {
+  Event event;
+  event.timestamp = now();
+  event.type = EventType::End;
+  event.nameSize = 0;
+  event.textSize = 0;
+
+  push(event);
+}
+
+void SystraceRecorder::writeChromeTrace(std::ostream &stream) {
+  auto pid = static_cast<int>(getpid());
+  auto isFirst = true;
+
+  stream << "{\"traceEvents\":[";
+  for (auto const &buffer : Buffers::getAll()) {
+    auto events = read(*buffer);
+    for (auto const &section : getSections(events)) {
+      stream << (isFirst ? "\n" : ",\n") << "{\"name\":";
+      isFirst = false;
+      writeJsonString(stream, getName(*section.begin));
+      stream << ",\"cat\":\"react\",\"ph\":\"X\",\"pid\":" << pid
+             << ",\"tid\":" << buffer->threadId << ",\"ts\":";
+      writeJsonTime(stream, section.begin->timestamp);
+      stream << ",\"dur\":";
+      writeJsonTime(stream, section.end->timestamp - section.begin->timestamp);
+      stream << ",\"args\":{";
+      auto isFirstArg = true;
+      forEachArg(
+          *section.begin,
+          [&](std::string const &key, std::string const &value) {
+            stream << (isFirstArg ? "" : ",");
+            isFirstArg = false;
+            writeJsonString(stream, key);
+            stream << ":";
+            writeJsonString(stream, value);
+          });
+      stream << "}}";
+    }
+  }
+  stream << "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{"
+         << "\"overwrittenEvents\":" << getOverwrittenEventCount() << "}}\n";
+}
+
+std::string SystraceRecorder::toChromeTrace() {
+  auto stream = std::ostringstream{};
+  writeChromeTrace(stream);
+  return stream.str();
+}
+
+void SystraceRecorder::writePerfettoTrace(std::ostream &stream) {
+  auto pid = static_cast<uint64_t>(getpid());
+  auto isFirst = true;
+
+  for (auto const &buffer : Buffers::getAll()) {
+    auto trackUuid = perfetto::trackUuid(buffer->threadId);
+
+    auto thread = std::string{};
+    writeVarintField(thread, perfetto::kThreadDescriptorPid, pid);
+    writeVarintField(thread, perfetto::kThreadDescriptorTid, buffer->threadId);
+    auto descriptor = std::string{};
+    writeVarintField(descriptor, perfetto::kTrackDescriptorUuid, trackUuid);
+    writeBytesField(descriptor, perfetto::kTrackDescriptorThread, thread);
+    auto packet = std::string{};
+    writeBytesField(packet, perfetto::kPacketTrackDescriptor, descriptor);
+    writePacket(stream, packet);
+
+    // Unlike in Chrome traces, unmatched begins and ends are fine here: slices
+    // in progress are shown as such, and the processor drops dangling ends.
+    for (auto const &event : read(*buffer)) {
+      writePerfettoEvent(stream, event, trackUuid, isFirst);
+      isFirst = false;
+    }
+  }
+}
+
+uint64_t SystraceRecorder::getOverwrittenEventCount() {
+  auto count = uint64_t{0};
+  for (auto const &buffer : Buffers::getAll()) {
+    count += buffer->getOverwrittenCount();
+  }
+  return count;
+}
+
+} // namespace react
+} // namespace facebook
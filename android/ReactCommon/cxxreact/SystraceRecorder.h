@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Records begins and ends of `SystraceSection`s (when built with
+ * `WITH_PORTABLE_SYSTRACE`) and exports them as a Chrome trace (JSON) or a
+ * Perfetto trace (protobuf).
+ *
+ * Each thread records into its own fixed-size ring buffer (older events are
+ * overwritten), so recording never takes a lock. While recording is off,
+ * a section costs a single relaxed atomic load.
+ * All methods can be called from any thread.
+ */
+class SystraceRecorder final {
+ public:
+  struct Options {
+    /*
+     * Number of events each thread keeps (rounded up to a power of two).
+     * An event takes 128 bytes.
+     */
+    size_t bufferSize{8192};
+  };
+
+  /*
+   * Arguments of a section, as `key, value` pairs. Keys and values are copied
+   * (and truncated if they don't fit in an event).
+   */
+  class SectionArgs final {
+   public:
+    static constexpr size_t kCapacity = 96;
+
+    void append() {}
+
+    template <typename Value, typename... Rest>
+    void append(char const *key, Value const &value, Rest const &... rest) {
+      appendString(key);
+      appendValue(value);
+      append(rest...);
+    }
+
+    char const *data() const {
+      return data_;
+    }
+
+    size_t size() const {
+      return size_;
+    }
+
+   private:
+    void appendString(char const *string);
+    void appendString(char const *string, size_t size);
+    void appendNumber(double number);
+    void appendNumber(int64_t number);
+
+    void appendValue(char const *value) {
+      appendString(value);
+    }
+
+    void appendValue(std::string const &value) {
+      appendString(value.data(), value.size());
+    }
+
+    template <typename Value>
+    void appendValue(Value const &value) {
+      static_assert(
+          std::is_arithmetic<Value>::value, "Unsupported argument type");
+      if (std::is_floating_point<Value>::value) {
+        appendNumber(static_cast<double>(value));
+      } else {
+        appendNumber(static_cast<int64_t>(value));
+      }
+    }
+
+    char data_[kCapacity];
+    size_t size_{0};
+  };
+
+  /*
+   * Starts recording, dropping events of previous recordings.
+   */
+  static void start();
+  static void start(Options const &options);
+
+  /*
+   * Starts recording with a given probability (e.g. `0.01` to record 1% of
+   * sessions). Returns whether recording was started.
+   */
+  static bool startSampled(double probability);
+  static bool startSampled(double probability, Options const &options);
+
+  /*
+   * Stops recording. Events stay available for export until the next
+   * `start`.
+   */
+  static void stop();
+
+  static bool isRecording() {
+    return isRecording_.load(std::memory_order_relaxed);
+  }
+
+  /*
+   * Records the begin or the end of a section on the calling thread.
+   * `endSection` must be called on the thread which called `beginSection`.
+   */
+  static void beginSection(char const *name, SectionArgs const &args);
+  static void endSection();
+
+  /*
+   * Writes recorded sections in the Chrome trace event format (loadable in
+   * chrome://tracing and Perfetto UI). Sections which are still in progress,
+   * or whose begin was overwritten, are left out.
+   * Can be called while recording.
+   */
+  static void writeChromeTrace(std::ostream &stream);
+  static std::string toChromeTrace();
+
+  /*
+   * Writes recorded events as a Perfetto trace (a serialized
+   * `perfetto.protos.Trace` message with track events).
+   * Can be called while recording.
+   */
+  static void writePerfettoTrace(std::ostream &stream);
+
+  /*
+   * Number of events which were overwritten because a buffer was full.
+   */
+  static uint64_t getOverwrittenEventCount();
+
+ private:
+  static std::atomic<bool> isRecording_;
+};
+
+} // namespace react
+} // namespace facebook
@@ -7,8 +7,10 @@
 
 #pragma once
 
-#ifdef WITH_FBSYSTRACE
+#if defined(WITH_FBSYSTRACE)
 #include <fbsystrace.h>
+#elif defined(WITH_PORTABLE_SYSTRACE)
+#include <cxxreact/SystraceRecorder.h>
 #endif
 
 namespace facebook {
@@ -16,14 +18,16 @@ namespace react {
 
 /**
  * This is a convenience class to avoid lots of verbose profiling
- * #ifdefs.  If WITH_FBSYSTRACE is not defined, the optimizer will
- * remove this completely.  If it is defined, it will behave as
- * FbSystraceSection, with the right tag provided. Use two separate classes to
+ * #ifdefs.  If neither WITH_FBSYSTRACE nor WITH_PORTABLE_SYSTRACE is defined,
+ * the optimizer will remove this completely.  If WITH_FBSYSTRACE is defined,
+ * it will behave as FbSystraceSection, with the right tag provided. If
+ * WITH_PORTABLE_SYSTRACE is defined, sections are recorded by
+ * SystraceRecorder (when it is started). Use separate classes to
  * to ensure that the ODR rule isn't violated, that is, if WITH_FBSYSTRACE has
  * different values in different files, there is no inconsistency in the sizes
  * of defined symbols.
  */
-#ifdef WITH_FBSYSTRACE
+#if defined(WITH_FBSYSTRACE)
 struct ConcreteSystraceSection {
  public:
   template <typename... ConvertsToStringPiece>
@@ -36,6 +40,34 @@ struct ConcreteSystraceSection {
   fbsystrace::FbSystraceSection m_section;
 };
 using SystraceSection = ConcreteSystraceSection;
+#elif defined(WITH_PORTABLE_SYSTRACE)
+struct PortableSystraceSection {
+ public:
+  template <typename... ConvertsToStringPiece>
+  explicit PortableSystraceSection(
+      const char *name,
+      ConvertsToStringPiece &&... args) {
+    if (SystraceRecorder::isRecording()) {
+      SystraceRecorder::SectionArgs sectionArgs;
+      sectionArgs.append(args...);
+      SystraceRecorder::beginSection(name, sectionArgs);
+      m_isRecorded = true;
+    }
+  }
+
+  ~PortableSystraceSection() {
+    if (m_isRecorded) {
+      SystraceRecorder::endSection();
+    }
+  }
+
+  PortableSystraceSection(const PortableSystraceSection &) = delete;
+  PortableSystraceSection &operator=(const PortableSystraceSection &) = delete;
+
+ private:
+  bool m_isRecorded{false};
+};
+using SystraceSection = PortableSystraceSection;
 #else
 struct DummySystraceSection {
  public:
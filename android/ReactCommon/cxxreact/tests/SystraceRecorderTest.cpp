@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <cxxreact/SystraceRecorder.h>
+
+using namespace facebook::react;
+
+static void recordSection(char const *name) {
+  SystraceRecorder::beginSection(name, {});
+  SystraceRecorder::endSection();
+}
+
+TEST(SystraceRecorderTest, recordsSectionsWithArguments) {
+  SystraceRecorder::start();
+  EXPECT_TRUE(SystraceRecorder::isRecording());
+
+  SystraceRecorder::SectionArgs args;
+  args.append("module", std::string{"UIManager"}, "callbackId", 42.5, "id", 7);
+  SystraceRecorder::beginSection("outer", args);
+  recordSection("inner");
+  SystraceRecorder::endSection();
+  SystraceRecorder::stop();
+
+  auto trace = SystraceRecorder::toChromeTrace();
+  EXPECT_NE(trace.find("\"name\":\"outer\""), std::string::npos);
+  EXPECT_NE(trace.find("\"name\":\"inner\""), std::string::npos);
+  EXPECT_NE(
+      trace.find(
+          "\"args\":{\"module\":\"UIManager\",\"callbackId\":\"42.5\",\"id\":\"7\"}"),
+      std::string::npos);
+}
+
+TEST(SystraceRecorderTest, startDropsPreviousRecordings) {
+  SystraceRecorder::start();
+  recordSection("first");
+  SystraceRecorder::start();
+  recordSection("second");
+  SystraceRecorder::stop();
+
+  auto trace = SystraceRecorder::toChromeTrace();
+  EXPECT_EQ(trace.find("\"first\""), std::string::npos);
+  EXPECT_NE(trace.find("\"second\""), std::string::npos);
+}
+
+TEST(SystraceRecorderTest, leavesOutUnmatchedAndOverwrittenEvents) {
+  SystraceRecorder::start({4});
+  SystraceRecorder::beginSection("overwritten", {});
+  recordSection("a");
+  recordSection("b");
+  SystraceRecorder::endSection();
+  SystraceRecorder::beginSection("inProgress", {});
+  SystraceRecorder::stop();
+
+  auto trace = SystraceRecorder::toChromeTrace();
+  EXPECT_EQ(trace.find("\"overwritten\""), std::string::npos);
+  EXPECT_EQ(trace.find("\"inProgress\""), std::string::npos);
+  EXPECT_NE(trace.find("\"b\""), std::string::npos);
+  EXPECT_EQ(SystraceRecorder::getOverwrittenEventCount(), 3);
+  SystraceRecorder::endSection();
+}
+
+TEST(SystraceRecorderTest, recordsEachThreadSeparately) {
+  SystraceRecorder::start();
+  auto thread = std::thread([]() { recordSection("background"); });
+  recordSection("main");
+  thread.join();
+  SystraceRecorder::stop();
+
+  auto trace = SystraceRecorder::toChromeTrace();
+  EXPECT_NE(trace.find("\"background\""), std::string::npos);
+  EXPECT_NE(trace.find("\"main\""), std::string::npos);
+}
+
+TEST(SystraceRecorderTest, writesPerfettoTrace) {
+  SystraceRecorder::start();
+  recordSection("section");
+  SystraceRecorder::stop();
+
+  auto stream = std::ostringstream{};
+  SystraceRecorder::writePerfettoTrace(stream);
+  auto trace = stream.str();
+
+  // A sequence of `Trace.packet` fields (field 1, length-delimited).
+  ASSERT_FALSE(trace.empty());
+  EXPECT_EQ(trace[0], '\x0a');
+  EXPECT_NE(trace.find("section"), std::string::npos);
+}
+
+TEST(SystraceRecorderTest, startSampled) {
+  EXPECT_FALSE(SystraceRecorder::startSampled(0));
+  EXPECT_FALSE(SystraceRecorder::isRecording());
+  EXPECT_TRUE(SystraceRecorder::startSampled(1));
+  EXPECT_TRUE(SystraceRecorder::isRecording());
+  SystraceRecorder::stop();
+}
@@ -0,0 +1,469 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <jsi/profiling.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <mutex>
+#include <unordered_map>
+
+namespace facebook {
+namespace jsi {
+
+namespace detail {
+
+using Clock = std::chrono::steady_clock;
+
+// Keeps profiles, and the stack of host functions being executed.
+// Profiles are guarded by a mutex so they can be read from any thread; the
+// stack is only used by the thread which is running JS.
+class HostFunctionProfiler {
+ public:
+  struct Entry {
+    uint64_t calls{0};
+    std::chrono::nanoseconds totalTime{};
+    std::chrono::nanoseconds selfTime{};
+    std::chrono::nanoseconds conversionTime{};
+  };
+
+  // Entries are never removed, so the returned reference stays valid.
+  Entry& getEntry(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_[name];
+  }
+
+  void enter(Entry& entry, const void* owner) {
+    auto now = Clock::now();
+    if (!frames_.empty()) {
+      // Time spent in a nested host function is not conversion.
+      auto& parent = frames_.back();
+      if (parent.conversionDepth > 0) {
+        parent.conversionTime += now - parent.conversionStart;
+      }
+    }
+    frames_.push_back(Frame{&entry, owner, now});
+  }
+
+  void exit() {
+    auto now = Clock::now();
+    auto frame = frames_.back();
+    frames_.pop_back();
+
+    auto totalTime = now - frame.start;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      frame.entry->calls++;
+      frame.entry->totalTime += totalTime;
+      frame.entry->selfTime += totalTime - frame.childTime;
+      frame.entry->conversionTime += frame.conversionTime;
+    }
+
+    if (!frames_.empty()) {
+      auto& parent = frames_.back();
+      parent.childTime += totalTime;
+      if (parent.conversionDepth > 0) {
+        parent.conversionStart = now;
+      }
+    }
+  }
+
+  void beginConversion() {
+    if (frames_.empty()) {
+      return;
+    }
+    auto& frame = frames_.back();
+    if (frame.conversionDepth++ == 0) {
+      frame.conversionStart = Clock::now();
+    }
+  }
+
+  void endConversion() {
+    if (frames_.empty()) {
+      return;
+    }
+    auto& frame = frames_.back();
+    if (frame.conversionDepth > 0 && --frame.conversionDepth == 0) {
+      frame.conversionTime += Clock::now() - frame.conversionStart;
+    }
+  }
+
+  // The HostObject whose property is being got or set, if any.
+  const void* getCurrentOwner() const {
+    return frames_.empty() ? nullptr : frames_.back().owner;
+  }
+
+  std::vector<HostFunctionProfile> getProfiles() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto profiles = std::vector<HostFunctionProfile>{};
+    profiles.reserve(entries_.size());
+    for (const auto& pair : entries_) {
+      if (pair.second.calls == 0) {
+        continue;
+      }
+      profiles.push_back(HostFunctionProfile{
+          pair.first,
+          pair.second.calls,
+          pair.second.totalTime,
+          pair.second.selfTime,
+          pair.second.conversionTime});
+    }
+    return profiles;
+  }
+
+  void reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& pair : entries_) {
+      pair.second = Entry{};
+    }
+  }
+
+ private:
+  struct Frame {
+    Entry* entry;
+    const void* owner;
+    Clock::time_point start;
+    Clock::duration childTime{};
+    Clock::duration conversionTime{};
+    Clock::time_point conversionStart{};
+    int conversionDepth{0};
+  };
+
+  std::vector<Frame> frames_;
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, Entry> entries_;
+};
+
+namespace {
+
+class ProfilerScope {
+ public:
+  ProfilerScope(
+      HostFunctionProfiler& profiler,
+      HostFunctionProfiler::Entry& entry,
+      const void* owner)
+      : profiler_(profiler) {
+    profiler_.enter(entry, owner);
+  }
+
+  ~ProfilerScope() {
+    profiler_.exit();
+  }
+
+ private:
+  HostFunctionProfiler& profiler_;
+};
+
+} // namespace
+
+void WithHostFunctionProfiler::before() {
+  profiler.beginConversion();
+}
+
+void WithHostFunctionProfiler::after() {
+  profiler.endConversion();
+}
+
+} // namespace detail
+
+class ProfilingRuntime::ProfiledHostObject final : public HostObject {
+ public:
+  ProfiledHostObject(
+      std::shared_ptr<HostObject> plain,
+      std::shared_ptr<detail::HostFunctionProfiler> profiler)
+      : plain_(std::move(plain)), profiler_(std::move(profiler)) {}
+
+  Value get(Runtime& rt, const PropNameID& name) override {
+    auto& entry = getEntry(getEntries_, "get ", name.utf8(rt));
+    detail::ProfilerScope scope(*profiler_, entry, this);
+    return plain_->get(rt, name);
+  }
+
+  void set(Runtime& rt, const PropNameID& name, const Value& value) override {
+    auto& entry = getEntry(setEntries_, "set ", name.utf8(rt));
+    detail::ProfilerScope scope(*profiler_, entry, this);
+    plain_->set(rt, name, value);
+  }
+
+  std::vector<PropNameID> getPropertyNames(Runtime& rt) override {
+    return plain_->getPropertyNames(rt);
+  }
+
+  const std::shared_ptr<HostObject>& getPlain() const {
+    return plain_;
+  }
+
+  bool hasName() const {
+    return !name_.empty();
+  }
+
+  void setName(std::string name) {
+    name_ = std::move(name);
+    getEntries_.clear();
+    setEntries_.clear();
+  }
+
+  std::string qualifiedName(const std::string& propertyName) const {
+    return (name_.empty() ? "HostObject" : name_) + "." + propertyName;
+  }
+
+ private:
+  using Entries =
+      std::unordered_map<std::string, detail::HostFunctionProfiler::Entry*>;
+
+  detail::HostFunctionProfiler::Entry& getEntry(
+      Entries& entries,
+      const char* prefix,
+      const std::string& propertyName) {
+    auto it = entries.find(propertyName);
+    if (it == entries.end()) {
+      auto& entry = profiler_->getEntry(prefix + qualifiedName(propertyName));
+      it = entries.emplace(propertyName, &entry).first;
+    }
+    return *it->second;
+  }
+
+  std::shared_ptr<HostObject> plain_;
+  std::shared_ptr<detail::HostFunctionProfiler> profiler_;
+  std::string name_;
+  Entries getEntries_;
+  Entries setEntries_;
+};
+
+class ProfilingRuntime::ProfiledHostFunction final {
+ public:
+  ProfiledHostFunction(
+      HostFunctionType plain,
+      ProfilingRuntime& runtime,
+      detail::HostFunctionProfiler::Entry& entry,
+      bool namesHostObjects)
+      : plain_(std::move(plain)),
+        runtime_(runtime),
+        entry_(entry),
+        namesHostObjects_(namesHostObjects) {}
+
+  Value operator()(
+      Runtime& rt,
+      const Value& thisVal,
+      const Value* args,
+      size_t count) {
+    auto result = Value{};
+    {
+      detail::ProfilerScope scope(*runtime_.profiler_, entry_, nullptr);
+      result = plain_(rt, thisVal, args, count);
+    }
+
+    // Functions like `__turboModuleProxy` return HostObjects for the name
+    // they are passed.
+    if (namesHostObjects_ && result.isObject() && count > 0 &&
+        args[0].isString()) {
+      runtime_.nameHostObject(result, args[0].getString(rt).utf8(rt));
+    }
+    return result;
+  }
+
+  HostFunctionType& getPlain() {
+    return plain_;
+  }
+
+ private:
+  HostFunctionType plain_;
+  // Host functions are owned by the plain runtime, which doesn't outlive
+  // the decorator.
+  ProfilingRuntime& runtime_;
+  detail::HostFunctionProfiler::Entry& entry_;
+  bool namesHostObjects_;
+};
+
+ProfilingRuntime::ProfilingRuntime(std::unique_ptr<Runtime> plain)
+    : WRD(*plain, with_),
+      plain_(std::move(plain)),
+      profiler_(std::make_shared<detail::HostFunctionProfiler>()),
+      with_(*profiler_) {}
+
+ProfilingRuntime::~ProfilingRuntime() = default;
+
+void ProfilingRuntime::setHostObjectName(
+    const Object& object,
+    std::string name) {
+  auto hostObject = WRD::getHostObject(object);
+  static_cast<ProfiledHostObject&>(*hostObject).setName(std::move(name));
+}
+
+std::vector<HostFunctionProfile> ProfilingRuntime::getProfiles(
+    HostFunctionProfileOrder order) const {
+  auto profiles = profiler_->getProfiles();
+  auto key = [order](const HostFunctionProfile& profile) {
+    switch (order) {
+      case HostFunctionProfileOrder::TotalTime:
+        return static_cast<uint64_t>(profile.totalTime.count());
+      case HostFunctionProfileOrder::SelfTime:
+        return static_cast<uint64_t>(profile.selfTime.count());
+      case HostFunctionProfileOrder::ConversionTime:
+        return static_cast<uint64_t>(profile.conversionTime.count());
+      case HostFunctionProfileOrder::Calls:
+        return profile.calls;
+    }
+    return uint64_t{0};
+  };
+  std::sort(
+      profiles.begin(),
+      profiles.end(),
+      [&](const HostFunctionProfile& a, const HostFunctionProfile& b) {
+        auto keyA = key(a);
+        auto keyB = key(b);
+        return keyA != keyB ? keyA > keyB : a.name < b.name;
+      });
+  return profiles;
+}
+
+std::string ProfilingRuntime::dumpProfiles(
+    HostFunctionProfileOrder order,
+    size_t maxRows) const {
+  auto profiles = getProfiles(order);
+  if (maxRows != 0 && profiles.size() > maxRows) {
+    profiles.resize(maxRows);
+  }
+
+  auto nameWidth = size_t{4};
+  for (const auto& profile : profiles) {
+    nameWidth = std::max(nameWidth, profile.name.size());
+  }
+
+  auto toMilliseconds = [](std::chrono::nanoseconds duration) {
+    return static_cast<double>(duration.count()) / 1e6;
+  };
+
+  char line[128];
+  auto result = std::string{};
+  std::snprintf(
+      line,
+      sizeof(line),
+      "%-*s %10s %12s %12s %12s\n",
+      static_cast<int>(nameWidth),
+      "name",
+      "calls",
+      "total ms",
+      "self ms",
+      "convert ms");
+  result += line;
+  for (const auto& profile : profiles) {
+    result += profile.name;
+    result.append(nameWidth - profile.name.size(), ' ');
+    std::snprintf(
+        line,
+        sizeof(line),
+        " %10" PRIu64 " %12.3f %12.3f %12.3f\n",
+        profile.calls,
+        toMilliseconds(profile.totalTime),
+        toMilliseconds(profile.selfTime),
+        toMilliseconds(profile.conversionTime));
+    result += line;
+  }
+  return result;
+}
+
+void ProfilingRuntime::resetProfiles() {
+  profiler_->reset();
+}
+
+Object ProfilingRuntime::createObject(std::shared_ptr<HostObject> ho) {
+  return WRD::createObject(
+      std::make_shared<ProfiledHostObject>(std::move(ho), profiler_));
+}
+
+std::shared_ptr<HostObject> ProfilingRuntime::getHostObject(
+    const jsi::Object& o) {
+  auto hostObject = WRD::getHostObject(o);
+  return static_cast<ProfiledHostObject&>(*hostObject).getPlain();
+}
+
+Function ProfilingRuntime::createFunctionFromHostFunction(
+    const PropNameID& name,
+    unsigned int paramCount,
+    HostFunctionType func) {
+  auto owner = static_cast<const ProfiledHostObject*>(
+      profiler_->getCurrentOwner());
+  auto functionName = WRD::utf8(name);
+  auto& entry = profiler_->getEntry(
+      owner ? owner->qualifiedName(functionName) : functionName);
+  return WRD::createFunctionFromHostFunction(
+      name,
+      paramCount,
+      ProfiledHostFunction(std::move(func), *this, entry, owner == nullptr));
+}
+
+HostFunctionType& ProfilingRuntime::getHostFunction(const jsi::Function& f) {
+  auto& hostFunction = WRD::getHostFunction(f);
+  // This will fail if a cpp file including this header is not compiled
+  // with RTTI.
+  return hostFunction.target<ProfiledHostFunction>()->getPlain();
+}
+
+void ProfilingRuntime::setPropertyValue(
+    Object& o,
+    const PropNameID& name,
+    const Value& value) {
+  WRD::setPropertyValue(o, name, value);
+  if (value.isObject()) {
+    nameHostObject(value, WRD::utf8(name));
+  }
+}
+
+void ProfilingRuntime::setPropertyValue(
+    Object& o,
+    const String& name,
+    const Value& value) {
+  WRD::setPropertyValue(o, name, value);
+  if (value.isObject()) {
+    nameHostObject(value, WRD::utf8(name));
+  }
+}
+
+Value ProfilingRuntime::evaluateJavaScript(
+    const std::shared_ptr<const Buffer>& buffer,
+    const std::string& sourceURL) {
+  return RD::evaluateJavaScript(buffer, sourceURL);
+}
+
+Value ProfilingRuntime::evaluatePreparedJavaScript(
+    const std::shared_ptr<const PreparedJavaScript>& js) {
+  return RD::evaluatePreparedJavaScript(js);
+}
+
+Value ProfilingRuntime::call(
+    const Function& f,
+    const Value& jsThis,
+    const Value* args,
+    size_t count) {
+  return RD::call(f, jsThis, args, count);
+}
+
+Value ProfilingRuntime::callAsConstructor(
+    const Function& f,
+    const Value* args,
+    size_t count) {
+  return RD::callAsConstructor(f, args, count);
+}
+
+void ProfilingRuntime::nameHostObject(
+    const Value& value,
+    const std::string& name) {
+  auto object = value.getObject(*this);
+  if (!WRD::isHostObject(object)) {
+    return;
+  }
+  auto hostObject = WRD::getHostObject(object);
+  auto& profiledHostObject = static_cast<ProfiledHostObject&>(*hostObject);
+  if (!profiledHostObject.hasName()) {
+    profiledHostObject.setName(name);
+  }
+}
+
+} // namespace jsi
+} // namespace facebook
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <jsi/decorator.h>
+#include <jsi/jsi.h>
+
+namespace facebook {
+namespace jsi {
+
+/// Time spent in a host function, or in get/set of a HostObject property,
+/// as recorded by ProfilingRuntime.
+struct HostFunctionProfile {
+  /// e.g. "nativeFabricUIManager.createNode" for a host function, or
+  /// "get nativeFabricUIManager.createNode" for a HostObject property.
+  std::string name;
+  uint64_t calls{0};
+  /// Wall time between entering and leaving the host function.
+  std::chrono::nanoseconds totalTime{};
+  /// Total time, minus time spent in nested host functions (e.g. ones
+  /// called by JS which was called by this host function).
+  std::chrono::nanoseconds selfTime{};
+  /// Part of the self time spent in the runtime converting arguments and
+  /// results (reading properties, creating strings, ...), as opposed to
+  /// running JS or native code.
+  std::chrono::nanoseconds conversionTime{};
+};
+
+enum class HostFunctionProfileOrder {
+  TotalTime,
+  SelfTime,
+  ConversionTime,
+  Calls,
+};
+
+namespace detail {
+
+class HostFunctionProfiler;
+
+struct WithHostFunctionProfiler {
+  explicit WithHostFunctionProfiler(HostFunctionProfiler& profiler)
+      : profiler(profiler) {}
+  void before();
+  void after();
+
+  HostFunctionProfiler& profiler;
+};
+
+} // namespace detail
+
+/// A decorator which records how much time JS spends in host functions and
+/// HostObjects, per function name. Host functions created by a HostObject
+/// while getting a property are named after the HostObject and the property.
+/// A HostObject is named after the first property it's assigned to (e.g.
+/// "nativeFabricUIManager" when installed on the global object), or after
+/// the first string argument of the host function which returned it (e.g.
+/// the module name passed to "__turboModuleProxy"), unless it was named
+/// explicitly with setHostObjectName.
+///
+/// Profiles can be read from any thread. Recording costs a couple of clock
+/// reads per host function call and per runtime call made from a host
+/// function, so it's meant for profiling builds.
+class ProfilingRuntime final
+    : public WithRuntimeDecorator<detail::WithHostFunctionProfiler> {
+ public:
+  explicit ProfilingRuntime(std::unique_ptr<Runtime> plain);
+  ~ProfilingRuntime() override;
+
+  /// Names a HostObject created by this runtime. Host functions which the
+  /// HostObject creates later are named after it.
+  void setHostObjectName(const Object& object, std::string name);
+
+  /// Returns profiles of all host functions called so far, sorted in
+  /// descending order.
+  std::vector<HostFunctionProfile> getProfiles(
+      HostFunctionProfileOrder order = HostFunctionProfileOrder::TotalTime)
+      const;
+
+  /// Returns profiles as a human readable table, with times in
+  /// milliseconds. If \p maxRows is not 0, only that many rows are
+  /// included.
+  std::string dumpProfiles(
+      HostFunctionProfileOrder order = HostFunctionProfileOrder::TotalTime,
+      size_t maxRows = 0) const;
+
+  /// Clears all recorded profiles.
+  void resetProfiles();
+
+  Value evaluateJavaScript(
+      const std::shared_ptr<const Buffer>& buffer,
+      const std::string& sourceURL) override;
+  Value evaluatePreparedJavaScript(
+      const std::shared_ptr<const PreparedJavaScript>& js) override;
+
+ protected:
+  Object createObject(std::shared_ptr<HostObject> ho) override;
+  std::shared_ptr<HostObject> getHostObject(const jsi::Object& o) override;
+  Function createFunctionFromHostFunction(
+      const PropNameID& name,
+      unsigned int paramCount,
+      HostFunctionType func) override;
+  HostFunctionType& getHostFunction(const jsi::Function& f) override;
+
+  void setPropertyValue(Object& o, const PropNameID& name, const Value& value)
+      override;
+  void setPropertyValue(Object& o, const String& name, const Value& value)
+      override;
+
+  // Running JS is not conversion, so these skip the profiler.
+  Value call(
+      const Function& f,
+      const Value& jsThis,
+      const Value* args,
+      size_t count) override;
+  Value callAsConstructor(const Function& f, const Value* args, size_t count)
+      override;
+
+ private:
+  using WRD = WithRuntimeDecorator<detail::WithHostFunctionProfiler>;
+
+  class ProfiledHostObject;
+  class ProfiledHostFunction;
+
+  void nameHostObject(const Value& value, const std::string& name);
+
+  std::unique_ptr<Runtime> plain_;
+  std::shared_ptr<detail::HostFunctionProfiler> profiler_;
+  detail::WithHostFunctionProfiler with_;
+};
+
+} // namespace jsi
+} // namespace facebook
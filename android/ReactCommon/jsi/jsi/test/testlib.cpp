@@ -9,8 +9,12 @@
 #include <gtest/gtest.h>
 #include <jsi/decorator.h>
 #include <jsi/jsi.h>
+#include <jsi/profiling.h>
+#include <jsi/threadsafe.h>
 
 #include <stdlib.h>
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <thread>
@@ -1240,6 +1244,127 @@ TEST_P(JSITest, MultiDecoratorTest) {
   EXPECT_EQ(mrt.nest(), 0);
 }
 
+TEST_P(JSITest, ProfilingRuntimeTest) {
+  class Module : public HostObject {
+   public:
+    Value get(Runtime& rt, const PropNameID& name) override {
+      return Function::createFromHostFunction(
+          rt,
+          name,
+          1,
+          [](Runtime& rt, const Value&, const Value* args, size_t count) {
+            EXPECT_EQ(count, 1);
+            return Value(args[0].getObject(rt).getProperty(rt, "x"));
+          });
+    }
+  };
+
+  ProfilingRuntime prt(factory());
+
+  prt.global().setProperty(
+      prt,
+      "module",
+      Object::createFromHostObject(prt, std::make_shared<Module>()));
+  prt.global().setProperty(
+      prt,
+      "callback",
+      Function::createFromHostFunction(
+          prt,
+          PropNameID::forAscii(prt, "callback"),
+          1,
+          [](Runtime& rt, const Value&, const Value* args, size_t) {
+            return args[0].getObject(rt).asFunction(rt).call(rt);
+          }));
+
+  prt.evaluateJavaScript(
+      std::make_unique<StringBuffer>(
+          "for (var i = 0; i < 3; i++) module.method({x: i});"
+          "callback(function() { return module.method({x: 1}); });"),
+      "");
+
+  auto profiles = prt.getProfiles(HostFunctionProfileOrder::Calls);
+  auto find = [&](const std::string& name) {
+    auto it = std::find_if(
+        profiles.begin(),
+        profiles.end(),
+        [&](const HostFunctionProfile& profile) {
+          return profile.name == name;
+        });
+    EXPECT_NE(it, profiles.end()) << name;
+    return it == profiles.end() ? HostFunctionProfile{} : *it;
+  };
+
+  auto method = find("module.method");
+  EXPECT_EQ(method.calls, 4);
+  EXPECT_GE(method.totalTime, method.selfTime);
+  EXPECT_GE(method.selfTime, method.conversionTime);
+  EXPECT_EQ(find("get module.method").calls, 4);
+
+  auto callback = find("callback");
+  EXPECT_EQ(callback.calls, 1);
+  EXPECT_LE(callback.selfTime, callback.totalTime);
+
+  EXPECT_NE(
+      prt.dumpProfiles(HostFunctionProfileOrder::SelfTime)
+          .find("module.method"),
+      std::string::npos);
+
+  prt.resetProfiles();
+  EXPECT_TRUE(prt.getProfiles().empty());
+}
+
+TEST_P(JSITest, OwnerBiasedThreadSafeRuntimeTest) {
+  // Composed like detail::OwnerBiasedThreadSafeRuntimeImpl, which needs a
+  // concrete runtime type.
+  using Lock = detail::WithLock<Runtime, detail::OwnerBiasedLock>;
+  auto plain = factory();
+  Lock lock(*plain);
+  WithRuntimeDecorator<Lock> tsrt(*plain, lock);
+  auto eval = [&](const char* code) {
+    return tsrt.evaluateJavaScript(std::make_unique<StringBuffer>(code), "");
+  };
+
+  // The first thread to use the runtime becomes its owner, and doesn't take
+  // the mutex while it's alone.
+  eval("x = 1");
+  EXPECT_EQ(lock.lock.getOwner(), std::this_thread::get_id());
+  auto stats = lock.lock.getStats();
+  EXPECT_GT(stats.ownerFastLocks, 0);
+  EXPECT_EQ(stats.ownerContendedLocks, 0);
+  EXPECT_EQ(stats.foreignLocks, 0);
+
+  // A foreign thread waits for the owner to release the runtime.
+  lock.before();
+  std::thread foreign([&] { eval("x = x + 1"); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_EQ(eval("x").getNumber(), 1);
+  lock.after();
+  foreign.join();
+  EXPECT_EQ(eval("x").getNumber(), 2);
+  stats = lock.lock.getStats();
+  EXPECT_GT(stats.foreignLocks, 0);
+  EXPECT_EQ(stats.ownerContendedLocks, 0);
+
+  // The owner waits for a foreign thread which holds the runtime.
+  std::atomic<bool> locked{false};
+  std::thread holder([&] {
+    lock.before();
+    locked = true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    eval("x = x + 1");
+    lock.after();
+  });
+  while (!locked) {
+    std::this_thread::yield();
+  }
+  EXPECT_EQ(eval("x").getNumber(), 3);
+  holder.join();
+  stats = lock.lock.getStats();
+  EXPECT_EQ(stats.ownerContendedLocks, 1);
+  EXPECT_GT(stats.waitTime.count(), 0);
+  EXPECT_GE(stats.foreignLocks, stats.foreignContendedLocks);
+}
+
 TEST_P(JSITest, SymbolTest) {
   if (!rt.global().hasProperty(rt, "Symbol")) {
     // Symbol is an es6 feature which doesn't exist in older VMs.  So
@@ -7,7 +7,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <mutex>
+#include <thread>
 
 #include <jsi/decorator.h>
 #include <jsi/jsi.h>
@@ -22,6 +27,21 @@ class ThreadSafeRuntime : public Runtime {
   virtual Runtime& getUnsafeRuntime() = 0;
 };
 
+// Counters reported by detail::OwnerBiasedLock.
+struct OwnerBiasedLockStats {
+  // Locks taken by the owner thread without touching the mutex.
+  uint64_t ownerFastLocks{0};
+  // Locks taken by the owner thread while another thread held the runtime.
+  uint64_t ownerContendedLocks{0};
+  // Locks taken by other threads.
+  uint64_t foreignLocks{0};
+  // Locks taken by other threads which had to wait for the runtime to be
+  // released by the owner thread or by another thread.
+  uint64_t foreignContendedLocks{0};
+  // Total time spent waiting in contended locks, by all threads.
+  std::chrono::nanoseconds waitTime{};
+};
+
 namespace detail {
 
 template <typename R, typename L>
@@ -36,6 +56,205 @@ struct WithLock {
   }
 };
 
+// A recursive lock biased towards the thread which locks it first (the owner,
+// usually the JS thread). The owner locks and unlocks it with a couple of
+// atomic operations on a flag it shares with other threads, and only falls
+// back to the mutex while another thread (e.g. the UI thread) is using the
+// runtime. Other threads always take the mutex, and then wait for the owner
+// to leave the runtime if it's inside. That makes foreign locks slower than
+// with a plain mutex, so this suits runtimes which are mostly used from one
+// thread.
+//
+// The owner can't be changed once it's set.
+class OwnerBiasedLock {
+ public:
+  template <typename R>
+  explicit OwnerBiasedLock(R&) {}
+
+  OwnerBiasedLock(const OwnerBiasedLock&) = delete;
+  OwnerBiasedLock& operator=(const OwnerBiasedLock&) = delete;
+
+  void lock() {
+    if (isOwner()) {
+      lockAsOwner();
+    } else {
+      lockAsForeign();
+    }
+  }
+
+  void unlock() {
+    if (isOwner()) {
+      unlockAsOwner();
+    } else {
+      unlockAsForeign();
+    }
+  }
+
+  // Returns the id of the owner thread, or a default constructed id if the
+  // lock was never taken.
+  std::thread::id getOwner() const {
+    return owner_.load(std::memory_order_acquire);
+  }
+
+  // Can be called from any thread.
+  OwnerBiasedLockStats getStats() const {
+    auto stats = OwnerBiasedLockStats{};
+    stats.ownerFastLocks = ownerFastLocks_.load(std::memory_order_relaxed);
+    stats.ownerContendedLocks =
+        ownerContendedLocks_.load(std::memory_order_relaxed);
+    stats.foreignLocks = foreignLocks_.load(std::memory_order_relaxed);
+    stats.foreignContendedLocks =
+        foreignContendedLocks_.load(std::memory_order_relaxed);
+    stats.waitTime = std::chrono::nanoseconds(
+        waitTime_.load(std::memory_order_relaxed));
+    return stats;
+  }
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  // Counters have a single writer at a time (the owner thread, or the thread
+  // holding the mutex), so they don't need atomic increments.
+  static void increment(std::atomic<uint64_t>& counter) {
+    counter.store(
+        counter.load(std::memory_order_relaxed) + 1,
+        std::memory_order_relaxed);
+  }
+
+  void addWaitTime(Clock::time_point start) {
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Clock::now() - start);
+    waitTime_.store(
+        waitTime_.load(std::memory_order_relaxed) + elapsed.count(),
+        std::memory_order_relaxed);
+  }
+
+  bool isOwner() {
+    auto current = std::this_thread::get_id();
+    auto owner = owner_.load(std::memory_order_relaxed);
+    if (owner == current) {
+      return true;
+    }
+    if (owner != std::thread::id{}) {
+      return false;
+    }
+    return owner_.compare_exchange_strong(
+        owner, current, std::memory_order_acq_rel);
+  }
+
+  void lockAsOwner() {
+    if (ownerDepth_++ > 0) {
+      return;
+    }
+
+    // Together with the store to foreignActive_ and the load of ownerInside_
+    // in lockAsForeign, this guarantees that at least one of the threads sees
+    // the other one.
+    ownerInside_.store(true, std::memory_order_seq_cst);
+    if (!foreignActive_.load(std::memory_order_seq_cst)) {
+      increment(ownerFastLocks_);
+      return;
+    }
+
+    // Another thread is using the runtime (or is about to); step back and
+    // wait for it on the mutex.
+    ownerInside_.store(false, std::memory_order_seq_cst);
+    notifyForeignWaiter();
+
+    auto start = Clock::now();
+    mutex_.lock();
+    ownerHoldsMutex_ = true;
+    increment(ownerContendedLocks_);
+    addWaitTime(start);
+  }
+
+  void unlockAsOwner() {
+    if (--ownerDepth_ > 0) {
+      return;
+    }
+
+    if (ownerHoldsMutex_) {
+      ownerHoldsMutex_ = false;
+      mutex_.unlock();
+      return;
+    }
+
+    // A stale foreignActive_ here only delays the waiter until its next
+    // timed check, so a full fence is not needed on this path.
+    ownerInside_.store(false, std::memory_order_release);
+    if (foreignActive_.load(std::memory_order_relaxed)) {
+      notifyForeignWaiter();
+    }
+  }
+
+  void lockAsForeign() {
+    auto contended = false;
+    auto start = Clock::time_point{};
+    if (!mutex_.try_lock()) {
+      contended = true;
+      start = Clock::now();
+      mutex_.lock();
+    }
+
+    if (foreignDepth_++ > 0) {
+      return;
+    }
+
+    foreignActive_.store(true, std::memory_order_seq_cst);
+    if (ownerInside_.load(std::memory_order_seq_cst)) {
+      if (!contended) {
+        contended = true;
+        start = Clock::now();
+      }
+      std::unique_lock<std::mutex> waitLock(waitMutex_);
+      while (ownerInside_.load(std::memory_order_seq_cst)) {
+        waitCondition_.wait_for(waitLock, std::chrono::milliseconds(1));
+      }
+    }
+
+    increment(foreignLocks_);
+    if (contended) {
+      increment(foreignContendedLocks_);
+      addWaitTime(start);
+    }
+  }
+
+  void unlockAsForeign() {
+    if (--foreignDepth_ == 0) {
+      foreignActive_.store(false, std::memory_order_seq_cst);
+    }
+    mutex_.unlock();
+  }
+
+  void notifyForeignWaiter() {
+    std::lock_guard<std::mutex> waitLock(waitMutex_);
+    waitCondition_.notify_one();
+  }
+
+  std::atomic<std::thread::id> owner_{};
+  // Set while the owner thread is using the runtime without the mutex.
+  std::atomic<bool> ownerInside_{false};
+  // Set while a foreign thread holds the mutex.
+  std::atomic<bool> foreignActive_{false};
+
+  // Accessed only by the owner thread.
+  int ownerDepth_{0};
+  bool ownerHoldsMutex_{false};
+
+  // Accessed only by the thread holding the mutex.
+  int foreignDepth_{0};
+
+  std::recursive_mutex mutex_;
+  std::mutex waitMutex_;
+  std::condition_variable waitCondition_;
+
+  std::atomic<uint64_t> ownerFastLocks_{0};
+  std::atomic<uint64_t> ownerContendedLocks_{0};
+  std::atomic<uint64_t> foreignLocks_{0};
+  std::atomic<uint64_t> foreignContendedLocks_{0};
+  std::atomic<int64_t> waitTime_{0};
+};
+
 // The actual implementation of a given ThreadSafeRuntime. It's parameterized
 // by:
 //
@@ -68,11 +287,22 @@ class ThreadSafeRuntimeImpl final
     lock_.after();
   }
 
+  const L& getLock() const {
+    return lock_.lock;
+  }
+
  private:
   R unsafe_;
   mutable WithLock<R, L> lock_;
 };
 
+// A ThreadSafeRuntime which only takes a mutex when the runtime is used from
+// more than one thread at a time. Contention can be inspected with
+// getLock().getStats().
+template <typename R>
+using OwnerBiasedThreadSafeRuntimeImpl =
+    ThreadSafeRuntimeImpl<R, OwnerBiasedLock>;
+
 } // namespace detail
 
 } // namespace jsi
@@ -138,10 +138,7 @@ void JSIExecutor::initializeRuntime() {
   if (runtimeInstaller_) {
     runtimeInstaller_(*runtime_);
   }
-  bool hasLogger(ReactMarker::logTaggedMarker);
-  if (hasLogger) {
-    ReactMarker::logMarker(ReactMarker::CREATE_REACT_CONTEXT_STOP);
-  }
+  ReactMarker::logMarker(ReactMarker::CREATE_REACT_CONTEXT_STOP);
 }
 
 void JSIExecutor::loadBundle(
@@ -149,19 +146,12 @@ void JSIExecutor::loadBundle(
     std::string sourceURL) {
   SystraceSection s("JSIExecutor::loadBundle");
 
-  bool hasLogger(ReactMarker::logTaggedMarker);
   std::string scriptName = simpleBasename(sourceURL);
-  if (hasLogger) {
-    ReactMarker::logTaggedMarker(
-        ReactMarker::RUN_JS_BUNDLE_START, scriptName.c_str());
-  }
+  ReactMarker::logMarker(ReactMarker::RUN_JS_BUNDLE_START, scriptName.c_str());
   runtime_->evaluateJavaScript(
       std::make_unique<BigStringBuffer>(std::move(script)), sourceURL);
   flush();
-  if (hasLogger) {
-    ReactMarker::logTaggedMarker(
-        ReactMarker::RUN_JS_BUNDLE_STOP, scriptName.c_str());
-  }
+  ReactMarker::logMarker(ReactMarker::RUN_JS_BUNDLE_STOP, scriptName.c_str());
 }
 
 void JSIExecutor::setBundleRegistry(std::unique_ptr<RAMBundleRegistry> r) {
@@ -186,8 +176,7 @@ void JSIExecutor::registerBundle(
     uint32_t bundleId,
     const std::string &bundlePath) {
   const auto tag = folly::to<std::string>(bundleId);
-  ReactMarker::logTaggedMarker(
-      ReactMarker::REGISTER_JS_SEGMENT_START, tag.c_str());
+  ReactMarker::logMarker(ReactMarker::REGISTER_JS_SEGMENT_START, tag.c_str());
   if (bundleRegistry_) {
     bundleRegistry_->registerBundle(bundleId, bundlePath);
   } else {
@@ -200,8 +189,7 @@ void JSIExecutor::registerBundle(
         std::make_unique<BigStringBuffer>(std::move(script)),
         JSExecutor::getSyntheticBundlePath(bundleId, bundlePath));
   }
-  ReactMarker::logTaggedMarker(
-      ReactMarker::REGISTER_JS_SEGMENT_STOP, tag.c_str());
+  ReactMarker::logMarker(ReactMarker::REGISTER_JS_SEGMENT_STOP, tag.c_str());
 }
 
 void JSIExecutor::callFunction(
@@ -68,11 +68,7 @@ void JSINativeModules::reset() {
 folly::Optional<Object> JSINativeModules::createModule(
     Runtime &rt,
     const std::string &name) {
-  bool hasLogger(ReactMarker::logTaggedMarker);
-  if (hasLogger) {
-    ReactMarker::logTaggedMarker(
-        ReactMarker::NATIVE_MODULE_SETUP_START, name.c_str());
-  }
+  ReactMarker::logMarker(ReactMarker::NATIVE_MODULE_SETUP_START, name.c_str());
 
   if (!m_genNativeModuleJS) {
     m_genNativeModuleJS =
@@ -93,10 +89,7 @@ folly::Optional<Object> JSINativeModules::createModule(
   folly::Optional<Object> module(
       moduleInfo.asObject(rt).getPropertyAsObject(rt, "module"));
 
-  if (hasLogger) {
-    ReactMarker::logTaggedMarker(
-        ReactMarker::NATIVE_MODULE_SETUP_STOP, name.c_str());
-  }
+  ReactMarker::logMarker(ReactMarker::NATIVE_MODULE_SETUP_STOP, name.c_str());
 
   return module;
 }
@@ -7,6 +7,8 @@
 
 #include "TurboModulePerfLogger.h"
 
+#include <reactperflogger/StartupTimeline.h>
+
 namespace facebook {
 namespace react {
 namespace TurboModulePerfLogger {
@@ -36,6 +38,7 @@ void moduleDataCreateEnd(const char *moduleName, int32_t id) {
 }
 
 void moduleCreateStart(const char *moduleName, int32_t id) {
+  StartupTimeline::logEvent(StartupTimeline::kModuleCreateStart, moduleName);
   NativeModulePerfLogger *logger = g_perfLogger.get();
   if (logger != nullptr) {
     logger->moduleCreateStart(moduleName, id);
@@ -78,6 +81,7 @@ void moduleCreateSetUpEnd(const char *moduleName, int32_t id) {
 }
 
 void moduleCreateEnd(const char *moduleName, int32_t id) {
+  StartupTimeline::logEvent(StartupTimeline::kModuleCreateEnd, moduleName);
   NativeModulePerfLogger *logger = g_perfLogger.get();
   if (logger != nullptr) {
     logger->moduleCreateEnd(moduleName, id);
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "AnimationKeyFrameValues.h"
+
+namespace facebook {
+namespace react {
+
+/*
+ * `result[i] = start[i] + (end[i] - start[i]) * progress[i]`.
+ * Kept free of aliasing and branches so it compiles to SIMD code.
+ */
+static void interpolateValues(
+    Float const *__restrict progress,
+    Float const *__restrict start,
+    Float const *__restrict end,
+    Float *__restrict result,
+    size_t size) noexcept {
+  for (size_t i = 0; i < size; i++) {
+    result[i] = start[i] + (end[i] - start[i]) * progress[i];
+  }
+}
+
+void AnimationKeyFrameValues::clear() noexcept {
+  progress_.clear();
+  startX_.clear();
+  startY_.clear();
+  startWidth_.clear();
+  startHeight_.clear();
+  endX_.clear();
+  endY_.clear();
+  endWidth_.clear();
+  endHeight_.clear();
+}
+
+size_t AnimationKeyFrameValues::append(
+    Rect const &start,
+    Rect const &end,
+    Float progress) noexcept {
+  progress_.push_back(progress);
+  startX_.push_back(start.origin.x);
+  startY_.push_back(start.origin.y);
+  startWidth_.push_back(start.size.width);
+  startHeight_.push_back(start.size.height);
+  endX_.push_back(end.origin.x);
+  endY_.push_back(end.origin.y);
+  endWidth_.push_back(end.size.width);
+  endHeight_.push_back(end.size.height);
+  return progress_.size() - 1;
+}
+
+void AnimationKeyFrameValues::interpolate() noexcept {
+  auto count = size();
+  x_.resize(count);
+  y_.resize(count);
+  width_.resize(count);
+  height_.resize(count);
+
+  interpolateValues(
+      progress_.data(), startX_.data(), endX_.data(), x_.data(), count);
+  interpolateValues(
+      progress_.data(), startY_.data(), endY_.data(), y_.data(), count);
+  interpolateValues(
+      progress_.data(),
+      startWidth_.data(),
+      endWidth_.data(),
+      width_.data(),
+      count);
+  interpolateValues(
+      progress_.data(),
+      startHeight_.data(),
+      endHeight_.data(),
+      height_.data(),
+      count);
+}
+
+Rect AnimationKeyFrameValues::getFrame(size_t index) const noexcept {
+  return {{x_[index], y_[index]}, {width_[index], height_[index]}};
+}
+
+Float AnimationKeyFrameValues::getProgress(size_t index) const noexcept {
+  return progress_[index];
+}
+
+size_t AnimationKeyFrameValues::size() const noexcept {
+  return progress_.size();
+}
+
+} // namespace react
+} // namespace facebook
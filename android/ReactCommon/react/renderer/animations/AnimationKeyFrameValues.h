@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <react/renderer/graphics/Geometry.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Structure-of-arrays storage for layout values animated on a single frame.
+ * Keyframes of all in-flight animations are appended first, then interpolated
+ * in one pass over contiguous arrays (which the compiler vectorizes), and only
+ * then materialized into ShadowViews.
+ * The storage is meant to be reused across frames to avoid reallocations.
+ */
+class AnimationKeyFrameValues final {
+ public:
+  /*
+   * Removes all values keeping the allocated capacity.
+   */
+  void clear() noexcept;
+
+  /*
+   * Appends a pair of start and end frames with the eased progress of the
+   * animation. Returns an index of the appended values.
+   */
+  size_t append(Rect const &start, Rect const &end, Float progress) noexcept;
+
+  /*
+   * Computes interpolated frames for all appended values.
+   */
+  void interpolate() noexcept;
+
+  /*
+   * Returns an interpolated frame at a given index.
+   * Must be called after `interpolate`.
+   */
+  Rect getFrame(size_t index) const noexcept;
+
+  /*
+   * Returns the eased progress stored at a given index.
+   */
+  Float getProgress(size_t index) const noexcept;
+
+  size_t size() const noexcept;
+
+ private:
+  std::vector<Float> progress_;
+
+  std::vector<Float> startX_;
+  std::vector<Float> startY_;
+  std::vector<Float> startWidth_;
+  std::vector<Float> startHeight_;
+
+  std::vector<Float> endX_;
+  std::vector<Float> endY_;
+  std::vector<Float> endWidth_;
+  std::vector<Float> endHeight_;
+
+  std::vector<Float> x_;
+  std::vector<Float> y_;
+  std::vector<Float> width_;
+  std::vector<Float> height_;
+};
+
+} // namespace react
+} // namespace facebook
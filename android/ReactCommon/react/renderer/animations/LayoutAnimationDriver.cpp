@@ -123,6 +123,12 @@ void LayoutAnimationDriver::animationMutationsForFrame(
     SurfaceId surfaceId,
     ShadowViewMutation::List &mutationsList,
     uint64_t now) const {
+  // Layout metrics of all animated views are gathered into contiguous arrays
+  // first, interpolated in a single pass, and only then turned into
+  // ShadowViews.
+  keyFrameValues_.clear();
+  std::vector<AnimationKeyFrame const *> animatedKeyFrames{};
+
   for (auto &animation : inflightAnimations_) {
     if (animation.surfaceId != surfaceId) {
       continue;
@@ -131,6 +137,11 @@ void LayoutAnimationDriver::animationMutationsForFrame(
       continue;
     }
 
+    // The progress only depends on the configuration, which is shared by all
+    // keyframes of the same type; compute it once per type.
+    auto const layoutAnimationConfig = animation.layoutAnimationConfig;
+    better::optional<std::pair<double, double>> progressByType[3]{};
+
     int incompleteAnimations = 0;
     for (const auto &keyframe : animation.keyFrames) {
       if (keyframe.type == AnimationConfigurationType::Noop) {
@@ -140,33 +151,31 @@ void LayoutAnimationDriver::animationMutationsForFrame(
         continue;
       }
 
-      auto const &baselineShadowView = keyframe.viewStart;
-      auto const &finalShadowView = keyframe.viewEnd;
-
       // The contract with the "keyframes generation" phase is that any animated
       // node will have a valid configuration.
-      auto const layoutAnimationConfig = animation.layoutAnimationConfig;
-      auto const mutationConfig =
+      auto typeIndex = keyframe.type == AnimationConfigurationType::Delete
+          ? 0
+          : (keyframe.type == AnimationConfigurationType::Create ? 1 : 2);
+      auto const &mutationConfig =
           (keyframe.type == AnimationConfigurationType::Delete
                ? layoutAnimationConfig.deleteConfig
                : (keyframe.type == AnimationConfigurationType::Create
                       ? layoutAnimationConfig.createConfig
                       : layoutAnimationConfig.updateConfig));
 
-      // Interpolate
-      std::pair<double, double> progress =
-          calculateAnimationProgress(now, animation, *mutationConfig);
+      if (!progressByType[typeIndex]) {
+        progressByType[typeIndex] =
+            calculateAnimationProgress(now, animation, *mutationConfig);
+      }
+      std::pair<double, double> progress = *progressByType[typeIndex];
       double animationTimeProgressLinear = progress.first;
       double animationInterpolationFactor = progress.second;
 
-      auto mutatedShadowView = createInterpolatedShadowView(
-          animationInterpolationFactor, baselineShadowView, finalShadowView);
-
-      // Create the mutation instruction
-      auto updateMutation = ShadowViewMutation::UpdateMutation(
-          keyframe.parentView, baselineShadowView, mutatedShadowView, -1);
-      mutationsList.push_back(updateMutation);
-      PrintMutationInstruction("Animation Progress:", updateMutation);
+      keyFrameValues_.append(
+          keyframe.viewStart.layoutMetrics.frame,
+          keyframe.viewEnd.layoutMetrics.frame,
+          animationInterpolationFactor);
+      animatedKeyFrames.push_back(&keyframe);
 
       if (animationTimeProgressLinear < 1) {
         incompleteAnimations++;
@@ -179,6 +188,29 @@ void LayoutAnimationDriver::animationMutationsForFrame(
     }
   }
 
+  // Interpolate
+  keyFrameValues_.interpolate();
+
+  mutationsList.reserve(mutationsList.size() + animatedKeyFrames.size());
+  for (size_t i = 0; i < animatedKeyFrames.size(); i++) {
+    auto const &keyframe = *animatedKeyFrames[i];
+    auto const &baselineShadowView = keyframe.viewStart;
+    auto const &finalShadowView = keyframe.viewEnd;
+
+    auto mutatedShadowView = createInterpolatedShadowView(
+        keyFrameValues_.getProgress(i),
+        baselineShadowView,
+        finalShadowView,
+        keyFrameValues_.getFrame(i),
+        &keyframe.propsCache);
+
+    // Create the mutation instruction
+    auto updateMutation = ShadowViewMutation::UpdateMutation(
+        keyframe.parentView, baselineShadowView, mutatedShadowView, -1);
+    mutationsList.push_back(updateMutation);
+    PrintMutationInstruction("Animation Progress:", updateMutation);
+  }
+
   // Clear out finished animations
   for (auto it = inflightAnimations_.begin();
        it != inflightAnimations_.end();) {
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <unordered_map>
 
 #include <react/renderer/componentregistry/ComponentDescriptorFactory.h>
 #include <react/renderer/components/root/RootShadowNode.h>
@@ -636,6 +637,40 @@ LayoutAnimationKeyFrameManager::getAndEraseConflictingAnimations(
   std::vector<std::tuple<AnimationKeyFrame, AnimationConfig, LayoutAnimation *>>
       conflictingAnimations{};
 
+  // Index keyframes of the surface by their own tag and by the tag of their
+  // parent, so every mutation is matched with a lookup instead of a scan of
+  // all in-flight keyframes. A location is an (animation, keyframe) index
+  // pair; the order of locations matches the order of a linear scan.
+  using KeyFrameLocation = std::pair<size_t, size_t>;
+  std::unordered_map<Tag, std::vector<KeyFrameLocation>> keyFramesByTag{};
+  std::unordered_map<Tag, std::vector<KeyFrameLocation>> keyFramesByParentTag{};
+
+  for (size_t i = 0; i < inflightAnimations_.size(); i++) {
+    auto const &inflightAnimation = inflightAnimations_[i];
+    if (inflightAnimation.surfaceId != surfaceId) {
+      continue;
+    }
+    if (inflightAnimation.completed) {
+      continue;
+    }
+
+    for (size_t j = 0; j < inflightAnimation.keyFrames.size(); j++) {
+      auto const &keyFrame = inflightAnimation.keyFrames[j];
+      if (keyFrame.invalidated) {
+        continue;
+      }
+      keyFramesByTag[keyFrame.tag].push_back({i, j});
+      keyFramesByParentTag[keyFrame.parentView.tag].push_back({i, j});
+    }
+  }
+
+  if (keyFramesByTag.empty()) {
+    return conflictingAnimations;
+  }
+
+  std::vector<KeyFrameLocation> candidates{};
+  auto hasErasedKeyFrames = false;
+
   for (auto &mutation : mutations) {
     if (deletesOnly && mutation.type != ShadowViewMutation::Type::Delete) {
       continue;
@@ -648,76 +683,90 @@ LayoutAnimationKeyFrameManager::getAndEraseConflictingAnimations(
         ? mutation.newChildShadowView
         : mutation.oldChildShadowView;
 
-    for (auto &inflightAnimation : inflightAnimations_) {
-      if (inflightAnimation.surfaceId != surfaceId) {
-        continue;
-      }
-      if (inflightAnimation.completed) {
-        continue;
+    // Conflicting animation detected: if we're mutating a tag under
+    // animation, or deleting the parent of a tag under animation, or
+    // reparenting.
+    candidates.clear();
+    auto byTag = keyFramesByTag.find(baselineShadowView.tag);
+    if (byTag != keyFramesByTag.end()) {
+      candidates.insert(
+          candidates.end(), byTag->second.begin(), byTag->second.end());
+    }
+    if (mutation.type == ShadowViewMutation::Type::Delete ||
+        mutation.type == ShadowViewMutation::Type::Create) {
+      auto byParentTag = keyFramesByParentTag.find(baselineShadowView.tag);
+      if (byParentTag != keyFramesByParentTag.end()) {
+        candidates.insert(
+            candidates.end(),
+            byParentTag->second.begin(),
+            byParentTag->second.end());
       }
+      std::sort(candidates.begin(), candidates.end());
+    }
 
-      for (auto it = inflightAnimation.keyFrames.begin();
-           it != inflightAnimation.keyFrames.end();) {
-        auto &animatedKeyFrame = *it;
+    for (auto const &location : candidates) {
+      auto &inflightAnimation = inflightAnimations_[location.first];
+      auto &animatedKeyFrame = inflightAnimation.keyFrames[location.second];
 
-        if (animatedKeyFrame.invalidated) {
-          continue;
-        }
+      // Already matched by a previous mutation (or by both indices).
+      if (animatedKeyFrame.invalidated) {
+        continue;
+      }
 
-        bool conflicting = animatedKeyFrame.tag == baselineShadowView.tag ||
-            ((mutation.type == ShadowViewMutation::Type::Delete ||
-              mutation.type == ShadowViewMutation::Type::Create) &&
-             animatedKeyFrame.parentView.tag == baselineShadowView.tag) /* ||
-             finalMutationTag == baselineShadowView.tag*/
-            ;
-
-        // Conflicting animation detected: if we're mutating a tag under
-        // animation, or deleting the parent of a tag under animation, or
-        // reparenting.
-        if (conflicting) {
-          auto const layoutAnimationConfig =
-              inflightAnimation.layoutAnimationConfig;
-
-          auto const mutationConfig =
-              (animatedKeyFrame.type == AnimationConfigurationType::Delete
-                   ? layoutAnimationConfig.deleteConfig
-                   : (animatedKeyFrame.type ==
-                              AnimationConfigurationType::Create
-                          ? layoutAnimationConfig.createConfig
-                          : layoutAnimationConfig.updateConfig));
-
-          animatedKeyFrame.invalidated = true;
-
-          // We construct a list of all conflicting animations, whether or not
-          // they have a "final mutation" to execute. This is important with,
-          // for example, "insert" mutations where the final update needs to set
-          // opacity to "1", even if there's no final ShadowNode update.
-          if (!(animatedKeyFrame.finalMutationForKeyFrame.has_value() &&
-                mutatedViewIsVirtual(
-                    *animatedKeyFrame.finalMutationForKeyFrame))) {
-            conflictingAnimations.push_back(std::make_tuple(
-                animatedKeyFrame, *mutationConfig, &inflightAnimation));
-          }
+      auto const layoutAnimationConfig =
+          inflightAnimation.layoutAnimationConfig;
+
+      auto const mutationConfig =
+          (animatedKeyFrame.type == AnimationConfigurationType::Delete
+               ? layoutAnimationConfig.deleteConfig
+               : (animatedKeyFrame.type == AnimationConfigurationType::Create
+                      ? layoutAnimationConfig.createConfig
+                      : layoutAnimationConfig.updateConfig));
+
+      // Marked here and deleted from the existing animation below (erasing
+      // right away would invalidate the indices).
+      animatedKeyFrame.invalidated = true;
+      hasErasedKeyFrames = true;
+
+      // We construct a list of all conflicting animations, whether or not
+      // they have a "final mutation" to execute. This is important with,
+      // for example, "insert" mutations where the final update needs to set
+      // opacity to "1", even if there's no final ShadowNode update.
+      if (!(animatedKeyFrame.finalMutationForKeyFrame.has_value() &&
+            mutatedViewIsVirtual(*animatedKeyFrame.finalMutationForKeyFrame))) {
+        conflictingAnimations.push_back(std::make_tuple(
+            animatedKeyFrame, *mutationConfig, &inflightAnimation));
+      }
 
 #ifdef LAYOUT_ANIMATION_VERBOSE_LOGGING
-          if (animatedKeyFrame.finalMutationForKeyFrame.has_value()) {
-            PrintMutationInstructionRelative(
-                "Found mutation that conflicts with existing in-flight animation:",
-                mutation,
-                *animatedKeyFrame.finalMutationForKeyFrame);
-          } else {
-            PrintMutationInstruction(
-                "Found mutation that conflicts with existing in-flight animation (no final mutation):",
-                mutation);
-          }
+      if (animatedKeyFrame.finalMutationForKeyFrame.has_value()) {
+        PrintMutationInstructionRelative(
+            "Found mutation that conflicts with existing in-flight animation:",
+            mutation,
+            *animatedKeyFrame.finalMutationForKeyFrame);
+      } else {
+        PrintMutationInstruction(
+            "Found mutation that conflicts with existing in-flight animation (no final mutation):",
+            mutation);
+      }
 #endif
+    }
+  }
 
-          // Delete from existing animation
-          it = inflightAnimation.keyFrames.erase(it);
-        } else {
-          it++;
-        }
+  if (hasErasedKeyFrames) {
+    for (auto &inflightAnimation : inflightAnimations_) {
+      if (inflightAnimation.surfaceId != surfaceId) {
+        continue;
       }
+      auto &keyFrames = inflightAnimation.keyFrames;
+      keyFrames.erase(
+          std::remove_if(
+              keyFrames.begin(),
+              keyFrames.end(),
+              [](AnimationKeyFrame const &keyFrame) {
+                return keyFrame.invalidated;
+              }),
+          keyFrames.end());
     }
   }
 
@@ -1552,6 +1601,29 @@ ShadowView LayoutAnimationKeyFrameManager::createInterpolatedShadowView(
     double progress,
     ShadowView startingView,
     ShadowView finalView) const {
+  // Interpolate LayoutMetrics
+  Rect const &finalFrame = finalView.layoutMetrics.frame;
+  Rect const &baselineFrame = startingView.layoutMetrics.frame;
+  Rect interpolatedFrame;
+  interpolatedFrame.origin.x =
+      interpolateFloats(progress, baselineFrame.origin.x, finalFrame.origin.x);
+  interpolatedFrame.origin.y =
+      interpolateFloats(progress, baselineFrame.origin.y, finalFrame.origin.y);
+  interpolatedFrame.size.width = interpolateFloats(
+      progress, baselineFrame.size.width, finalFrame.size.width);
+  interpolatedFrame.size.height = interpolateFloats(
+      progress, baselineFrame.size.height, finalFrame.size.height);
+
+  return createInterpolatedShadowView(
+      progress, startingView, finalView, interpolatedFrame);
+}
+
+ShadowView LayoutAnimationKeyFrameManager::createInterpolatedShadowView(
+    double progress,
+    ShadowView const &startingView,
+    ShadowView const &finalView,
+    Rect const &frame,
+    AnimatedPropsCache *propsCache) const {
   if (!hasComponentDescriptorForShadowView(startingView)) {
     return finalView;
   }
@@ -1564,34 +1636,79 @@ ShadowView LayoutAnimationKeyFrameManager::createInterpolatedShadowView(
   }
 
   // Animate opacity or scale/transform
-  mutatedShadowView.props = componentDescriptor.interpolateProps(
-      progress, startingView.props, finalView.props);
-
-  // Interpolate LayoutMetrics
-  LayoutMetrics const &finalLayoutMetrics = finalView.layoutMetrics;
-  LayoutMetrics const &baselineLayoutMetrics = startingView.layoutMetrics;
-  LayoutMetrics interpolatedLayoutMetrics = finalLayoutMetrics;
-  interpolatedLayoutMetrics.frame.origin.x = interpolateFloats(
-      progress,
-      baselineLayoutMetrics.frame.origin.x,
-      finalLayoutMetrics.frame.origin.x);
-  interpolatedLayoutMetrics.frame.origin.y = interpolateFloats(
-      progress,
-      baselineLayoutMetrics.frame.origin.y,
-      finalLayoutMetrics.frame.origin.y);
-  interpolatedLayoutMetrics.frame.size.width = interpolateFloats(
-      progress,
-      baselineLayoutMetrics.frame.size.width,
-      finalLayoutMetrics.frame.size.width);
-  interpolatedLayoutMetrics.frame.size.height = interpolateFloats(
+  mutatedShadowView.props = interpolateAnimatedProps(
+      componentDescriptor,
       progress,
-      baselineLayoutMetrics.frame.size.height,
-      finalLayoutMetrics.frame.size.height);
+      startingView.props,
+      finalView.props,
+      propsCache);
+
+  LayoutMetrics interpolatedLayoutMetrics = finalView.layoutMetrics;
+  interpolatedLayoutMetrics.frame = frame;
   mutatedShadowView.layoutMetrics = interpolatedLayoutMetrics;
 
   return mutatedShadowView;
 }
 
+static bool areTransformOperationsEqual(
+    std::vector<TransformOperation> const &lhs,
+    std::vector<TransformOperation> const &rhs) {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < lhs.size(); i++) {
+    if (lhs[i].type != rhs[i].type || lhs[i].x != rhs[i].x ||
+        lhs[i].y != rhs[i].y || lhs[i].z != rhs[i].z) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Interpolates opacity and transform. When neither of them differs between
+ * `startingProps` and `finalProps` (the common case for layout-only updates,
+ * such as list reorders), skips interpolating them. Like `interpolateProps`,
+ * it returns a copy of `finalProps` then, which is made once per `propsCache`
+ * instead of on every frame.
+ */
+SharedProps LayoutAnimationKeyFrameManager::interpolateAnimatedProps(
+    ComponentDescriptor const &componentDescriptor,
+    double progress,
+    SharedProps const &startingProps,
+    SharedProps const &finalProps,
+    AnimatedPropsCache *propsCache) const {
+  auto copyFinalProps = [&]() {
+    if (propsCache == nullptr) {
+      return componentDescriptor.cloneProps(finalProps, {});
+    }
+    if (propsCache->finalProps != finalProps) {
+      propsCache->finalProps = finalProps;
+      propsCache->copy = componentDescriptor.cloneProps(finalProps, {});
+    }
+    return propsCache->copy;
+  };
+
+  if (startingProps == finalProps) {
+    return copyFinalProps();
+  }
+
+  auto startingViewProps =
+      dynamic_cast<ViewProps const *>(startingProps.get());
+  auto finalViewProps = dynamic_cast<ViewProps const *>(finalProps.get());
+  if (startingViewProps != nullptr && finalViewProps != nullptr &&
+      startingViewProps->opacity == finalViewProps->opacity &&
+      startingViewProps->transform == finalViewProps->transform &&
+      areTransformOperationsEqual(
+          startingViewProps->transform.operations,
+          finalViewProps->transform.operations)) {
+    return copyFinalProps();
+  }
+
+  return componentDescriptor.interpolateProps(
+      progress, startingProps, finalProps);
+}
+
 void LayoutAnimationKeyFrameManager::callCallback(
     const LayoutAnimationCallbackWrapper &callback) const {
   if (callback.readyForCleanup()) {
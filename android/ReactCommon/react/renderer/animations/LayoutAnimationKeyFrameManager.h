@@ -25,6 +25,8 @@
 #include <react/renderer/uimanager/LayoutAnimationStatusDelegate.h>
 #include <react/renderer/uimanager/UIManagerAnimationDelegate.h>
 
+#include "AnimationKeyFrameValues.h"
+
 namespace facebook {
 namespace react {
 
@@ -86,6 +88,17 @@ struct LayoutAnimationConfig {
   better::optional<AnimationConfig> deleteConfig;
 };
 
+/*
+ * Copy of the final props of a keyframe, for frames which don't interpolate
+ * props (see `interpolateAnimatedProps`). The copy is the same on every frame,
+ * so it's made once and reused. The props it was copied from are kept to tell
+ * if it's still a copy of the final props.
+ */
+struct AnimatedPropsCache {
+  SharedProps finalProps{};
+  SharedProps copy{};
+};
+
 struct AnimationKeyFrame {
   // The mutation that should be executed once the animation completes
   // (optional).
@@ -108,6 +121,10 @@ struct AnimationKeyFrame {
   double initialProgress;
 
   bool invalidated{false};
+
+  // Filled in while the animation runs, which doesn't otherwise change the
+  // keyframe.
+  mutable AnimatedPropsCache propsCache{};
 };
 
 class LayoutAnimationCallbackWrapper {
@@ -220,16 +237,16 @@ class LayoutAnimationKeyFrameManager : public UIManagerAnimationDelegate,
       ShadowViewMutation const &mutation,
       bool skipLastAnimation = false) const;
 
+  mutable std::mutex surfaceIdsToStopMutex_;
+  mutable std::vector<SurfaceId> surfaceIdsToStop_{};
+
+ protected:
   std::vector<std::tuple<AnimationKeyFrame, AnimationConfig, LayoutAnimation *>>
   getAndEraseConflictingAnimations(
       SurfaceId surfaceId,
       ShadowViewMutationList &mutations,
       bool deletesOnly = false) const;
 
-  mutable std::mutex surfaceIdsToStopMutex_;
-  mutable std::vector<SurfaceId> surfaceIdsToStop_{};
-
- protected:
   bool mutatedViewIsVirtual(ShadowViewMutation const &mutation) const;
 
   bool hasComponentDescriptorForShadowView(ShadowView const &shadowView) const;
@@ -245,6 +262,24 @@ class LayoutAnimationKeyFrameManager : public UIManagerAnimationDelegate,
       ShadowView startingView,
       ShadowView finalView) const;
 
+  /*
+   * Same as `createInterpolatedShadowView` but uses an already interpolated
+   * `frame` instead of interpolating layout metrics one by one.
+   */
+  ShadowView createInterpolatedShadowView(
+      double progress,
+      ShadowView const &startingView,
+      ShadowView const &finalView,
+      Rect const &frame,
+      AnimatedPropsCache *propsCache = nullptr) const;
+
+  SharedProps interpolateAnimatedProps(
+      ComponentDescriptor const &componentDescriptor,
+      double progress,
+      SharedProps const &startingProps,
+      SharedProps const &finalProps,
+      AnimatedPropsCache *propsCache = nullptr) const;
+
   void callCallback(const LayoutAnimationCallbackWrapper &callback) const;
 
   virtual void animationMutationsForFrame(
@@ -269,6 +304,12 @@ class LayoutAnimationKeyFrameManager : public UIManagerAnimationDelegate,
    */
   mutable std::vector<LayoutAnimation> inflightAnimations_{};
 
+  /*
+   * Per-frame scratch storage, reused across frames. Follows the same
+   * threading contract as `inflightAnimations_`.
+   */
+  mutable AnimationKeyFrameValues keyFrameValues_{};
+
  private:
   // A vector of callable function wrappers that are in the process of being
   // called
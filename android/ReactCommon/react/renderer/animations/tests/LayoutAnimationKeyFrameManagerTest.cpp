@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <react/renderer/animations/LayoutAnimationDriver.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Exposes the internals of `LayoutAnimationKeyFrameManager` under test.
+ */
+class TestLayoutAnimationDriver : public LayoutAnimationDriver {
+ public:
+  TestLayoutAnimationDriver() : LayoutAnimationDriver({}, nullptr) {}
+
+  using LayoutAnimationKeyFrameManager::getAndEraseConflictingAnimations;
+  using LayoutAnimationKeyFrameManager::inflightAnimations_;
+  using LayoutAnimationKeyFrameManager::interpolateAnimatedProps;
+};
+
+static ShadowView shadowView(Tag tag) {
+  auto view = ShadowView{};
+  view.tag = tag;
+  return view;
+}
+
+static AnimationKeyFrame keyFrame(
+    Tag tag,
+    Tag parentTag,
+    AnimationConfigurationType type = AnimationConfigurationType::Update) {
+  auto keyFrame = AnimationKeyFrame{};
+  keyFrame.type = type;
+  keyFrame.tag = tag;
+  keyFrame.parentView = shadowView(parentTag);
+  keyFrame.viewStart = shadowView(tag);
+  keyFrame.viewEnd = shadowView(tag);
+  keyFrame.initialProgress = 0;
+  return keyFrame;
+}
+
+/*
+ * An animation whose create, update and delete configs can be told apart by
+ * their durations.
+ */
+static LayoutAnimation animation(
+    SurfaceId surfaceId,
+    std::vector<AnimationKeyFrame> keyFrames) {
+  auto config = [](double duration) {
+    auto config = AnimationConfig{};
+    config.duration = duration;
+    return config;
+  };
+
+  auto animation = LayoutAnimation{};
+  animation.surfaceId = surfaceId;
+  animation.startTime = 0;
+  animation.layoutAnimationConfig = LayoutAnimationConfig{
+      300, config(100), config(200), config(300)};
+  animation.keyFrames = std::move(keyFrames);
+  return animation;
+}
+
+static std::vector<Tag> tagsOf(
+    std::vector<AnimationKeyFrame> const &keyFrames) {
+  auto tags = std::vector<Tag>{};
+  for (auto const &keyFrame : keyFrames) {
+    tags.push_back(keyFrame.tag);
+  }
+  return tags;
+}
+
+static std::vector<Tag> tagsOf(
+    std::vector<
+        std::tuple<AnimationKeyFrame, AnimationConfig, LayoutAnimation *>> const
+        &conflictingAnimations) {
+  auto tags = std::vector<Tag>{};
+  for (auto const &conflictingAnimation : conflictingAnimations) {
+    tags.push_back(std::get<0>(conflictingAnimation).tag);
+  }
+  return tags;
+}
+
+TEST(LayoutAnimationKeyFrameManagerTest, testUpdateConflictsWithItsOwnTag) {
+  TestLayoutAnimationDriver driver;
+  auto &inflightAnimations = driver.inflightAnimations_;
+  inflightAnimations.push_back(
+      animation(1, {keyFrame(10, 1), keyFrame(11, 1), keyFrame(12, 11)}));
+
+  auto mutations = ShadowViewMutationList{ShadowViewMutation::UpdateMutation(
+      shadowView(1), shadowView(11), shadowView(11), 1)};
+  auto conflictingAnimations =
+      driver.getAndEraseConflictingAnimations(1, mutations);
+
+  ASSERT_EQ(conflictingAnimations.size(), 1);
+  EXPECT_EQ(std::get<0>(conflictingAnimations[0]).tag, 11);
+  EXPECT_EQ(std::get<1>(conflictingAnimations[0]).duration, 200);
+  EXPECT_EQ(std::get<2>(conflictingAnimations[0]), &inflightAnimations[0]);
+
+  // Children of the updated view keep animating.
+  EXPECT_EQ(
+      tagsOf(inflightAnimations[0].keyFrames), (std::vector<Tag>{10, 12}));
+}
+
+TEST(LayoutAnimationKeyFrameManagerTest, testDeleteConflictsWithItsChildren) {
+  TestLayoutAnimationDriver driver;
+  auto &inflightAnimations = driver.inflightAnimations_;
+  inflightAnimations.push_back(animation(
+      1,
+      {keyFrame(12, 11, AnimationConfigurationType::Create),
+       keyFrame(10, 1),
+       keyFrame(11, 1, AnimationConfigurationType::Delete)}));
+  inflightAnimations.push_back(animation(1, {keyFrame(13, 11)}));
+
+  auto mutations = ShadowViewMutationList{
+      ShadowViewMutation::DeleteMutation(shadowView(11))};
+  auto conflictingAnimations =
+      driver.getAndEraseConflictingAnimations(1, mutations);
+
+  // Conflicts are reported in the order keyframes are stored in, and with
+  // the config of their type.
+  EXPECT_EQ(tagsOf(conflictingAnimations), (std::vector<Tag>{12, 11, 13}));
+  EXPECT_EQ(std::get<1>(conflictingAnimations[0]).duration, 100);
+  EXPECT_EQ(std::get<1>(conflictingAnimations[1]).duration, 300);
+  EXPECT_EQ(std::get<2>(conflictingAnimations[2]), &inflightAnimations[1]);
+
+  EXPECT_EQ(tagsOf(inflightAnimations[0].keyFrames), (std::vector<Tag>{10}));
+  EXPECT_TRUE(inflightAnimations[1].keyFrames.empty());
+}
+
+TEST(LayoutAnimationKeyFrameManagerTest, testKeyFramesConflictOnce) {
+  TestLayoutAnimationDriver driver;
+  auto &inflightAnimations = driver.inflightAnimations_;
+  inflightAnimations.push_back(animation(1, {keyFrame(11, 1)}));
+
+  // The keyframe is matched by its tag in both mutations.
+  auto mutations = ShadowViewMutationList{
+      ShadowViewMutation::RemoveMutation(shadowView(1), shadowView(11), 0),
+      ShadowViewMutation::DeleteMutation(shadowView(11))};
+  auto conflictingAnimations =
+      driver.getAndEraseConflictingAnimations(1, mutations);
+
+  EXPECT_EQ(tagsOf(conflictingAnimations), (std::vector<Tag>{11}));
+  EXPECT_TRUE(inflightAnimations[0].keyFrames.empty());
+}
+
+TEST(LayoutAnimationKeyFrameManagerTest, testOtherAnimationsDoNotConflict) {
+  TestLayoutAnimationDriver driver;
+  auto &inflightAnimations = driver.inflightAnimations_;
+  inflightAnimations.push_back(animation(2, {keyFrame(11, 1)}));
+  inflightAnimations.push_back(animation(1, {keyFrame(11, 1)}));
+  inflightAnimations[1].completed = true;
+  inflightAnimations.push_back(animation(1, {keyFrame(11, 1)}));
+
+  auto mutations = ShadowViewMutationList{ShadowViewMutation::UpdateMutation(
+      shadowView(1), shadowView(11), shadowView(11), 0)};
+
+  // Only deletes are considered.
+  EXPECT_TRUE(
+      driver.getAndEraseConflictingAnimations(1, mutations, true).empty());
+
+  // Animations of other surfaces and completed ones are left alone.
+  auto conflictingAnimations =
+      driver.getAndEraseConflictingAnimations(1, mutations);
+  ASSERT_EQ(conflictingAnimations.size(), 1);
+  EXPECT_EQ(std::get<2>(conflictingAnimations[0]), &inflightAnimations[2]);
+  EXPECT_EQ(inflightAnimations[0].keyFrames.size(), 1);
+  EXPECT_EQ(inflightAnimations[1].keyFrames.size(), 1);
+  EXPECT_TRUE(inflightAnimations[2].keyFrames.empty());
+}
+
+TEST(LayoutAnimationKeyFrameManagerTest, testAnimatedPropsAreAlwaysCopies) {
+  TestLayoutAnimationDriver driver;
+  auto eventDispatcher = std::shared_ptr<EventDispatcher const>();
+  ViewComponentDescriptor descriptor{
+      ComponentDescriptorParameters{eventDispatcher, nullptr, nullptr}};
+
+  auto transparentProps = descriptor.cloneProps(
+      nullptr, RawProps(folly::dynamic::object("opacity", 0.0)));
+  auto opaqueProps = descriptor.cloneProps(
+      nullptr, RawProps(folly::dynamic::object("opacity", 1.0)));
+  auto otherOpaqueProps = descriptor.cloneProps(
+      nullptr, RawProps(folly::dynamic::object("opacity", 1.0)));
+
+  auto opacityOf = [](SharedProps const &props) {
+    return std::static_pointer_cast<ViewProps const>(props)->opacity;
+  };
+
+  auto interpolatedProps = driver.interpolateAnimatedProps(
+      descriptor, 0.5, transparentProps, opaqueProps);
+  EXPECT_EQ(opacityOf(interpolatedProps), 0.5);
+
+  // Props which don't change are copied without being interpolated.
+  interpolatedProps = driver.interpolateAnimatedProps(
+      descriptor, 0.5, opaqueProps, opaqueProps);
+  EXPECT_NE(interpolatedProps, opaqueProps);
+  EXPECT_EQ(opacityOf(interpolatedProps), 1);
+
+  interpolatedProps = driver.interpolateAnimatedProps(
+      descriptor, 0.5, opaqueProps, otherOpaqueProps);
+  EXPECT_NE(interpolatedProps, otherOpaqueProps);
+  EXPECT_EQ(opacityOf(interpolatedProps), 1);
+}
+
+TEST(LayoutAnimationKeyFrameManagerTest, testAnimatedPropsCopiesAreReused) {
+  TestLayoutAnimationDriver driver;
+  auto eventDispatcher = std::shared_ptr<EventDispatcher const>();
+  ViewComponentDescriptor descriptor{
+      ComponentDescriptorParameters{eventDispatcher, nullptr, nullptr}};
+
+  auto transparentProps = descriptor.cloneProps(
+      nullptr, RawProps(folly::dynamic::object("opacity", 0.0)));
+  auto opaqueProps = descriptor.cloneProps(
+      nullptr, RawProps(folly::dynamic::object("opacity", 1.0)));
+  auto otherOpaqueProps = descriptor.cloneProps(
+      nullptr, RawProps(folly::dynamic::object("opacity", 1.0)));
+
+  // The copy is made on the first frame only.
+  auto propsCache = AnimatedPropsCache{};
+  auto firstFrameProps = driver.interpolateAnimatedProps(
+      descriptor, 0.25, opaqueProps, otherOpaqueProps, &propsCache);
+  auto secondFrameProps = driver.interpolateAnimatedProps(
+      descriptor, 0.5, opaqueProps, otherOpaqueProps, &propsCache);
+  EXPECT_NE(firstFrameProps, otherOpaqueProps);
+  EXPECT_EQ(secondFrameProps, firstFrameProps);
+
+  // A copy of other props is made again.
+  auto propsOfOtherFinalProps = driver.interpolateAnimatedProps(
+      descriptor, 0.5, opaqueProps, opaqueProps, &propsCache);
+  EXPECT_NE(propsOfOtherFinalProps, firstFrameProps);
+  EXPECT_NE(propsOfOtherFinalProps, opaqueProps);
+
+  // Props which are interpolated are not cached.
+  auto interpolatedProps = driver.interpolateAnimatedProps(
+      descriptor, 0.5, transparentProps, opaqueProps, &propsCache);
+  EXPECT_NE(interpolatedProps, propsOfOtherFinalProps);
+  EXPECT_EQ(
+      std::static_pointer_cast<ViewProps const>(interpolatedProps)->opacity,
+      0.5);
+}
+
+} // namespace react
+} // namespace facebook
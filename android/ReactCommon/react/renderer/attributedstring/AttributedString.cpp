@@ -22,7 +22,8 @@ std::string Fragment::AttachmentCharacter() {
 }
 
 bool Fragment::isAttachment() const {
-  return string == AttachmentCharacter();
+  static auto const attachmentCharacter = InternedString{AttachmentCharacter()};
+  return string == attachmentCharacter;
 }
 
 bool Fragment::operator==(const Fragment &rhs) const {
@@ -93,7 +94,7 @@ Fragments &AttributedString::getFragments() {
 std::string AttributedString::getString() const {
   auto string = std::string{};
   for (const auto &fragment : fragments_) {
-    string += fragment.string;
+    string += fragment.string.str();
   }
   return string;
 }
@@ -138,7 +139,7 @@ SharedDebugStringConvertibleList AttributedString::getDebugChildren() const {
 
     list.push_back(std::make_shared<DebugStringConvertibleItem>(
         "Fragment",
-        fragment.string,
+        fragment.string.str(),
         SharedDebugStringConvertibleList(),
         propsList));
   }
@@ -12,6 +12,7 @@
 
 #include <folly/Hash.h>
 #include <folly/Optional.h>
+#include <react/renderer/attributedstring/InternedString.h>
 #include <react/renderer/attributedstring/TextAttributes.h>
 #include <react/renderer/core/Sealable.h>
 #include <react/renderer/core/ShadowNode.h>
@@ -37,7 +38,11 @@ class AttributedString : public Sealable, public DebugStringConvertible {
    public:
     static std::string AttachmentCharacter();
 
-    std::string string;
+    /*
+     * Interned, so that copying fragments does not copy strings and comparing
+     * and hashing them do not depend on their length.
+     */
+    InternedString string;
     TextAttributes textAttributes;
     ShadowView parentShadowView;
 
@@ -20,6 +20,11 @@ AttributedStringBox::AttributedStringBox(AttributedString const &value)
       value_(std::make_shared<AttributedString const>(value)),
       opaquePointer_({}){};
 
+AttributedStringBox::AttributedStringBox(AttributedString &&value)
+    : mode_(Mode::Value),
+      value_(std::make_shared<AttributedString const>(std::move(value))),
+      opaquePointer_({}){};
+
 AttributedStringBox::AttributedStringBox(
     std::shared_ptr<void> const &opaquePointer)
     : mode_(Mode::OpaquePointer), value_({}), opaquePointer_(opaquePointer) {}
@@ -35,6 +35,7 @@ class AttributedStringBox final {
    * Custom explicit constructors.
    */
   explicit AttributedStringBox(AttributedString const &value);
+  explicit AttributedStringBox(AttributedString &&value);
   explicit AttributedStringBox(std::shared_ptr<void> const &opaquePointer);
 
   /*
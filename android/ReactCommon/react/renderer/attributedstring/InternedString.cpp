@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "InternedString.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace facebook {
+namespace react {
+
+using Storage = InternedString::Storage;
+
+namespace {
+
+/*
+ * Table of all storages which are alive, keyed by the hash of their content.
+ * A storage removes itself from the table when its last `InternedString`
+ * goes away.
+ */
+class InternTable final {
+ public:
+  std::shared_ptr<Storage const> intern(std::string &&string) {
+    auto hash = std::hash<std::string>{}(string);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto range = entries_.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second.storage->string != string) {
+        continue;
+      }
+      // An entry can be expired if the last owner of the storage is being
+      // destroyed right now (and waits for the lock to remove the entry).
+      if (auto storage = it->second.weakStorage.lock()) {
+        return storage;
+      }
+    }
+
+    auto storage = std::shared_ptr<Storage const>(
+        new Storage{std::move(string), hash}, [this](Storage const *storage) {
+          release(storage);
+        });
+    entries_.emplace(hash, Entry{storage.get(), storage});
+    return storage;
+  }
+
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+  }
+
+ private:
+  struct Entry {
+    Storage const *storage;
+    std::weak_ptr<Storage const> weakStorage;
+  };
+
+  void release(Storage const *storage) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto range = entries_.equal_range(storage->hash);
+      for (auto it = range.first; it != range.second; ++it) {
+        if (it->second.storage == storage) {
+          entries_.erase(it);
+          break;
+        }
+      }
+    }
+    delete storage;
+  }
+
+  mutable std::mutex mutex_;
+  std::unordered_multimap<size_t, Entry> entries_;
+};
+
+InternTable &internTable() {
+  // Leaked intentionally: strings can outlive static destructors.
+  static auto &table = *new InternTable{};
+  return table;
+}
+
+std::shared_ptr<Storage const> const &emptyStorage() {
+  static auto const &storage = *new std::shared_ptr<Storage const>(
+      std::make_shared<Storage const>(
+          Storage{std::string{}, std::hash<std::string>{}(std::string{})}));
+  return storage;
+}
+
+} // namespace
+
+InternedString::InternedString() : storage_(emptyStorage()) {}
+
+InternedString::InternedString(std::string const &string)
+    : InternedString(std::string{string}) {}
+
+InternedString::InternedString(std::string &&string)
+    : storage_(
+          string.empty() ? emptyStorage()
+                         : internTable().intern(std::move(string))) {}
+
+InternedString::InternedString(char const *string)
+    : InternedString(std::string{string}) {}
+
+size_t InternedString::getInternedCount() {
+  return internTable().size();
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Immutable string whose storage is shared by all `InternedString`s with the
+ * same content (as long as any of them is alive). The hash of the content is
+ * computed once, when the storage is created.
+ * That makes copying, hashing and comparing `InternedString`s constant-time
+ * operations (equal strings have the same storage), at the cost of a lookup in
+ * a global table when one is constructed from a `std::string`.
+ */
+class InternedString final {
+ public:
+  /*
+   * Constructs an empty string (which does not need a lookup).
+   */
+  InternedString();
+
+  /*
+   * Implicit, so that `InternedString` can be assigned from strings.
+   */
+  InternedString(std::string const &string);
+  InternedString(std::string &&string);
+  InternedString(char const *string);
+
+  std::string const &str() const {
+    return storage_->string;
+  }
+
+  operator std::string const &() const {
+    return storage_->string;
+  }
+
+  char const *c_str() const {
+    return storage_->string.c_str();
+  }
+
+  size_t size() const {
+    return storage_->string.size();
+  }
+
+  bool empty() const {
+    return storage_->string.empty();
+  }
+
+  size_t hash() const {
+    return storage_->hash;
+  }
+
+  bool operator==(InternedString const &rhs) const {
+    return storage_ == rhs.storage_;
+  }
+
+  bool operator!=(InternedString const &rhs) const {
+    return storage_ != rhs.storage_;
+  }
+
+  /*
+   * Comparisons with other strings compare content and do not intern
+   * anything.
+   */
+  bool operator==(std::string const &rhs) const {
+    return storage_->string == rhs;
+  }
+
+  bool operator!=(std::string const &rhs) const {
+    return storage_->string != rhs;
+  }
+
+  bool operator==(char const *rhs) const {
+    return storage_->string == rhs;
+  }
+
+  bool operator!=(char const *rhs) const {
+    return storage_->string != rhs;
+  }
+
+  /*
+   * Number of distinct strings which are currently interned.
+   * For debugging and testing purposes.
+   */
+  static size_t getInternedCount();
+
+  struct Storage {
+    std::string string;
+    size_t hash;
+  };
+
+ private:
+  std::shared_ptr<Storage const> storage_;
+};
+
+} // namespace react
+} // namespace facebook
+
+namespace std {
+template <>
+struct hash<facebook::react::InternedString> {
+  size_t operator()(facebook::react::InternedString const &string) const {
+    return string.hash();
+  }
+};
+} // namespace std
@@ -780,7 +780,7 @@ inline folly::dynamic toDynamic(const AttributedString &attributedString) {
   auto fragments = folly::dynamic::array();
   for (auto fragment : attributedString.getFragments()) {
     folly::dynamic dynamicFragment = folly::dynamic::object();
-    dynamicFragment["string"] = fragment.string;
+    dynamicFragment["string"] = fragment.string.str();
     if (fragment.parentShadowView.componentHandle) {
       dynamicFragment["reactTag"] = fragment.parentShadowView.tag;
     }
@@ -36,7 +36,7 @@ TEST(AttributedStringTest, testToDynamic) {
   attString->prependFragment(*fragment);
 
   auto result = toDynamic(*attString);
-  assert(result["string"] == fragment->string);
+  assert(result["string"] == fragment->string.str());
   auto textAttribute = result["fragments"][0]["textAttributes"];
   assert(textAttribute["foregroundColor"] == toDynamic(text->foregroundColor));
   assert(textAttribute["opacity"] == text->opacity);
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <react/renderer/attributedstring/InternedString.h>
+
+namespace facebook {
+namespace react {
+
+TEST(InternedStringTest, testEqualStringsShareStorage) {
+  auto content = std::string{"Hello, world"};
+  auto first = InternedString{content};
+  auto second = InternedString{std::string{"Hello, "} + "world"};
+  auto third = InternedString{"Hello"};
+
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(first.c_str(), second.c_str());
+  EXPECT_EQ(first.hash(), second.hash());
+  EXPECT_EQ(first.hash(), std::hash<std::string>{}(content));
+  EXPECT_NE(first, third);
+
+  EXPECT_TRUE(first == content);
+  EXPECT_TRUE(first == "Hello, world");
+  EXPECT_TRUE(third != content);
+  EXPECT_EQ(first.str(), content);
+  EXPECT_EQ(first.size(), content.size());
+}
+
+TEST(InternedStringTest, testEmptyString) {
+  auto empty = InternedString{};
+
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty, InternedString{""});
+  EXPECT_EQ(empty, InternedString{std::string{}});
+  EXPECT_EQ(empty.hash(), std::hash<std::string>{}(""));
+}
+
+TEST(InternedStringTest, testStorageIsReleased) {
+  auto count = InternedString::getInternedCount();
+  {
+    auto string = InternedString{"testStorageIsReleased"};
+    auto copy = string;
+    EXPECT_EQ(InternedString::getInternedCount(), count + 1);
+  }
+  EXPECT_EQ(InternedString::getInternedCount(), count);
+
+  // A string can be interned again after its storage was released.
+  auto string = InternedString{"testStorageIsReleased"};
+  EXPECT_EQ(string, "testStorageIsReleased");
+  EXPECT_EQ(InternedString::getInternedCount(), count + 1);
+}
+
+TEST(InternedStringTest, testConcurrentInterning) {
+  auto count = InternedString::getInternedCount();
+  auto reference = InternedString{"testConcurrentInterning 0"};
+
+  auto threads = std::vector<std::thread>{};
+  for (auto i = 0; i < 4; i++) {
+    threads.emplace_back([&reference]() {
+      for (auto j = 0; j < 1000; j++) {
+        auto string = InternedString{
+            "testConcurrentInterning " + std::to_string(j % 10)};
+        if (j % 10 == 0) {
+          EXPECT_EQ(string, reference);
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(InternedString::getInternedCount(), count + 1);
+}
+
+} // namespace react
+} // namespace facebook
@@ -10,6 +10,8 @@
 #include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
 #include <react/renderer/core/ShadowNodeFragment.h>
 
+#include <stdexcept>
+
 namespace facebook {
 namespace react {
 
@@ -18,6 +20,19 @@ ComponentDescriptorRegistry::ComponentDescriptorRegistry(
     ComponentDescriptorProviderRegistry const &providerRegistry)
     : parameters_(parameters), providerRegistry_(providerRegistry) {}
 
+ComponentDescriptorRegistry::~ComponentDescriptorRegistry() {
+  for (auto &chunkPointer : internedComponentChunks_) {
+    auto chunk = chunkPointer.load(std::memory_order_relaxed);
+    if (chunk == nullptr) {
+      break;
+    }
+    for (auto &internedComponent : *chunk) {
+      delete internedComponent.load(std::memory_order_relaxed);
+    }
+    delete chunk;
+  }
+}
+
 void ComponentDescriptorRegistry::add(
     ComponentDescriptorProvider componentDescriptorProvider) const {
   std::unique_lock<better::shared_mutex> lock(mutex_);
@@ -53,11 +68,9 @@ static std::string componentNameByReactViewName(std::string viewName) {
   // We need this function only for the transition period;
   // eventually, all names will be unified.
 
-  std::string rctPrefix("RCT");
-  if (std::mismatch(rctPrefix.begin(), rctPrefix.end(), viewName.begin())
-          .first == rctPrefix.end()) {
+  if (viewName.compare(0, 3, "RCT") == 0) {
     // If `viewName` has "RCT" prefix, remove it.
-    viewName.erase(0, rctPrefix.length());
+    viewName.erase(0, 3);
   }
 
   // Fabric uses slightly new names for Text components because of differences
@@ -176,6 +189,85 @@ bool ComponentDescriptorRegistry::hasComponentDescriptorAt(
   return true;
 }
 
+InternedComponentHandle ComponentDescriptorRegistry::internComponentName(
+    std::string const &viewName) const {
+  {
+    std::lock_guard<std::mutex> lock(internMutex_);
+    auto iterator = internedComponentHandles_.find(viewName);
+    if (iterator != internedComponentHandles_.end()) {
+      return iterator->second;
+    }
+  }
+
+  // Resolving may call `providerRegistry_.request`, which registers
+  // components synchronously; it must not run under `internMutex_`.
+  auto const &componentDescriptor = at(viewName);
+  auto sharedComponentDescriptor = SharedComponentDescriptor{};
+  {
+    std::shared_lock<better::shared_mutex> lock(mutex_);
+    auto iterator =
+        _registryByName.find(componentNameByReactViewName(viewName));
+    if (iterator != _registryByName.end() &&
+        iterator->second.get() == &componentDescriptor) {
+      sharedComponentDescriptor = iterator->second;
+    }
+  }
+  auto isFallback = !sharedComponentDescriptor ||
+      sharedComponentDescriptor == _fallbackComponentDescriptor;
+  if (isFallback) {
+    sharedComponentDescriptor = _fallbackComponentDescriptor;
+  }
+
+  std::lock_guard<std::mutex> lock(internMutex_);
+  auto iterator = internedComponentHandles_.find(viewName);
+  if (iterator != internedComponentHandles_.end()) {
+    // Another thread has interned the same name meanwhile.
+    return iterator->second;
+  }
+
+  auto internedComponentHandle =
+      static_cast<InternedComponentHandle>(internedComponentHandles_.size());
+  auto chunkIndex = internedComponentHandle / kInternedComponentChunkSize;
+  if (chunkIndex >= kInternedComponentChunkCount) {
+    throw std::length_error("Too many distinct view names were interned");
+  }
+
+  auto chunk = internedComponentChunks_[chunkIndex].load(
+      std::memory_order_relaxed);
+  if (chunk == nullptr) {
+    chunk = new InternedComponentChunk{};
+    internedComponentChunks_[chunkIndex].store(
+        chunk, std::memory_order_release);
+  }
+  (*chunk)[internedComponentHandle % kInternedComponentChunkSize].store(
+      new InternedComponent{viewName, sharedComponentDescriptor, isFallback},
+      std::memory_order_release);
+
+  internedComponentHandles_[viewName] = internedComponentHandle;
+  return internedComponentHandle;
+}
+
+InternedComponent const *ComponentDescriptorRegistry::findInternedComponent(
+    InternedComponentHandle internedComponentHandle) const {
+  if (internedComponentHandle < 0) {
+    return nullptr;
+  }
+
+  auto chunkIndex = internedComponentHandle / kInternedComponentChunkSize;
+  if (chunkIndex >= kInternedComponentChunkCount) {
+    return nullptr;
+  }
+
+  auto chunk =
+      internedComponentChunks_[chunkIndex].load(std::memory_order_acquire);
+  if (chunk == nullptr) {
+    return nullptr;
+  }
+
+  return (*chunk)[internedComponentHandle % kInternedComponentChunkSize].load(
+      std::memory_order_acquire);
+}
+
 SharedShadowNode ComponentDescriptorRegistry::createNode(
     Tag tag,
     std::string const &viewName,
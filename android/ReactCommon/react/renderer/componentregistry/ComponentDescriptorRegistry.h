@@ -7,7 +7,10 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 #include <better/map.h>
 #include <better/mutex.h>
@@ -24,6 +27,33 @@ class ComponentDescriptorRegistry;
 using SharedComponentDescriptorRegistry =
     std::shared_ptr<const ComponentDescriptorRegistry>;
 
+/*
+ * A small dense number which stands for a view name resolved by
+ * `ComponentDescriptorRegistry::internComponentName`. It stays valid for the
+ * lifetime of the registry, so JavaScript can resolve a name once and pass
+ * the number afterwards.
+ */
+using InternedComponentHandle = int32_t;
+
+/*
+ * Result of resolving a view name.
+ */
+struct InternedComponent {
+  /*
+   * A view name as it was passed by JavaScript.
+   */
+  std::string viewName;
+
+  SharedComponentDescriptor componentDescriptor;
+
+  /*
+   * `true` if there was no component descriptor for the name at the time of
+   * interning and `componentDescriptor` is the fallback one. Such names are
+   * still resolved by name, so a component registered later is picked up.
+   */
+  bool isFallback;
+};
+
 /*
  * Registry of particular `ComponentDescriptor`s.
  */
@@ -39,6 +69,8 @@ class ComponentDescriptorRegistry {
       ComponentDescriptorParameters const &parameters,
       ComponentDescriptorProviderRegistry const &providerRegistry);
 
+  ~ComponentDescriptorRegistry();
+
   /*
    * This is broken. Please do not use.
    * If you requesting a ComponentDescriptor and unsure that it's there, you are
@@ -53,6 +85,23 @@ class ComponentDescriptorRegistry {
 
   bool hasComponentDescriptorAt(ComponentHandle componentHandle) const;
 
+  /*
+   * Resolves a view name (the same way `at(std::string const &)` does) and
+   * returns a handle which can be used with `findInternedComponent`.
+   * Interning the same name again returns the same handle.
+   * Thread safe.
+   */
+  InternedComponentHandle internComponentName(
+      std::string const &viewName) const;
+
+  /*
+   * Returns an interned component by a handle returned from
+   * `internComponentName`. Does not lock; can be called on any thread.
+   * Returns `nullptr` for an unknown handle.
+   */
+  InternedComponent const *findInternedComponent(
+      InternedComponentHandle internedComponentHandle) const;
+
   ShadowNode::Shared createNode(
       Tag tag,
       std::string const &viewName,
@@ -78,6 +127,26 @@ class ComponentDescriptorRegistry {
    */
   void add(ComponentDescriptorProvider componentDescriptorProvider) const;
 
+  /*
+   * Interned components are stored in fixed-size chunks which are never
+   * moved or freed before the registry, so `findInternedComponent` can read
+   * them without locking.
+   */
+  static constexpr int kInternedComponentChunkSize = 64;
+  static constexpr int kInternedComponentChunkCount = 64;
+
+  using InternedComponentChunk = std::array<
+      std::atomic<InternedComponent const *>,
+      kInternedComponentChunkSize>;
+
+  mutable std::mutex internMutex_;
+  mutable better::map<std::string, InternedComponentHandle>
+      internedComponentHandles_;
+  mutable std::array<
+      std::atomic<InternedComponentChunk *>,
+      kInternedComponentChunkCount>
+      internedComponentChunks_{};
+
   mutable better::shared_mutex mutex_;
   mutable better::map<ComponentHandle, SharedComponentDescriptor>
       _registryByHandle;
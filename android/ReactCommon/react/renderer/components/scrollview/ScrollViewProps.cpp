@@ -169,7 +169,12 @@ ScrollViewProps::ScrollViewProps(
           rawProps,
           "scrollToOverflowEnabled",
           sourceProps.scrollToOverflowEnabled,
-          {})) {}
+          {})),
+      cullingOverscan(convertRawProp(
+          rawProps,
+          "cullingOverscan",
+          sourceProps.cullingOverscan,
+          {-1})) {}
 
 #pragma mark - DebugStringConvertible
 
@@ -284,7 +289,11 @@ SharedDebugStringConvertibleList ScrollViewProps::getDebugProps() const {
           debugStringConvertibleItem(
               "snapToStart", snapToStart, defaultScrollViewProps.snapToStart),
           debugStringConvertibleItem(
-              "snapToEnd", snapToEnd, defaultScrollViewProps.snapToEnd)};
+              "snapToEnd", snapToEnd, defaultScrollViewProps.snapToEnd),
+          debugStringConvertibleItem(
+              "cullingOverscan",
+              cullingOverscan,
+              defaultScrollViewProps.cullingOverscan)};
 }
 #endif
 
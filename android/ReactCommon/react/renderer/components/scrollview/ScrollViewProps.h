@@ -55,6 +55,18 @@ class ScrollViewProps final : public ViewProps {
       ContentInsetAdjustmentBehavior::Never};
   bool scrollToOverflowEnabled{false};
 
+  /*
+   * Distance (in points) beyond the visible area in which content is
+   * mounted. Views of the content container's children which are further
+   * away from the visible area are not mounted. Negative values (default)
+   * disable the culling.
+   * Note: No platform accepts this prop yet (it's neither in the JS view
+   * config nor registered by the native scroll view managers), so it's
+   * filtered out before it gets here and the culling can't be enabled from
+   * JS for now.
+   */
+  Float cullingOverscan{-1};
+
 #pragma mark - DebugStringConvertible
 
 #if RN_DEBUG_STRING_CONVERTIBLE
@@ -9,6 +9,9 @@
 
 #include <react/renderer/core/LayoutMetrics.h>
 
+#include <algorithm>
+#include <cmath>
+
 namespace facebook {
 namespace react {
 
@@ -42,5 +45,27 @@ Point ScrollViewShadowNode::getContentOriginOffset() const {
   return {-contentOffset.x, -contentOffset.y};
 }
 
+better::optional<Rect> ScrollViewShadowNode::getContentCullingRect() const {
+  auto overscan = getConcreteProps().cullingOverscan;
+  if (overscan < 0) {
+    return {};
+  }
+
+  // The visible area extended by the overscan is snapped outwards to a grid
+  // of half the overscan, so the rect (and therefore the set of mounted
+  // views) changes every few scroll events instead of on every one of them.
+  auto step = std::max(overscan / 2, Float{1});
+  auto contentOffset = getStateData().contentOffset;
+  auto size = getLayoutMetrics().frame.size;
+
+  auto minX = std::floor((contentOffset.x - overscan) / step) * step;
+  auto minY = std::floor((contentOffset.y - overscan) / step) * step;
+  auto maxX =
+      std::ceil((contentOffset.x + size.width + overscan) / step) * step;
+  auto maxY =
+      std::ceil((contentOffset.y + size.height + overscan) / step) * step;
+  return Rect{{minX, minY}, {maxX - minX, maxY - minY}};
+}
+
 } // namespace react
 } // namespace facebook
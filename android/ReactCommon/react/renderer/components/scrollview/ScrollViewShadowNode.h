@@ -29,10 +29,17 @@ class ScrollViewShadowNode final : public ConcreteViewShadowNode<
  public:
   using ConcreteViewShadowNode::ConcreteViewShadowNode;
 
+  static ShadowNodeTraits BaseTraits() {
+    auto traits = ConcreteViewShadowNode::BaseTraits();
+    traits.set(ShadowNodeTraits::Trait::CullsContent);
+    return traits;
+  }
+
 #pragma mark - LayoutableShadowNode
 
   void layout(LayoutContext layoutContext) override;
   Point getContentOriginOffset() const override;
+  better::optional<Rect> getContentCullingRect() const override;
 
  private:
   void updateStateIfNeeded();
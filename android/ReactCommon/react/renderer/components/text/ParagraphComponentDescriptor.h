@@ -43,6 +43,32 @@ class ParagraphComponentDescriptor final
     return interpolatedPropsShared;
   };
 
+  void prepareLayout(
+      ShadowNode const &parentShadowNode,
+      ShadowNode::Shared const &shadowNode,
+      LayoutContext const &layoutContext,
+      BackgroundExecutor const &backgroundExecutor) const override {
+    assert(dynamic_cast<ParagraphShadowNode const *>(shadowNode.get()));
+    auto &paragraphShadowNode =
+        static_cast<ParagraphShadowNode const &>(*shadowNode);
+
+    auto key = paragraphShadowNode.guessNextMeasurement(
+        parentShadowNode, layoutContext);
+    if (!key) {
+      return;
+    }
+
+    // The result lands in the measure cache of `TextLayoutManager`, where
+    // the next layout pass will most likely find it.
+    backgroundExecutor(
+        [textLayoutManager = textLayoutManager_, key = std::move(*key)]() {
+          textLayoutManager->premeasure(
+              key.attributedString,
+              key.paragraphAttributes,
+              key.layoutConstraints);
+        });
+  }
+
  protected:
   void adopt(UnsharedShadowNode shadowNode) const override {
     ConcreteComponentDescriptor::adopt(shadowNode);
@@ -55,8 +81,6 @@ class ParagraphComponentDescriptor final
     // and communicate text rendering metrics to mounting layer.
     paragraphShadowNode->setTextLayoutManager(textLayoutManager_);
 
-    paragraphShadowNode->dirtyLayout();
-
     // All `ParagraphShadowNode`s must have leaf Yoga nodes with properly
     // setup measure function.
     paragraphShadowNode->enableMeasurement();
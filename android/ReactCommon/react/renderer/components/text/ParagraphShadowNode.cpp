@@ -11,6 +11,7 @@
 
 #include <react/renderer/attributedstring/AttributedStringBox.h>
 #include <react/renderer/components/view/ViewShadowNode.h>
+#include <react/renderer/components/view/YogaStylableProps.h>
 #include <react/renderer/components/view/conversions.h>
 #include <react/renderer/graphics/rounding.h>
 #include <react/renderer/mounting/TransactionTelemetry.h>
@@ -24,27 +25,46 @@ using Content = ParagraphShadowNode::Content;
 
 char const ParagraphComponentName[] = "Paragraph";
 
-Content const &ParagraphShadowNode::getContent(
-    LayoutContext const &layoutContext) const {
-  if (content_.has_value()) {
-    return content_.value();
+ParagraphShadowNode::ParagraphShadowNode(
+    ShadowNode const &sourceShadowNode,
+    ShadowNodeFragment const &fragment)
+    : ConcreteViewShadowNode(sourceShadowNode, fragment) {
+  // The content of the node depends only on its props and children. A clone
+  // which has neither of them new (e.g. a clone made by Yoga during layout)
+  // keeps the measurements cached by the Yoga node.
+  if (fragment.props || fragment.children) {
+    dirtyLayout();
   }
+}
 
-  ensureUnsealed();
-
+Content ParagraphShadowNode::buildContent(
+    LayoutContext const &layoutContext,
+    LayoutDirection layoutDirection) const {
   auto textAttributes = TextAttributes::defaultTextAttributes();
   textAttributes.fontSizeMultiplier = layoutContext.fontSizeMultiplier;
   textAttributes.apply(getConcreteProps().textAttributes);
-  textAttributes.layoutDirection =
-      YGNodeLayoutGetDirection(&yogaNode_) == YGDirectionRTL
-      ? LayoutDirection::RightToLeft
-      : LayoutDirection::LeftToRight;
+  textAttributes.layoutDirection = layoutDirection;
   auto attributedString = AttributedString{};
   auto attachments = Attachments{};
   buildAttributedString(textAttributes, *this, attributedString, attachments);
 
-  content_ = Content{
+  return Content{
       attributedString, getConcreteProps().paragraphAttributes, attachments};
+}
+
+Content const &ParagraphShadowNode::getContent(
+    LayoutContext const &layoutContext) const {
+  if (content_.has_value()) {
+    return content_.value();
+  }
+
+  ensureUnsealed();
+
+  content_ = buildContent(
+      layoutContext,
+      YGNodeLayoutGetDirection(&yogaNode_) == YGDirectionRTL
+          ? LayoutDirection::RightToLeft
+          : LayoutDirection::LeftToRight);
 
   return content_.value();
 }
@@ -91,6 +111,74 @@ Content ParagraphShadowNode::getContentWithMeasuredAttachments(
   return content;
 }
 
+better::optional<TextMeasureCacheKey> ParagraphShadowNode::guessNextMeasurement(
+    ShadowNode const &parentShadowNode,
+    LayoutContext const &layoutContext) const {
+  if (content_.has_value()) {
+    // The node was laid out already (e.g. it is an unchanged node appended to
+    // a clone of its parent), so it was measured already as well.
+    return {};
+  }
+
+  auto layoutMetrics = getLayoutMetrics();
+  auto width = Float{0};
+  auto layoutDirection = layoutMetrics.layoutDirection;
+
+  if (layoutMetrics != EmptyLayoutMetrics) {
+    // The node is a clone of a laid out node; most likely, it will keep
+    // the width of its content.
+    width = layoutMetrics.getContentFrame().size.width;
+  } else {
+    // A new node will most likely stretch across the content box of its
+    // parent, if the parent lays out its children in a column.
+    auto parentLayoutableShadowNode =
+        traitCast<LayoutableShadowNode const *>(&parentShadowNode);
+    auto parentProps = std::dynamic_pointer_cast<YogaStylableProps const>(
+        parentShadowNode.getProps());
+    if (!parentLayoutableShadowNode || !parentProps ||
+        parentProps->yogaStyle.flexDirection() != YGFlexDirectionColumn) {
+      return {};
+    }
+
+    auto parentLayoutMetrics = parentLayoutableShadowNode->getLayoutMetrics();
+    if (parentLayoutMetrics == EmptyLayoutMetrics) {
+      return {};
+    }
+
+    auto parentWidth = parentLayoutMetrics.getContentFrame().size.width;
+    width = parentWidth -
+        yogaNode_.getMarginForAxis(YGFlexDirectionRow, parentWidth).unwrap() -
+        yogaNode_.getLeadingPaddingAndBorder(YGFlexDirectionRow, parentWidth)
+            .unwrap() -
+        yogaNode_.getTrailingPaddingAndBorder(YGFlexDirectionRow, parentWidth)
+            .unwrap();
+    layoutDirection = parentLayoutMetrics.layoutDirection;
+  }
+
+  if (!(width > 0)) {
+    return {};
+  }
+
+  auto content = buildContent(
+      layoutContext,
+      layoutDirection == LayoutDirection::RightToLeft
+          ? LayoutDirection::RightToLeft
+          : LayoutDirection::LeftToRight);
+
+  if (content.attributedString.isEmpty() || !content.attachments.empty()) {
+    // Measuring attachments requires laying them out.
+    return {};
+  }
+
+  auto layoutConstraints = LayoutConstraints{};
+  layoutConstraints.maximumSize.width = width;
+  layoutConstraints.layoutDirection = layoutDirection;
+
+  return TextMeasureCacheKey{std::move(content.attributedString),
+                             std::move(content.paragraphAttributes),
+                             layoutConstraints};
+}
+
 void ParagraphShadowNode::setTextLayoutManager(
     SharedTextLayoutManager textLayoutManager) {
   ensureUnsealed();
@@ -125,7 +213,7 @@ Size ParagraphShadowNode::measureContent(
   auto content =
       getContentWithMeasuredAttachments(layoutContext, layoutConstraints);
 
-  auto attributedString = content.attributedString;
+  auto &attributedString = content.attributedString;
   if (attributedString.isEmpty()) {
     // Note: `zero-width space` is insufficient in some cases (e.g. when we need
     // to measure the "height" of the font).
@@ -140,15 +228,19 @@ Size ParagraphShadowNode::measureContent(
 
   auto telemetry = TransactionTelemetry::threadLocalTelemetry();
   if (telemetry) {
-    telemetry->didMeasureText();
+    telemetry->willMeasureText();
+  }
+
+  auto measurement = textLayoutManager_->measure(
+      AttributedStringBox{std::move(attributedString)},
+      content.paragraphAttributes,
+      layoutConstraints);
+
+  if (telemetry) {
+    telemetry->didMeasureText(measurement.wasPremeasured);
   }
 
-  return textLayoutManager_
-      ->measure(
-          AttributedStringBox{attributedString},
-          content.paragraphAttributes,
-          layoutConstraints)
-      .size;
+  return measurement.size;
 }
 
 void ParagraphShadowNode::layout(LayoutContext layoutContext) {
@@ -170,10 +262,12 @@ void ParagraphShadowNode::layout(LayoutContext layoutContext) {
       layoutConstraints);
 
   if (getConcreteProps().onTextLayout) {
+    // Lines are cached alongside the measurement above, and the event emitter
+    // does not dispatch lines identical to the previous ones.
     auto linesMeasurements = textLayoutManager_->measureLines(
         content.attributedString,
         content.paragraphAttributes,
-        measurement.size);
+        layoutConstraints);
     getConcreteEventEmitter().onTextLayout(linesMeasurements);
   }
 
@@ -37,6 +37,10 @@ class ParagraphShadowNode : public ConcreteViewShadowNode<
  public:
   using ConcreteViewShadowNode::ConcreteViewShadowNode;
 
+  ParagraphShadowNode(
+      ShadowNode const &sourceShadowNode,
+      ShadowNodeFragment const &fragment);
+
   static ShadowNodeTraits BaseTraits() {
     auto traits = ConcreteViewShadowNode::BaseTraits();
     traits.set(ShadowNodeTraits::Trait::LeafYogaNode);
@@ -58,6 +62,18 @@ class ParagraphShadowNode : public ConcreteViewShadowNode<
    */
   void setTextLayoutManager(SharedTextLayoutManager textLayoutManager);
 
+  /*
+   * Guesses the content and the layout constraints the node will be measured
+   * with during the next layout, so that the measurement can be made ahead of
+   * time. The width constraint is taken from previous layouts of the node or
+   * of `parentShadowNode` (the node it was appended to).
+   * Returns nothing if the node does not need to be measured again or the
+   * guess is not possible.
+   */
+  better::optional<TextMeasureCacheKey> guessNextMeasurement(
+      ShadowNode const &parentShadowNode,
+      LayoutContext const &layoutContext) const;
+
 #pragma mark - LayoutableShadowNode
 
   void layout(LayoutContext layoutContext) override;
@@ -77,6 +93,13 @@ class ParagraphShadowNode : public ConcreteViewShadowNode<
   };
 
  private:
+  /*
+   * Builds and returns a `Content` object for given layout direction.
+   */
+  Content buildContent(
+      LayoutContext const &layoutContext,
+      LayoutDirection layoutDirection) const;
+
   /*
    * Builds (if needed) and returns a reference to a `Content` object.
    */
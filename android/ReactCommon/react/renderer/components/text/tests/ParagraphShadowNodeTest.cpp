@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/text/ParagraphComponentDescriptor.h>
+#include <react/renderer/components/text/RawTextComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+
+namespace facebook {
+namespace react {
+
+static ComponentBuilder paragraphComponentBuilder() {
+  ComponentDescriptorProviderRegistry componentDescriptorProviderRegistry{};
+  auto eventDispatcher = EventDispatcher::Shared{};
+  auto componentDescriptorRegistry =
+      componentDescriptorProviderRegistry.createComponentDescriptorRegistry(
+          ComponentDescriptorParameters{eventDispatcher, nullptr, nullptr});
+
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<ParagraphComponentDescriptor>());
+  componentDescriptorProviderRegistry.add(
+      concreteComponentDescriptorProvider<RawTextComponentDescriptor>());
+
+  return ComponentBuilder{componentDescriptorRegistry};
+}
+
+static LayoutMetrics layoutMetricsWithWidth(
+    Float width,
+    Float horizontalInset = 0) {
+  auto layoutMetrics = LayoutMetrics{};
+  layoutMetrics.frame.size = Size{width, 100};
+  layoutMetrics.contentInsets.left = horizontalInset;
+  layoutMetrics.contentInsets.right = horizontalInset;
+  return layoutMetrics;
+}
+
+class ParagraphShadowNodeTest : public ::testing::Test {
+ protected:
+  /*
+   * Builds a view with a paragraph in it. The paragraph shows `text` (if
+   * any). Layout metrics of the nodes are set to given ones.
+   */
+  void build(
+      better::optional<std::string> text,
+      LayoutMetrics const &viewLayoutMetrics,
+      LayoutMetrics const &paragraphLayoutMetrics = EmptyLayoutMetrics,
+      YGFlexDirection flexDirection = YGFlexDirectionColumn) {
+    auto children = std::vector<ElementFragment>{};
+    if (text) {
+      children.push_back(Element<RawTextShadowNode>().props([=] {
+        auto props = std::make_shared<RawTextProps>();
+        props->text = *text;
+        return props;
+      }));
+    }
+
+    // clang-format off
+    auto element =
+        Element<ViewShadowNode>()
+          .reference(viewShadowNode_)
+          .props([=] {
+            auto props = std::make_shared<ViewProps>();
+            props->yogaStyle.flexDirection() = flexDirection;
+            return props;
+          })
+          .finalize([=](ViewShadowNode &shadowNode) {
+            shadowNode.setLayoutMetrics(viewLayoutMetrics);
+          })
+          .children({
+            Element<ParagraphShadowNode>()
+              .reference(paragraphShadowNode_)
+              .finalize([=](ParagraphShadowNode &shadowNode) {
+                shadowNode.setLayoutMetrics(paragraphLayoutMetrics);
+              })
+              .children(children)
+          });
+    // clang-format on
+
+    builder_.build(element);
+  }
+
+  better::optional<TextMeasureCacheKey> guessNextMeasurement() {
+    return paragraphShadowNode_->guessNextMeasurement(
+        *viewShadowNode_, LayoutContext{});
+  }
+
+  ComponentBuilder builder_{paragraphComponentBuilder()};
+  std::shared_ptr<ViewShadowNode> viewShadowNode_;
+  std::shared_ptr<ParagraphShadowNode> paragraphShadowNode_;
+};
+
+TEST_F(ParagraphShadowNodeTest, testNewParagraphTakesContentWidthOfParent) {
+  build(std::string{"Hello"}, layoutMetricsWithWidth(300, 10));
+
+  auto key = guessNextMeasurement();
+  ASSERT_TRUE(key.has_value());
+  EXPECT_EQ(key->attributedString.getString(), "Hello");
+  EXPECT_EQ(key->layoutConstraints.maximumSize.width, 280);
+  EXPECT_EQ(
+      key->layoutConstraints.layoutDirection, LayoutDirection::LeftToRight);
+}
+
+TEST_F(ParagraphShadowNodeTest, testClonedParagraphKeepsItsContentWidth) {
+  build(
+      std::string{"Hello"},
+      layoutMetricsWithWidth(300, 10),
+      layoutMetricsWithWidth(150, 5));
+
+  auto key = guessNextMeasurement();
+  ASSERT_TRUE(key.has_value());
+  EXPECT_EQ(key->attributedString.getString(), "Hello");
+  EXPECT_EQ(key->layoutConstraints.maximumSize.width, 140);
+}
+
+TEST_F(ParagraphShadowNodeTest, testNothingIsGuessedWithoutAWidth) {
+  // The parent was not laid out.
+  build(std::string{"Hello"}, EmptyLayoutMetrics);
+  EXPECT_FALSE(guessNextMeasurement().has_value());
+
+  // The parent lays out its children in a row.
+  build(
+      std::string{"Hello"},
+      layoutMetricsWithWidth(300),
+      EmptyLayoutMetrics,
+      YGFlexDirectionRow);
+  EXPECT_FALSE(guessNextMeasurement().has_value());
+
+  // The parent has no room for the paragraph.
+  build(std::string{"Hello"}, layoutMetricsWithWidth(20, 10));
+  EXPECT_FALSE(guessNextMeasurement().has_value());
+}
+
+TEST_F(ParagraphShadowNodeTest, testEmptyParagraphsAreNotMeasured) {
+  build({}, layoutMetricsWithWidth(300));
+  EXPECT_FALSE(guessNextMeasurement().has_value());
+}
+
+} // namespace react
+} // namespace facebook
@@ -102,7 +102,8 @@ void YogaLayoutableShadowNode::dirtyLayout() {
 }
 
 bool YogaLayoutableShadowNode::getIsLayoutClean() const {
-  return !yogaNode_.isDirty();
+  // A dirty relayout boundary in the subtree still has to be laid out.
+  return !yogaNode_.isDirty() && !yogaNode_.hasDirtyRelayoutBoundary();
 }
 
 #pragma mark - Mutating Methods
@@ -239,24 +240,48 @@ void YogaLayoutableShadowNode::updateYogaChildren() {
   auto oldYogaChildren = isClean ? yogaNode_.getChildren() : YGVector{};
   yogaNode_.setChildren({});
 
+  auto hasDirtyRelayoutBoundary = false;
+
   for (size_t i = 0; i < getChildren().size(); i++) {
     appendYogaChild(*getChildren().at(i));
     adoptYogaChild(i);
 
+    auto &newChildNode =
+        traitCast<YogaLayoutableShadowNode const &>(*getChildren().at(i));
+    auto &newYogaChildNode = newChildNode.yogaNode_;
+
+    // A dirty relayout boundary (see `YGNode::isRelayoutBoundary`) keeps its
+    // size, so Yoga lays it out separately without dirtying this node.
+    // That only holds if it is a new revision of the node which was laid out
+    // at the same index.
+    auto isDirtyRelayoutBoundary = isClean && newYogaChildNode.isDirty() &&
+        newYogaChildNode.isRelayoutBoundary() &&
+        ShadowNode::sameFamily(
+            newChildNode,
+            *static_cast<YogaLayoutableShadowNode const *>(
+                oldYogaChildren[i]->getContext()));
+
+    hasDirtyRelayoutBoundary = hasDirtyRelayoutBoundary ||
+        isDirtyRelayoutBoundary || newYogaChildNode.hasDirtyRelayoutBoundary();
+
     if (isClean) {
       auto &oldYogaChildNode = *oldYogaChildren[i];
-      auto &newYogaChildNode =
-          traitCast<YogaLayoutableShadowNode const &>(*getChildren().at(i))
-              .yogaNode_;
 
-      isClean = isClean && !newYogaChildNode.isDirty() &&
+      isClean = isClean &&
+          (!newYogaChildNode.isDirty() || isDirtyRelayoutBoundary) &&
           (newYogaChildNode.getStyle() == oldYogaChildNode.getStyle());
     }
   }
 
   assert(getChildren().size() == yogaNode_.getChildren().size());
 
+  if (hasDirtyRelayoutBoundary && yogaNode_.isBaselineLayout()) {
+    // Baselines depend on the content of children, not only on their sizes.
+    isClean = false;
+  }
+
   yogaNode_.setDirty(!isClean);
+  yogaNode_.setHasDirtyRelayoutBoundary(hasDirtyRelayoutBoundary);
 }
 
 void YogaLayoutableShadowNode::updateYogaProps() {
@@ -519,6 +544,11 @@ YGConfig &YogaLayoutableShadowNode::initializeYogaConfig(YGConfig &config) {
   config.setCloneNodeCallback(
       YogaLayoutableShadowNode::yogaNodeCloneCallbackConnector);
   config.useLegacyStretchBehaviour = true;
+  config.useRelayoutBoundaries = true;
+  // Text nodes are often measured under many different constraints (e.g.
+  // inside of wrapping rows), a larger cache saves `measureContent` calls.
+  config.maxCachedMeasurements = 16;
+  config.measurementCacheReplacement = YGMeasurementCacheReplacement::LeastHit;
 #ifdef RN_DEBUG_YOGA_LOGGER
   config.printTree = true;
   config.setLogger(&YogaLog);
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+
+namespace facebook {
+namespace react {
+
+static SharedViewProps viewProps(
+    YGValue width,
+    YGValue height,
+    YGFlexDirection flexDirection = YGFlexDirectionColumn) {
+  auto sharedProps = std::make_shared<ViewProps>();
+  auto &yogaStyle = sharedProps->yogaStyle;
+  yogaStyle.dimensions()[YGDimensionWidth] = width;
+  yogaStyle.dimensions()[YGDimensionHeight] = height;
+  yogaStyle.flexDirection() = flexDirection;
+  return sharedProps;
+}
+
+/*
+ * <Root>
+ *   <A> (100x100, a relayout boundary)
+ *     <AA/> (auto height)
+ *   </A>
+ *   <B/> (auto height)
+ * </Root>
+ */
+class RelayoutBoundaryTest : public ::testing::Test {
+ protected:
+  ComponentBuilder builder_;
+  std::shared_ptr<RootShadowNode> rootShadowNode_;
+  std::shared_ptr<ViewShadowNode> viewShadowNodeA_;
+  std::shared_ptr<ViewShadowNode> viewShadowNodeAA_;
+  std::shared_ptr<ViewShadowNode> viewShadowNodeB_;
+
+  RelayoutBoundaryTest() : builder_(simpleComponentBuilder()) {
+    // clang-format off
+    auto element =
+        Element<RootShadowNode>()
+          .reference(rootShadowNode_)
+          .tag(1)
+          .props([] {
+            auto sharedProps = std::make_shared<RootProps>();
+            auto &props = *sharedProps;
+            props.layoutConstraints = LayoutConstraints{{0,0}, {500, 500}};
+            auto &yogaStyle = props.yogaStyle;
+            yogaStyle.dimensions()[YGDimensionWidth] = YGValue{200, YGUnitPoint};
+            yogaStyle.dimensions()[YGDimensionHeight] = YGValue{200, YGUnitPoint};
+            return sharedProps;
+          })
+          .children({
+            Element<ViewShadowNode>()
+              .reference(viewShadowNodeA_)
+              .tag(2)
+              .props([] {
+                return viewProps(
+                    YGValue{100, YGUnitPoint}, YGValue{100, YGUnitPoint});
+              })
+              .children({
+                Element<ViewShadowNode>()
+                  .reference(viewShadowNodeAA_)
+                  .tag(3)
+                  .props([] {
+                    return viewProps(YGValue{50, YGUnitPoint}, YGValueAuto);
+                  })
+              }),
+            Element<ViewShadowNode>()
+              .reference(viewShadowNodeB_)
+              .tag(4)
+              .props([] {
+                return viewProps(YGValueAuto, YGValueAuto);
+              })
+          });
+    // clang-format on
+
+    builder_.build(element);
+
+    rootShadowNode_->layoutIfNeeded();
+  }
+
+  /*
+   * Returns a new revision of the tree where `AA` has a child of given height.
+   */
+  std::shared_ptr<RootShadowNode> appendChildToAA(float height) {
+    auto child = builder_.build(
+        Element<ViewShadowNode>().tag(5).props([=] {
+          return viewProps(YGValueAuto, YGValue{height, YGUnitPoint});
+        }));
+
+    auto newRootShadowNode = rootShadowNode_->cloneTree(
+        viewShadowNodeAA_->getFamily(), [&](ShadowNode const &oldShadowNode) {
+          return oldShadowNode.clone(
+              {ShadowNodeFragment::propsPlaceholder(),
+               std::make_shared<SharedShadowNodeList>(
+                   SharedShadowNodeList{child})});
+        });
+
+    return std::static_pointer_cast<RootShadowNode>(newRootShadowNode);
+  }
+};
+
+TEST_F(RelayoutBoundaryTest, testContentChangeDoesNotDirtyAncestors) {
+  auto newRootShadowNode = appendChildToAA(30);
+
+  auto &newViewShadowNodeA = static_cast<ViewShadowNode const &>(
+      *newRootShadowNode->getChildren().at(0));
+
+  // `A` is dirty but keeps its size, so it doesn't dirty the root's Yoga
+  // node. The root still isn't layout-clean: it has a dirty relayout
+  // boundary below it which has to be laid out.
+  EXPECT_FALSE(newViewShadowNodeA.getIsLayoutClean());
+  EXPECT_FALSE(newRootShadowNode->getIsLayoutClean());
+
+  auto affectedNodes = std::vector<LayoutableShadowNode const *>{};
+  EXPECT_TRUE(newRootShadowNode->layoutIfNeeded(&affectedNodes));
+  EXPECT_TRUE(newRootShadowNode->getIsLayoutClean());
+
+  auto &newViewShadowNodeAA = static_cast<ViewShadowNode const &>(
+      *newViewShadowNodeA.getChildren().at(0));
+
+  EXPECT_EQ(newViewShadowNodeAA.getLayoutMetrics().frame.size.height, 30);
+  EXPECT_EQ(newViewShadowNodeA.getLayoutMetrics().frame.size.height, 100);
+  EXPECT_EQ(
+      newViewShadowNodeA.getLayoutMetrics().frame,
+      viewShadowNodeA_->getLayoutMetrics().frame);
+
+  auto &newViewShadowNodeB = static_cast<ViewShadowNode const &>(
+      *newRootShadowNode->getChildren().at(1));
+  EXPECT_EQ(newViewShadowNodeB.getLayoutMetrics().frame.origin.y, 100);
+
+  auto isAffected = [&](ShadowNode const &shadowNode) {
+    return std::find(
+               affectedNodes.begin(),
+               affectedNodes.end(),
+               dynamic_cast<LayoutableShadowNode const *>(&shadowNode)) !=
+        affectedNodes.end();
+  };
+  EXPECT_TRUE(isAffected(newViewShadowNodeAA));
+  EXPECT_FALSE(isAffected(newViewShadowNodeB));
+}
+
+TEST_F(RelayoutBoundaryTest, testBaselineLayoutIsDirtied) {
+  auto rootProps = std::make_shared<RootProps>(
+      static_cast<RootProps const &>(*rootShadowNode_->getProps()));
+  rootProps->yogaStyle.flexDirection() = YGFlexDirectionRow;
+  rootProps->yogaStyle.alignItems() = YGAlignBaseline;
+  rootShadowNode_ = std::static_pointer_cast<RootShadowNode>(
+      rootShadowNode_->clone({rootProps}));
+  rootShadowNode_->layoutIfNeeded();
+
+  EXPECT_EQ(
+      static_cast<ViewShadowNode const &>(*rootShadowNode_->getChildren().at(1))
+          .getLayoutMetrics()
+          .frame.origin.y,
+      0);
+
+  auto newRootShadowNode = appendChildToAA(30);
+  newRootShadowNode->layoutIfNeeded();
+
+  // The baseline of `A` has moved, so the root must have been laid out again.
+  auto &newViewShadowNodeB = static_cast<ViewShadowNode const &>(
+      *newRootShadowNode->getChildren().at(1));
+  EXPECT_EQ(newViewShadowNodeB.getLayoutMetrics().frame.origin.y, 30);
+}
+
+} // namespace react
+} // namespace facebook
@@ -7,7 +7,10 @@
 
 #pragma once
 
+#include <functional>
+
 #include <react/renderer/core/EventDispatcher.h>
+#include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/core/Props.h>
 #include <react/renderer/core/RawPropsParser.h>
 #include <react/renderer/core/ShadowNode.h>
@@ -45,6 +48,9 @@ class ComponentDescriptor {
    */
   using Flavor = std::shared_ptr<void const>;
 
+  using BackgroundExecutor =
+      std::function<void(std::function<void()> &&callback)>;
+
   ComponentDescriptor(ComponentDescriptorParameters const &parameters);
 
   virtual ~ComponentDescriptor() = default;
@@ -93,6 +99,20 @@ class ComponentDescriptor {
       const ShadowNode::Shared &parentShadowNode,
       const ShadowNode::Shared &childShadowNode) const = 0;
 
+  /*
+   * Called (when speculative layout is enabled) after `shadowNode` was
+   * appended to `parentShadowNode`, at which point the subtree of `shadowNode`
+   * is complete. Gives components with expensive layout (e.g. text) a chance
+   * to prepare it on `backgroundExecutor` before the layout pass needs it.
+   * `layoutContext` is the context the surface was last laid out with.
+   * Does nothing by default.
+   */
+  virtual void prepareLayout(
+      ShadowNode const &parentShadowNode,
+      ShadowNode::Shared const &shadowNode,
+      LayoutContext const &layoutContext,
+      BackgroundExecutor const &backgroundExecutor) const {}
+
   /*
    * Creates a new `Props` of a particular type with all values copied from
    * `props` and `rawProps` applied on top of this.
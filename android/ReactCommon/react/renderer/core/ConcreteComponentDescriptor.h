@@ -16,6 +16,7 @@
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/core/ShadowNodeFragment.h>
 #include <react/renderer/core/State.h>
+#include <react/renderer/core/SurfaceArena.h>
 
 namespace facebook {
 namespace react {
@@ -66,7 +67,7 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
     assert(std::dynamic_pointer_cast<const ConcreteProps>(fragment.props));
 
     auto shadowNode =
-        std::make_shared<ShadowNodeT>(fragment, family, getTraits());
+        allocateShared<ShadowNodeT>(fragment, family, getTraits());
 
     adopt(shadowNode);
 
@@ -80,7 +81,7 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
         dynamic_cast<ConcreteShadowNode const *>(&sourceShadowNode) &&
         "Provided `sourceShadowNode` has an incompatible type.");
 
-    auto shadowNode = std::make_shared<ShadowNodeT>(sourceShadowNode, fragment);
+    auto shadowNode = allocateShared<ShadowNodeT>(sourceShadowNode, fragment);
 
     adopt(shadowNode);
     return shadowNode;
@@ -138,8 +139,8 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
       return nullptr;
     }
 
-    return std::make_shared<ConcreteState>(
-        std::make_shared<ConcreteStateData const>(
+    return allocateShared<ConcreteState>(
+        allocateShared<ConcreteStateData const>(
             ConcreteShadowNode::initialStateData(
                 fragment, ShadowNodeFamilyFragment::build(*family), *this)),
         family);
@@ -155,7 +156,7 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
 
     assert(data && "Provided `data` is nullptr.");
 
-    return std::make_shared<ConcreteState const>(
+    return allocateShared<ConcreteState const>(
         std::static_pointer_cast<ConcreteStateData const>(data),
         *family.getMostRecentState());
   }
@@ -163,9 +164,9 @@ class ConcreteComponentDescriptor : public ComponentDescriptor {
   virtual ShadowNodeFamily::Shared createFamily(
       ShadowNodeFamilyFragment const &fragment,
       SharedEventTarget eventTarget) const override {
-    auto eventEmitter = std::make_shared<ConcreteEventEmitter const>(
+    auto eventEmitter = allocateShared<ConcreteEventEmitter const>(
         std::move(eventTarget), fragment.tag, eventDispatcher_);
-    return std::make_shared<ShadowNodeFamily>(
+    return allocateShared<ShadowNodeFamily>(
         ShadowNodeFamilyFragment{
             fragment.tag, fragment.surfaceId, eventEmitter},
         eventDispatcher_,
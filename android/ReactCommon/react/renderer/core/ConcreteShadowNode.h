@@ -12,6 +12,7 @@
 #include <react/renderer/core/Props.h>
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/core/StateData.h>
+#include <react/renderer/core/SurfaceArena.h>
 
 namespace facebook {
 namespace react {
@@ -71,7 +72,7 @@ class ConcreteShadowNode : public BaseShadowNodeT {
   static SharedConcreteProps Props(
       RawProps const &rawProps,
       SharedProps const &baseProps = nullptr) {
-    return std::make_shared<PropsT const>(
+    return allocateShared<PropsT const>(
         baseProps ? static_cast<PropsT const &>(*baseProps) : PropsT(),
         rawProps);
   }
@@ -132,8 +133,8 @@ class ConcreteShadowNode : public BaseShadowNodeT {
    */
   void setStateData(ConcreteStateData &&data) {
     Sealable::ensureUnsealed();
-    state_ = std::make_shared<ConcreteState const>(
-        std::make_shared<ConcreteStateData const>(std::move(data)), *state_);
+    state_ = allocateShared<ConcreteState const>(
+        allocateShared<ConcreteStateData const>(std::move(data)), *state_);
   }
 };
 
@@ -159,6 +159,10 @@ Point LayoutableShadowNode::getContentOriginOffset() const {
   return {0, 0};
 }
 
+better::optional<Rect> LayoutableShadowNode::getContentCullingRect() const {
+  return {};
+}
+
 LayoutMetrics LayoutableShadowNode::getRelativeLayoutMetrics(
     LayoutableShadowNode const &ancestorLayoutableShadowNode,
     LayoutInspectingPolicy policy) const {
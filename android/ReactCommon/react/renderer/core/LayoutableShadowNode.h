@@ -12,6 +12,7 @@
 #include <memory>
 #include <vector>
 
+#include <better/optional.h>
 #include <better/small_vector.h>
 #include <react/renderer/core/LayoutMetrics.h>
 #include <react/renderer/core/ShadowNode.h>
@@ -122,6 +123,15 @@ class LayoutableShadowNode : public ShadowNode {
    */
   virtual Point getContentOriginOffset() const;
 
+  /*
+   * Returns a rectangle (in the coordinate space of children's frames) which
+   * the content of the node is culled to by the mounting layer, if the node
+   * has `CullsContent` trait. Children of the node's children which do not
+   * intersect the rectangle are not mounted.
+   * Default implementation returns an empty optional (no culling).
+   */
+  virtual better::optional<Rect> getContentCullingRect() const;
+
   /*
    * Returns layout metrics relatively to the given ancestor node.
    * Uses `computeRelativeLayoutMetrics()` under the hood.
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 
 #include <react/renderer/core/RawPropsPrimitives.h>
@@ -40,3 +41,18 @@ bool operator!=(RawPropsKey const &lhs, RawPropsKey const &rhs) noexcept;
 
 } // namespace react
 } // namespace facebook
+
+namespace std {
+
+template <>
+struct hash<facebook::react::RawPropsKey> {
+  size_t operator()(facebook::react::RawPropsKey const &key) const noexcept {
+    auto hasher = std::hash<char const *>{};
+    auto seed = hasher(key.name);
+    seed ^= hasher(key.prefix) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= hasher(key.suffix) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+  }
+};
+
+} // namespace std
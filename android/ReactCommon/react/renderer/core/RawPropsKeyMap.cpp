@@ -11,10 +11,16 @@
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <limits>
+#include <vector>
 
 namespace facebook {
 namespace react {
 
+static constexpr auto kEmptySlot = std::numeric_limits<uint8_t>::max();
+static constexpr auto kMaxDisplacement = std::numeric_limits<uint16_t>::max();
+static constexpr auto kAverageBucketSize = size_t{4};
+
 bool RawPropsKeyMap::hasSameName(Item const &lhs, Item const &rhs) noexcept {
   return lhs.length == rhs.length &&
       (std::memcmp(lhs.name, rhs.name, lhs.length) == 0);
@@ -39,6 +45,107 @@ void RawPropsKeyMap::insert(
   items_.push_back(item);
 }
 
+uint64_t RawPropsKeyMap::hash(
+    char const *name,
+    RawPropsPropNameLength length,
+    uint64_t seed) noexcept {
+  // FNV-1a, followed by a finalizer which spreads entropy into low bits.
+  auto hash = uint64_t{14695981039346656037ull} ^ seed;
+  for (auto i = 0; i < length; i++) {
+    hash ^= static_cast<uint8_t>(name[i]);
+    hash *= uint64_t{1099511628211ull};
+  }
+  hash ^= hash >> 33;
+  hash *= uint64_t{0xff51afd7ed558ccdull};
+  hash ^= hash >> 33;
+  return hash;
+}
+
+size_t RawPropsKeyMap::slotIndex(
+    uint64_t hash,
+    Displacement displacement,
+    size_t mask) noexcept {
+  return static_cast<size_t>(
+      ((hash & 0xffffffff) + displacement * ((hash >> 32) | 1)) & mask);
+}
+
+size_t RawPropsKeyMap::bucketIndex(uint64_t hash, size_t mask) noexcept {
+  return static_cast<size_t>(hash >> 48) & mask;
+}
+
+bool RawPropsKeyMap::build(uint64_t seed, size_t numberOfSlots) noexcept {
+  auto numberOfBuckets = size_t{1};
+  while (numberOfBuckets * kAverageBucketSize < items_.size()) {
+    numberOfBuckets <<= 1;
+  }
+
+  auto slotMask = numberOfSlots - 1;
+  auto bucketMask = numberOfBuckets - 1;
+
+  displacements_.assign(numberOfBuckets, 0);
+  slots_.assign(numberOfSlots, kEmptySlot);
+
+  auto hashes = std::vector<uint64_t>(items_.size());
+  auto buckets = std::vector<std::vector<SlotValue>>(numberOfBuckets);
+  for (auto i = 0; i < items_.size(); i++) {
+    auto const &item = items_[i];
+    hashes[i] = hash(item.name, item.length, seed);
+    buckets[bucketIndex(hashes[i], bucketMask)].push_back(i);
+  }
+
+  // Bigger buckets are harder to place, so they are placed first.
+  auto order = std::vector<size_t>(numberOfBuckets);
+  for (auto i = 0; i < numberOfBuckets; i++) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+    return buckets[lhs].size() > buckets[rhs].size();
+  });
+
+  for (auto index : order) {
+    auto const &bucket = buckets[index];
+    if (bucket.empty()) {
+      break;
+    }
+
+    auto placed = false;
+    for (auto displacement = 0; displacement <= kMaxDisplacement;
+         displacement++) {
+      // Tentatively occupying slots; reverting if some slot is taken.
+      auto count = size_t{0};
+      for (; count < bucket.size(); count++) {
+        auto &slot = slots_[slotIndex(
+            hashes[bucket[count]],
+            static_cast<Displacement>(displacement),
+            slotMask)];
+        if (slot != kEmptySlot) {
+          break;
+        }
+        slot = bucket[count];
+      }
+
+      if (count == bucket.size()) {
+        displacements_[index] = static_cast<Displacement>(displacement);
+        placed = true;
+        break;
+      }
+
+      for (auto i = size_t{0}; i < count; i++) {
+        slots_[slotIndex(
+            hashes[bucket[i]],
+            static_cast<Displacement>(displacement),
+            slotMask)] = kEmptySlot;
+      }
+    }
+
+    if (!placed) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 void RawPropsKeyMap::reindex() noexcept {
   // Sorting `items_` by property names length and then lexicographically.
   // Note, sort algorithm must be stable.
@@ -58,21 +165,23 @@ void RawPropsKeyMap::reindex() noexcept {
       std::unique(items_.begin(), items_.end(), &RawPropsKeyMap::hasSameName),
       items_.end());
 
-  buckets_.resize(kPropNameLengthHardCap);
+  assert(items_.size() < kEmptySlot && "Too many props.");
 
-  auto length = RawPropsPropNameLength{0};
-  for (auto i = 0; i < items_.size(); i++) {
-    auto &item = items_[i];
-    if (item.length != length) {
-      for (auto j = length; j < item.length; j++) {
-        buckets_[j] = i;
-      }
-      length = item.length;
-    }
+  // With a load factor below 0.5, the table can virtually always be built
+  // with the first seed; growing the table and changing the seed are just
+  // fallbacks.
+  auto numberOfSlots = size_t{1};
+  while (numberOfSlots < items_.size() * 2) {
+    numberOfSlots <<= 1;
   }
 
-  for (auto j = length; j < buckets_.size(); j++) {
-    buckets_[j] = items_.size();
+  for (auto seed = uint64_t{0};; seed++) {
+    for (auto size = numberOfSlots; size <= numberOfSlots * 8; size <<= 1) {
+      if (build(seed, size)) {
+        seed_ = seed;
+        return;
+      }
+    }
   }
 }
 
@@ -81,25 +190,26 @@ RawPropsValueIndex RawPropsKeyMap::at(
     RawPropsPropNameLength length) noexcept {
   assert(length > 0);
   assert(length < kPropNameLengthHardCap);
-  // 1. Find the bucket.
-  auto lower = int{buckets_[length - 1]};
-  auto upper = int{buckets_[length]} - 1;
-  assert(lower - 1 <= upper);
-
-  // 2. Binary search in the bucket.
-  while (lower <= upper) {
-    auto median = (lower + upper) / 2;
-    auto condition = std::memcmp(items_[median].name, name, length);
-    if (condition < 0) {
-      lower = median + 1;
-    } else if (condition == 0) {
-      return items_[median].value;
-    } else /* if (condition > 0) */ {
-      upper = median - 1;
-    }
+  if (slots_.empty()) {
+    return kRawPropsValueIndexEmpty;
+  }
+
+  // 1. Find the only slot where the name can be.
+  auto hash = RawPropsKeyMap::hash(name, length, seed_);
+  auto displacement =
+      displacements_[bucketIndex(hash, displacements_.size() - 1)];
+  auto slot = slots_[slotIndex(hash, displacement, slots_.size() - 1)];
+  if (slot == kEmptySlot) {
+    return kRawPropsValueIndexEmpty;
+  }
+
+  // 2. Compare the name with the one stored there.
+  auto const &item = items_[slot];
+  if (item.length != length || std::memcmp(item.name, name, length) != 0) {
+    return kRawPropsValueIndexEmpty;
   }
 
-  return kRawPropsValueIndexEmpty;
+  return item.value;
 }
 
 } // namespace react
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <better/small_vector.h>
+#include <cstdint>
 
 #include <react/renderer/core/RawPropsKey.h>
 #include <react/renderer/core/RawPropsPrimitives.h>
@@ -17,10 +18,10 @@ namespace react {
 
 /*
  * A map especially optimized to hold `{name: index}` relations.
- * The implementation is conceptually similar to a classic hash map with a hash
- * function that returns the length of the string.
  * The map is optimized for reads only (the map must be reindexed before a bunch
- * of reads).
+ * of reads). Reindexing builds a collision-free (perfect) hash table
+ * for the stored names (using the "hash and displace" scheme), so a lookup
+ * costs hashing the name and comparing it with a single stored name.
  */
 class RawPropsKeyMap final {
  public:
@@ -50,14 +51,39 @@ class RawPropsKeyMap final {
     char name[kPropNameLengthHardCap];
   };
 
+  /*
+   * Index of an item in `items_` stored in a slot of the hash table.
+   */
+  using SlotValue = uint8_t;
+  using Displacement = uint16_t;
+
   static bool shouldFirstOneBeBeforeSecondOne(
       Item const &lhs,
       Item const &rhs) noexcept;
   static bool hasSameName(Item const &lhs, Item const &rhs) noexcept;
+  static uint64_t hash(
+      char const *name,
+      RawPropsPropNameLength length,
+      uint64_t seed) noexcept;
+
+  static size_t slotIndex(
+      uint64_t hash,
+      Displacement displacement,
+      size_t mask) noexcept;
+  static size_t bucketIndex(uint64_t hash, size_t mask) noexcept;
+
+  /*
+   * Tries to build the hash table with given seed and number of slots (must
+   * be a power of two).
+   */
+  bool build(uint64_t seed, size_t numberOfSlots) noexcept;
 
   better::small_vector<Item, kNumberOfExplicitlySpecifedPropsSoftCap> items_{};
-  better::small_vector<RawPropsPropNameLength, kPropNameLengthHardCap>
-      buckets_{};
+  better::small_vector<Displacement, kNumberOfPropsPerComponentSoftCap>
+      displacements_{};
+  better::small_vector<SlotValue, kNumberOfPropsPerComponentSoftCap * 2>
+      slots_{};
+  uint64_t seed_{0};
 };
 
 } // namespace react
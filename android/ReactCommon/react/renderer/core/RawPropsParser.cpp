@@ -28,14 +28,8 @@ RawValue const *RawPropsParser::at(
     // access fields a second (or third, etc) time.
     // Without this, multiple entries will be created for the same key, but
     // only the first access of the key will return a sensible value.
-    // The complexity of this is (n + (n - 1) + (n - 2) + ... + (n - (n - 1) +
-    // 1))) or n*n - (1/2)(n*(n+1)). If there are 100 props, this will result in
-    // 4950 lookups and equality checks on initialization of the parser, which
-    // happens exactly once per component.
-    for (int i = 0; i < size_; i++) {
-      if (keys_[i] == key) {
-        return nullptr;
-      }
+    if (!preparedKeys_.insert(key).second) {
+      return nullptr;
     }
     // This is not thread-safe part; this happens only during initialization of
     // a `ComponentDescriptor` where it is actually safe.
@@ -88,6 +82,7 @@ RawValue const *RawPropsParser::at(
 
 void RawPropsParser::postPrepare() noexcept {
   ready_ = true;
+  preparedKeys_ = {};
   nameToIndex_.reindex();
 }
 
@@ -15,6 +15,7 @@
 #include <react/renderer/core/RawPropsKeyMap.h>
 #include <react/renderer/core/RawPropsPrimitives.h>
 #include <react/renderer/core/RawValue.h>
+#include <unordered_set>
 
 namespace facebook {
 namespace react {
@@ -39,10 +40,17 @@ class RawPropsParser final {
     static_assert(
         std::is_base_of<Props, PropsT>::value,
         "PropsT must be a descendant of Props");
-    RawProps emptyRawProps{};
-    emptyRawProps.parse(*this);
-    PropsT({}, emptyRawProps);
-    postPrepare();
+    // Collecting keys requires parsing empty props, so it's done once per
+    // `PropsT` and the result is copied to every parser for this type.
+    static RawPropsParser const prepared = [] {
+      auto parser = RawPropsParser{};
+      RawProps emptyRawProps{};
+      emptyRawProps.parse(parser);
+      PropsT({}, emptyRawProps);
+      parser.postPrepare();
+      return parser;
+    }();
+    *this = prepared;
   }
 
  private:
@@ -70,6 +78,10 @@ class RawPropsParser final {
   mutable better::small_vector<RawPropsKey, kNumberOfPropsPerComponentSoftCap>
       keys_{};
   mutable RawPropsKeyMap nameToIndex_{};
+  /*
+   * Keys collected so far; used only while preparing.
+   */
+  mutable std::unordered_set<RawPropsKey> preparedKeys_{};
   mutable int size_{0};
   mutable bool ready_{false};
 };
@@ -12,6 +12,7 @@
 
 #include <react/renderer/core/ComponentDescriptor.h>
 #include <react/renderer/core/ShadowNodeFragment.h>
+#include <react/renderer/core/SurfaceArena.h>
 #include <react/renderer/debug/DebugStringConvertible.h>
 #include <react/renderer/debug/debugStringConvertibleUtils.h>
 
@@ -208,7 +209,7 @@ void ShadowNode::cloneChildrenIfShared() {
   }
 
   traits_.unset(ShadowNodeTraits::Trait::ChildrenAreShared);
-  children_ = std::make_shared<SharedShadowNodeList>(*children_);
+  children_ = allocateShared<SharedShadowNodeList>(*children_);
 }
 
 void ShadowNode::setMounted(bool mounted) const {
@@ -254,7 +255,7 @@ ShadowNode::Unshared ShadowNode::cloneTree(
 
     childNode = parentNode.clone({
         ShadowNodeFragment::propsPlaceholder(),
-        std::make_shared<SharedShadowNodeList>(children),
+        allocateShared<SharedShadowNodeList>(children),
     });
   }
 
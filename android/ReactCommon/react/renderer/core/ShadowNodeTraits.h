@@ -54,6 +54,11 @@ class ShadowNodeTraits {
     // Nodes with this trait (and all their descendants) will not produce views.
     Hidden = 1 << 6,
 
+    // Inherits `LayoutableShadowNode` and implements `getContentCullingRect()`.
+    // The differ only mounts children of the node's children whose frames
+    // intersect the culling rect.
+    CullsContent = 1 << 7,
+
     // Inherits `YogaLayoutableShadowNode` and enforces that the `YGNode` is a
     // leaf.
     LeafYogaNode = 1 << 10,
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "SurfaceArena.h"
+
+namespace facebook {
+namespace react {
+
+static thread_local SurfaceArena *currentArena = nullptr;
+
+SurfaceArena::Scope::Scope(SurfaceArena *arena) noexcept
+    : previousArena_(currentArena) {
+  currentArena = arena;
+}
+
+SurfaceArena::Scope::~Scope() noexcept {
+  currentArena = previousArena_;
+}
+
+SurfaceArena::Shared SurfaceArena::create() {
+  // The owner holds the initial reference; objects allocated from the arena
+  // hold one more each.
+  return Shared(new SurfaceArena(), [](SurfaceArena *arena) {
+    arena->release();
+  });
+}
+
+SurfaceArena *SurfaceArena::current() noexcept {
+  return currentArena;
+}
+
+SurfaceArena::~SurfaceArena() {
+  for (auto chunk : chunks_) {
+    ::operator delete(chunk);
+  }
+}
+
+void SurfaceArena::retain() noexcept {
+  referenceCount_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void SurfaceArena::release() noexcept {
+  if (referenceCount_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete this;
+  }
+}
+
+void *SurfaceArena::allocate(size_t size) {
+  if (size == 0 || size > kMaxBlockSize) {
+    heapAllocationCount_.fetch_add(1, std::memory_order_relaxed);
+    return ::operator new(size);
+  }
+
+  auto sizeClass = (size - 1) / kGranularity;
+  auto blockSize = (sizeClass + 1) * kGranularity;
+  void *block = nullptr;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto freeBlock = freeLists_[sizeClass];
+    if (freeBlock != nullptr) {
+      freeLists_[sizeClass] = freeBlock->next;
+      block = freeBlock;
+    } else {
+      if (chunkCursor_ == nullptr ||
+          static_cast<size_t>(chunkEnd_ - chunkCursor_) < blockSize) {
+        // The tail of the previous chunk is abandoned; it's smaller than the
+        // largest block.
+        chunks_.reserve(chunks_.size() + 1);
+        auto chunk = static_cast<char *>(::operator new(kChunkSize));
+        chunks_.push_back(chunk);
+        chunkCursor_ = chunk;
+        chunkEnd_ = chunk + kChunkSize;
+      }
+      block = chunkCursor_;
+      chunkCursor_ += blockSize;
+    }
+  }
+
+  retain();
+  allocationCount_.fetch_add(1, std::memory_order_relaxed);
+  return block;
+}
+
+void SurfaceArena::deallocate(void *pointer, size_t size) noexcept {
+  if (size == 0 || size > kMaxBlockSize) {
+    ::operator delete(pointer);
+    return;
+  }
+
+  auto sizeClass = (size - 1) / kGranularity;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto freeBlock = static_cast<FreeBlock *>(pointer);
+    freeBlock->next = freeLists_[sizeClass];
+    freeLists_[sizeClass] = freeBlock;
+  }
+
+  deallocationCount_.fetch_add(1, std::memory_order_relaxed);
+  release();
+}
+
+SurfaceArena::Statistics SurfaceArena::getStatistics() const noexcept {
+  auto statistics = Statistics{};
+  statistics.allocationCount = allocationCount_.load(std::memory_order_relaxed);
+  statistics.deallocationCount =
+      deallocationCount_.load(std::memory_order_relaxed);
+  statistics.heapAllocationCount =
+      heapAllocationCount_.load(std::memory_order_relaxed);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    statistics.reservedBytes = chunks_.size() * kChunkSize;
+  }
+  return statistics;
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+/*
+ * A pooled memory arena for shadow nodes, props and states of one surface.
+ *
+ * Small blocks are carved out of large chunks and recycled through
+ * per-size-class free lists, so objects produced by the same commit end up
+ * close to each other in memory. The chunks are released all at once when
+ * the arena is dropped by its owner *and* the last object allocated from it
+ * is destroyed; objects can safely outlive the owner.
+ *
+ * Objects are placed into an arena by creating them with `allocateShared`
+ * while a `SurfaceArena::Scope` is active on the current thread. Without
+ * a scope, `allocateShared` is `std::make_shared`.
+ *
+ * Thread safe.
+ */
+class SurfaceArena final {
+ public:
+  using Shared = std::shared_ptr<SurfaceArena>;
+
+  struct Statistics {
+    size_t allocationCount{0};
+    size_t deallocationCount{0};
+
+    /*
+     * Allocations which were too large for the arena and went to the heap.
+     */
+    size_t heapAllocationCount{0};
+
+    size_t reservedBytes{0};
+  };
+
+  /*
+   * Makes the arena current for the current thread for the lifetime of the
+   * scope. `nullptr` disables arena allocation inside the scope.
+   */
+  class Scope final {
+   public:
+    explicit Scope(SurfaceArena *arena) noexcept;
+    ~Scope() noexcept;
+
+    Scope(Scope const &) = delete;
+    Scope &operator=(Scope const &) = delete;
+
+   private:
+    SurfaceArena *previousArena_;
+  };
+
+  /*
+   * Creates a new arena. Dropping the returned pointer releases the arena as
+   * soon as there are no objects allocated from it left.
+   */
+  static Shared create();
+
+  /*
+   * Returns the arena of the innermost `Scope` of the current thread.
+   */
+  static SurfaceArena *current() noexcept;
+
+  void *allocate(size_t size);
+  void deallocate(void *pointer, size_t size) noexcept;
+
+  Statistics getStatistics() const noexcept;
+
+ private:
+  static constexpr size_t kGranularity = 16;
+  // Yoga-backed shadow nodes (the bulk of allocations) are around a kilobyte.
+  static constexpr size_t kMaxBlockSize = 2048;
+  static constexpr size_t kSizeClassCount = kMaxBlockSize / kGranularity;
+  static constexpr size_t kChunkSize = 128 * 1024;
+
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  SurfaceArena() = default;
+  ~SurfaceArena();
+
+  void retain() noexcept;
+  void release() noexcept;
+
+  std::atomic<size_t> referenceCount_{1};
+
+  mutable std::mutex mutex_;
+  std::array<FreeBlock *, kSizeClassCount> freeLists_{}; // Protected by mutex_
+  std::vector<void *> chunks_; // Protected by mutex_
+  char *chunkCursor_{nullptr}; // Protected by mutex_
+  char *chunkEnd_{nullptr}; // Protected by mutex_
+
+  std::atomic<size_t> allocationCount_{0};
+  std::atomic<size_t> deallocationCount_{0};
+  std::atomic<size_t> heapAllocationCount_{0};
+};
+
+/*
+ * Standard allocator which allocates from a `SurfaceArena`.
+ * Meant to be used with `std::allocate_shared`.
+ */
+template <typename T>
+class SurfaceArenaAllocator {
+ public:
+  using value_type = T;
+
+  explicit SurfaceArenaAllocator(SurfaceArena *arena) noexcept
+      : arena_(arena) {}
+
+  template <typename U>
+  SurfaceArenaAllocator(SurfaceArenaAllocator<U> const &other) noexcept
+      : arena_(other.arena_) {}
+
+  T *allocate(size_t count) {
+    return static_cast<T *>(arena_->allocate(count * sizeof(T)));
+  }
+
+  void deallocate(T *pointer, size_t count) noexcept {
+    arena_->deallocate(pointer, count * sizeof(T));
+  }
+
+  template <typename U>
+  bool operator==(SurfaceArenaAllocator<U> const &rhs) const noexcept {
+    return arena_ == rhs.arena_;
+  }
+
+  template <typename U>
+  bool operator!=(SurfaceArenaAllocator<U> const &rhs) const noexcept {
+    return arena_ != rhs.arena_;
+  }
+
+ private:
+  template <typename U>
+  friend class SurfaceArenaAllocator;
+
+  static_assert(
+      alignof(T) <= alignof(std::max_align_t),
+      "SurfaceArena does not support over-aligned types.");
+
+  SurfaceArena *arena_;
+};
+
+/*
+ * `std::make_shared` which allocates from the current `SurfaceArena` (if
+ * any).
+ */
+template <typename T, typename... Args>
+std::shared_ptr<T> allocateShared(Args &&... args) {
+  using MutableT = typename std::remove_const<T>::type;
+  auto arena = SurfaceArena::current();
+  if (arena == nullptr) {
+    return std::make_shared<MutableT>(std::forward<Args>(args)...);
+  }
+  return std::allocate_shared<MutableT>(
+      SurfaceArenaAllocator<MutableT>{arena}, std::forward<Args>(args)...);
+}
+
+} // namespace react
+} // namespace facebook
@@ -6,6 +6,8 @@
  */
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <react/renderer/core/ConcreteShadowNode.h>
@@ -305,3 +307,29 @@ TEST(RawPropsTest, handlePropsMultiLookup) {
   EXPECT_NEAR(props->floatValue, 10.0, 0.00001);
   EXPECT_NEAR(props->derivedFloatValue, 20.0, 0.00001);
 }
+
+TEST(RawPropsTest, keyMapFindsEveryKey) {
+  // Names must outlive the map's keys, like string literals do.
+  auto names = std::vector<std::string>{};
+  for (auto i = 0; i < 200; i++) {
+    names.push_back("prop" + std::to_string(i * 7919));
+  }
+  auto const prefix = "margin";
+  auto const suffix = "Left";
+
+  auto map = RawPropsKeyMap{};
+  for (auto i = 0; i < names.size(); i++) {
+    map.insert(RawPropsKey{nullptr, names[i].c_str(), nullptr}, i);
+  }
+  map.insert(RawPropsKey{prefix, "", suffix}, 200);
+  // Duplicating name; the first inserted one wins.
+  map.insert(RawPropsKey{nullptr, "marginLeft", nullptr}, 201);
+  map.reindex();
+
+  for (auto i = 0; i < names.size(); i++) {
+    EXPECT_EQ(map.at(names[i].c_str(), names[i].size()), i);
+  }
+  EXPECT_EQ(map.at("marginLeft", 10), 200);
+  EXPECT_EQ(map.at("marginRight", 11), kRawPropsValueIndexEmpty);
+  EXPECT_EQ(map.at("prop1", 5), kRawPropsValueIndexEmpty);
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <react/renderer/core/SurfaceArena.h>
+
+#include "TestComponent.h"
+
+using namespace facebook::react;
+
+TEST(SurfaceArenaTest, testAllocationOutsideOfScope) {
+  auto arena = SurfaceArena::create();
+
+  auto value = allocateShared<std::string const>("value");
+
+  EXPECT_EQ(*value, "value");
+  EXPECT_EQ(arena->getStatistics().allocationCount, 0);
+  EXPECT_EQ(SurfaceArena::current(), nullptr);
+}
+
+TEST(SurfaceArenaTest, testAllocationInsideOfScope) {
+  auto arena = SurfaceArena::create();
+
+  {
+    SurfaceArena::Scope scope(arena.get());
+    EXPECT_EQ(SurfaceArena::current(), arena.get());
+
+    auto value = allocateShared<std::string const>("value");
+    EXPECT_EQ(*value, "value");
+  }
+
+  EXPECT_EQ(SurfaceArena::current(), nullptr);
+
+  auto statistics = arena->getStatistics();
+  EXPECT_EQ(statistics.allocationCount, 1);
+  EXPECT_EQ(statistics.deallocationCount, 1);
+  EXPECT_EQ(statistics.heapAllocationCount, 0);
+  EXPECT_GT(statistics.reservedBytes, 0);
+}
+
+TEST(SurfaceArenaTest, testNestedScopes) {
+  auto outerArena = SurfaceArena::create();
+  auto innerArena = SurfaceArena::create();
+
+  SurfaceArena::Scope outerScope(outerArena.get());
+  {
+    SurfaceArena::Scope innerScope(innerArena.get());
+    EXPECT_EQ(SurfaceArena::current(), innerArena.get());
+
+    {
+      SurfaceArena::Scope disablingScope(nullptr);
+      EXPECT_EQ(SurfaceArena::current(), nullptr);
+    }
+
+    EXPECT_EQ(SurfaceArena::current(), innerArena.get());
+  }
+  EXPECT_EQ(SurfaceArena::current(), outerArena.get());
+}
+
+TEST(SurfaceArenaTest, testBlocksAreReused) {
+  auto arena = SurfaceArena::create();
+  SurfaceArena::Scope scope(arena.get());
+
+  auto first = allocateShared<TestProps const>();
+  auto firstAddress = static_cast<void const *>(first.get());
+  first.reset();
+
+  auto second = allocateShared<TestProps const>();
+  EXPECT_EQ(static_cast<void const *>(second.get()), firstAddress);
+}
+
+TEST(SurfaceArenaTest, testObjectsOutliveArenaOwner) {
+  auto arena = SurfaceArena::create();
+  auto weakArena = std::weak_ptr<SurfaceArena>{arena};
+
+  std::shared_ptr<std::vector<int> const> value;
+  {
+    SurfaceArena::Scope scope(arena.get());
+    value = allocateShared<std::vector<int> const>(100, 42);
+  }
+
+  arena.reset();
+
+  // The owner is gone, but the memory is still valid.
+  EXPECT_TRUE(weakArena.expired());
+  EXPECT_EQ(value->size(), 100);
+  EXPECT_EQ(value->at(99), 42);
+}
+
+TEST(SurfaceArenaTest, testLargeAllocationsGoToHeap) {
+  struct Large {
+    char payload[4096];
+  };
+
+  auto arena = SurfaceArena::create();
+  SurfaceArena::Scope scope(arena.get());
+
+  auto value = allocateShared<Large>();
+
+  EXPECT_EQ(arena->getStatistics().heapAllocationCount, 1);
+}
+
+TEST(SurfaceArenaTest, testDeallocationOnAnotherThread) {
+  auto arena = SurfaceArena::create();
+
+  auto values = std::vector<std::shared_ptr<std::string const>>{};
+  {
+    SurfaceArena::Scope scope(arena.get());
+    for (int i = 0; i < 1000; i++) {
+      values.push_back(allocateShared<std::string const>(std::to_string(i)));
+    }
+  }
+
+  auto thread = std::thread([&]() { values.clear(); });
+  thread.join();
+
+  auto statistics = arena->getStatistics();
+  EXPECT_EQ(statistics.allocationCount, 1000);
+  EXPECT_EQ(statistics.deallocationCount, 1000);
+}
+
+TEST(SurfaceArenaTest, testShadowNodeCloning) {
+  auto eventDispatcher = std::shared_ptr<EventDispatcher const>();
+  auto componentDescriptor = TestComponentDescriptor({eventDispatcher});
+  auto arena = SurfaceArena::create();
+
+  auto family = componentDescriptor.createFamily(
+      ShadowNodeFamilyFragment{
+          /* .tag = */ 9,
+          /* .surfaceId = */ 1,
+          /* .eventEmitter = */ nullptr,
+      },
+      nullptr);
+  auto shadowNode = componentDescriptor.createShadowNode(
+      ShadowNodeFragment{
+          /* .props = */ std::make_shared<TestProps const>(),
+      },
+      family);
+
+  auto allocationCount = arena->getStatistics().allocationCount;
+  EXPECT_EQ(allocationCount, 0);
+
+  ShadowNode::Shared clonedShadowNode;
+  {
+    SurfaceArena::Scope scope(arena.get());
+    clonedShadowNode = componentDescriptor.cloneShadowNode(*shadowNode, {});
+  }
+
+  EXPECT_GE(arena->getStatistics().allocationCount, allocationCount + 1);
+  EXPECT_EQ(clonedShadowNode->getTag(), 9);
+  EXPECT_TRUE(ShadowNode::sameFamily(*clonedShadowNode, *shadowNode));
+}
@@ -35,6 +35,14 @@ auto unsupportedPropsDynamic =
 auto sourceProps = ViewProps{};
 auto sharedSourceProps = ViewShadowNode::defaultSharedProps();
 
+static void componentDescriptorCreation(benchmark::State &state) {
+  for (auto _ : state) {
+    ViewComponentDescriptor{
+        ComponentDescriptorParameters{eventDispatcher, contextContainer}};
+  }
+}
+BENCHMARK(componentDescriptorCreation);
+
 static void emptyPropCreation(benchmark::State &state) {
   for (auto _ : state) {
     ViewProps{};
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <folly/json.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/core/EventDispatcher.h>
+#include <react/renderer/core/RawProps.h>
+#include <react/renderer/core/SurfaceArena.h>
+#include <react/utils/ContextContainer.h>
+#include <memory>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+static auto contextContainer = std::make_shared<ContextContainer const>();
+static auto eventDispatcher = std::shared_ptr<EventDispatcher>{nullptr};
+static auto viewComponentDescriptor = ViewComponentDescriptor{
+    ComponentDescriptorParameters{eventDispatcher, contextContainer}};
+
+static auto propsDynamic = folly::parseJson(
+    "{\"flex\": 1, \"padding\": 10, \"position\": \"absolute\", \"nativeID\": \"some-id\"}");
+
+static ShadowNode::Shared createViewShadowNode(Tag tag) {
+  auto family = viewComponentDescriptor.createFamily(
+      ShadowNodeFamilyFragment{tag, /* .surfaceId = */ 1, nullptr}, nullptr);
+  return viewComponentDescriptor.createShadowNode(
+      ShadowNodeFragment{ViewShadowNode::defaultSharedProps()}, family);
+}
+
+/*
+ * Clones a batch of nodes with new props (the way a React commit does) and
+ * drops the previous batch. `state.range(0)` is the batch size.
+ */
+static void cloneNodes(benchmark::State &state, SurfaceArena *arena) {
+  auto batchSize = static_cast<size_t>(state.range(0));
+  auto nodes = std::vector<ShadowNode::Shared>{};
+  for (size_t i = 0; i < batchSize; i++) {
+    nodes.push_back(createViewShadowNode(static_cast<Tag>(i + 1)));
+  }
+
+  SurfaceArena::Scope scope(arena);
+
+  for (auto _ : state) {
+    for (auto &node : nodes) {
+      auto const &rawProps = RawProps(propsDynamic);
+      node = viewComponentDescriptor.cloneShadowNode(
+          *node,
+          {viewComponentDescriptor.cloneProps(node->getProps(), rawProps)});
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * batchSize);
+  if (arena != nullptr) {
+    auto statistics = arena->getStatistics();
+    state.counters["allocations"] = statistics.allocationCount;
+    state.counters["heapAllocations"] = statistics.heapAllocationCount;
+    state.counters["reservedBytes"] = statistics.reservedBytes;
+  }
+}
+
+static void cloneNodesWithMakeShared(benchmark::State &state) {
+  cloneNodes(state, nullptr);
+}
+BENCHMARK(cloneNodesWithMakeShared)->Arg(100)->Arg(1000)->Arg(10000);
+
+static void cloneNodesWithSurfaceArena(benchmark::State &state) {
+  auto arena = SurfaceArena::create();
+  cloneNodes(state, arena.get());
+}
+BENCHMARK(cloneNodesWithSurfaceArena)->Arg(100)->Arg(1000)->Arg(10000);
+
+static void propsCloningWithMakeShared(benchmark::State &state) {
+  auto props = ViewShadowNode::defaultSharedProps();
+  for (auto _ : state) {
+    auto const &rawProps = RawProps(propsDynamic);
+    benchmark::DoNotOptimize(
+        viewComponentDescriptor.cloneProps(props, rawProps));
+  }
+}
+BENCHMARK(propsCloningWithMakeShared);
+
+static void propsCloningWithSurfaceArena(benchmark::State &state) {
+  auto arena = SurfaceArena::create();
+  SurfaceArena::Scope scope(arena.get());
+  auto props = ViewShadowNode::defaultSharedProps();
+  for (auto _ : state) {
+    auto const &rawProps = RawProps(propsDynamic);
+    benchmark::DoNotOptimize(
+        viewComponentDescriptor.cloneProps(props, rawProps));
+  }
+}
+BENCHMARK(propsCloningWithSurfaceArena);
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();
@@ -64,6 +64,11 @@ struct Rect {
     size = {x2 - x1, y2 - y1};
   }
 
+  bool intersects(Rect const &rect) const noexcept {
+    return getMinX() < rect.getMaxX() && rect.getMinX() < getMaxX() &&
+        getMinY() < rect.getMaxY() && rect.getMinY() < getMaxY();
+  }
+
   bool containsPoint(Point point) noexcept {
     return point.x >= origin.x && point.y >= origin.y &&
         point.x <= (origin.x + size.width) &&
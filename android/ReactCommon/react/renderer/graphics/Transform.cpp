@@ -7,13 +7,130 @@
 
 #include "Transform.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include <glog/logging.h>
 
+#if defined(__SSE__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define RN_TRANSFORM_SSE 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define RN_TRANSFORM_NEON 1
+#endif
+
 namespace facebook {
 namespace react {
 
+#pragma mark - Kernels
+
+/*
+ * Matrices are stored row by row and points are treated as row vectors, so
+ * `result[row] = sum(rhs[row][k] * lhs[k])` where `lhs[k]` is the k-th row.
+ * The generic versions are used for `double` (`CGFloat` on 64-bit Apple
+ * platforms) and when no SIMD instruction set is available; the `float`
+ * overloads below take precedence otherwise.
+ */
+template <typename T>
+static inline void
+multiplyMatrices(T const *lhs, T const *rhs, T *result) {
+  for (int row = 0; row < 4; row++) {
+    auto rhs0 = rhs[row * 4 + 0], rhs1 = rhs[row * 4 + 1],
+         rhs2 = rhs[row * 4 + 2], rhs3 = rhs[row * 4 + 3];
+    for (int column = 0; column < 4; column++) {
+      result[row * 4 + column] = rhs0 * lhs[column] +
+          rhs1 * lhs[4 + column] + rhs2 * lhs[8 + column] +
+          rhs3 * lhs[12 + column];
+    }
+  }
+}
+
+/*
+ * Maps `count` 2D points (with `z = 0`, `w = 1`) in place.
+ */
+template <typename T>
+static inline void mapPoints(T const *matrix, T *xs, T *ys, int count) {
+  for (int i = 0; i < count; i++) {
+    auto x = xs[i], y = ys[i];
+    xs[i] = x * matrix[0] + y * matrix[4] + matrix[12];
+    ys[i] = x * matrix[1] + y * matrix[5] + matrix[13];
+  }
+}
+
+#if defined(RN_TRANSFORM_SSE)
+
+static inline void
+multiplyMatrices(float const *lhs, float const *rhs, float *result) {
+  auto lhs0 = _mm_loadu_ps(lhs + 0);
+  auto lhs1 = _mm_loadu_ps(lhs + 4);
+  auto lhs2 = _mm_loadu_ps(lhs + 8);
+  auto lhs3 = _mm_loadu_ps(lhs + 12);
+  for (int row = 0; row < 4; row++) {
+    auto value = _mm_mul_ps(_mm_set1_ps(rhs[row * 4 + 0]), lhs0);
+    value = _mm_add_ps(value, _mm_mul_ps(_mm_set1_ps(rhs[row * 4 + 1]), lhs1));
+    value = _mm_add_ps(value, _mm_mul_ps(_mm_set1_ps(rhs[row * 4 + 2]), lhs2));
+    value = _mm_add_ps(value, _mm_mul_ps(_mm_set1_ps(rhs[row * 4 + 3]), lhs3));
+    _mm_storeu_ps(result + row * 4, value);
+  }
+}
+
+static inline void
+mapPoints(float const *matrix, float *xs, float *ys, int count) {
+  auto m0 = _mm_set1_ps(matrix[0]), m1 = _mm_set1_ps(matrix[1]),
+       m4 = _mm_set1_ps(matrix[4]), m5 = _mm_set1_ps(matrix[5]),
+       m12 = _mm_set1_ps(matrix[12]), m13 = _mm_set1_ps(matrix[13]);
+  int i = 0;
+  for (; i + 4 <= count; i += 4) {
+    auto x = _mm_loadu_ps(xs + i);
+    auto y = _mm_loadu_ps(ys + i);
+    _mm_storeu_ps(
+        xs + i,
+        _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m0), _mm_mul_ps(y, m4)), m12));
+    _mm_storeu_ps(
+        ys + i,
+        _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m1), _mm_mul_ps(y, m5)), m13));
+  }
+  mapPoints<float>(matrix, xs + i, ys + i, count - i);
+}
+
+#elif defined(RN_TRANSFORM_NEON)
+
+static inline void
+multiplyMatrices(float const *lhs, float const *rhs, float *result) {
+  auto lhs0 = vld1q_f32(lhs + 0);
+  auto lhs1 = vld1q_f32(lhs + 4);
+  auto lhs2 = vld1q_f32(lhs + 8);
+  auto lhs3 = vld1q_f32(lhs + 12);
+  for (int row = 0; row < 4; row++) {
+    auto value = vmulq_n_f32(lhs0, rhs[row * 4 + 0]);
+    value = vmlaq_n_f32(value, lhs1, rhs[row * 4 + 1]);
+    value = vmlaq_n_f32(value, lhs2, rhs[row * 4 + 2]);
+    value = vmlaq_n_f32(value, lhs3, rhs[row * 4 + 3]);
+    vst1q_f32(result + row * 4, value);
+  }
+}
+
+static inline void
+mapPoints(float const *matrix, float *xs, float *ys, int count) {
+  auto m12 = vdupq_n_f32(matrix[12]), m13 = vdupq_n_f32(matrix[13]);
+  int i = 0;
+  for (; i + 4 <= count; i += 4) {
+    auto x = vld1q_f32(xs + i);
+    auto y = vld1q_f32(ys + i);
+    vst1q_f32(
+        xs + i, vmlaq_n_f32(vmlaq_n_f32(m12, x, matrix[0]), y, matrix[4]));
+    vst1q_f32(
+        ys + i, vmlaq_n_f32(vmlaq_n_f32(m13, x, matrix[1]), y, matrix[5]));
+  }
+  mapPoints<float>(matrix, xs + i, ys + i, count - i);
+}
+
+#endif
+
+#pragma mark - Transform
+
 #ifdef RN_DEBUG_STRING_CONVERTIBLE
 void Transform::print(Transform const &t, std::string prefix) {
   LOG(ERROR) << prefix << "[ " << t.matrix[0] << " " << t.matrix[1] << " "
@@ -240,6 +357,35 @@ Transform Transform::Interpolate(
   return result;
 }
 
+TransformKind Transform::getKind() const {
+  auto const &m = matrix;
+
+  if (m[3] != 0 || m[7] != 0 || m[11] != 0 || m[15] != 1) {
+    return TransformKind::Perspective;
+  }
+
+  auto hasZ = m[2] != 0 || m[6] != 0 || m[8] != 0 || m[9] != 0;
+  auto hasOffDiagonal = m[1] != 0 || m[4] != 0;
+
+  if (!hasZ && !hasOffDiagonal) {
+    if (m[0] == 1 && m[5] == 1 && m[10] == 1) {
+      return m[12] == 0 && m[13] == 0 && m[14] == 0 ? TransformKind::Identity
+                                                    : TransformKind::Translate;
+    }
+    return TransformKind::Scale;
+  }
+
+  if (!hasZ && m[10] == 1 && m[14] == 0) {
+    return TransformKind::Affine2D;
+  }
+
+  return TransformKind::Perspective;
+}
+
+bool Transform::isIdentity() const {
+  return getKind() == TransformKind::Identity;
+}
+
 bool Transform::operator==(Transform const &rhs) const {
   for (auto i = 0; i < 16; i++) {
     if (matrix[i] != rhs.matrix[i]) {
@@ -254,12 +400,13 @@ bool Transform::operator!=(Transform const &rhs) const {
 }
 
 Transform Transform::operator*(Transform const &rhs) const {
-  if (*this == Transform::Identity()) {
+  if (isIdentity()) {
     return rhs;
   }
 
   const auto &lhs = *this;
   auto result = Transform{};
+  result.operations.reserve(lhs.operations.size() + rhs.operations.size());
   for (const auto &op : this->operations) {
     if (op.type == TransformOperationType::Identity &&
         result.operations.size() > 0) {
@@ -275,46 +422,12 @@ Transform Transform::operator*(Transform const &rhs) const {
     result.operations.push_back(op);
   }
 
-  auto lhs00 = lhs.matrix[0], lhs01 = lhs.matrix[1], lhs02 = lhs.matrix[2],
-       lhs03 = lhs.matrix[3], lhs10 = lhs.matrix[4], lhs11 = lhs.matrix[5],
-       lhs12 = lhs.matrix[6], lhs13 = lhs.matrix[7], lhs20 = lhs.matrix[8],
-       lhs21 = lhs.matrix[9], lhs22 = lhs.matrix[10], lhs23 = lhs.matrix[11],
-       lhs30 = lhs.matrix[12], lhs31 = lhs.matrix[13], lhs32 = lhs.matrix[14],
-       lhs33 = lhs.matrix[15];
-
-  auto rhs0 = rhs.matrix[0], rhs1 = rhs.matrix[1], rhs2 = rhs.matrix[2],
-       rhs3 = rhs.matrix[3];
-  result.matrix[0] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[1] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[2] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[3] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[4];
-  rhs1 = rhs.matrix[5];
-  rhs2 = rhs.matrix[6];
-  rhs3 = rhs.matrix[7];
-  result.matrix[4] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[5] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[6] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[7] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[8];
-  rhs1 = rhs.matrix[9];
-  rhs2 = rhs.matrix[10];
-  rhs3 = rhs.matrix[11];
-  result.matrix[8] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[9] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[10] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[11] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[12];
-  rhs1 = rhs.matrix[13];
-  rhs2 = rhs.matrix[14];
-  rhs3 = rhs.matrix[15];
-  result.matrix[12] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[13] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[14] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[15] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
+  if (rhs.isIdentity()) {
+    result.matrix = lhs.matrix;
+    return result;
+  }
+
+  multiplyMatrices(lhs.matrix.data(), rhs.matrix.data(), result.matrix.data());
 
   return result;
 }
@@ -328,8 +441,13 @@ Float const &Transform::at(int i, int j) const {
 }
 
 Point operator*(Point const &point, Transform const &transform) {
-  if (transform == Transform::Identity()) {
-    return point;
+  switch (transform.getKind()) {
+    case TransformKind::Identity:
+      return point;
+    case TransformKind::Translate:
+      return {point.x + transform.matrix[12], point.y + transform.matrix[13]};
+    default:
+      break;
   }
 
   auto result = transform * Vector{point.x, point.y, 0, 1};
@@ -338,25 +456,43 @@ Point operator*(Point const &point, Transform const &transform) {
 }
 
 Rect operator*(Rect const &rect, Transform const &transform) {
-  auto centre = rect.getCenter();
+  auto const &m = transform.matrix;
+
+  switch (transform.getKind()) {
+    case TransformKind::Identity:
+      return rect;
+    case TransformKind::Translate:
+      return {{rect.origin.x + m[12], rect.origin.y + m[13]}, rect.size};
+    case TransformKind::Scale: {
+      // Scaling happens around the center of the rect.
+      auto centre = rect.getCenter();
+      auto width = std::abs(rect.size.width * m[0]);
+      auto height = std::abs(rect.size.height * m[5]);
+      return {
+          {centre.x + m[12] - width / 2, centre.y + m[13] - height / 2},
+          {width, height}};
+    }
+    case TransformKind::Affine2D:
+    case TransformKind::Perspective:
+      break;
+  }
 
-  auto a = Point{rect.origin.x, rect.origin.y} - centre;
-  auto b = Point{rect.getMaxX(), rect.origin.y} - centre;
-  auto c = Point{rect.getMaxX(), rect.getMaxY()} - centre;
-  auto d = Point{rect.origin.x, rect.getMaxY()} - centre;
+  // Like the other kinds, `Perspective` ignores the `w` component here.
+  auto centre = rect.getCenter();
+  auto halfWidth = rect.size.width / 2;
+  auto halfHeight = rect.size.height / 2;
 
-  auto vectorA = transform * Vector{a.x, a.y, 0, 1};
-  auto vectorB = transform * Vector{b.x, b.y, 0, 1};
-  auto vectorC = transform * Vector{c.x, c.y, 0, 1};
-  auto vectorD = transform * Vector{d.x, d.y, 0, 1};
+  Float xs[4] = {-halfWidth, halfWidth, halfWidth, -halfWidth};
+  Float ys[4] = {-halfHeight, -halfHeight, halfHeight, halfHeight};
+  mapPoints(m.data(), xs, ys, 4);
 
-  Point transformedA{vectorA.x + centre.x, vectorA.y + centre.y};
-  Point transformedB{vectorB.x + centre.x, vectorB.y + centre.y};
-  Point transformedC{vectorC.x + centre.x, vectorC.y + centre.y};
-  Point transformedD{vectorD.x + centre.x, vectorD.y + centre.y};
+  auto minX = std::min(std::min(xs[0], xs[1]), std::min(xs[2], xs[3]));
+  auto maxX = std::max(std::max(xs[0], xs[1]), std::max(xs[2], xs[3]));
+  auto minY = std::min(std::min(ys[0], ys[1]), std::min(ys[2], ys[3]));
+  auto maxY = std::max(std::max(ys[0], ys[1]), std::max(ys[2], ys[3]));
 
-  return Rect::boundingRect(
-      transformedA, transformedB, transformedC, transformedD);
+  return {
+      {minX + centre.x, minY + centre.y}, {maxX - minX, maxY - minY}};
 }
 
 Vector operator*(Transform const &transform, Vector const &vector) {
@@ -373,7 +509,7 @@ Vector operator*(Transform const &transform, Vector const &vector) {
 }
 
 Size operator*(Size const &size, Transform const &transform) {
-  if (transform == Transform::Identity()) {
+  if (transform.isIdentity()) {
     return size;
   }
 
@@ -41,6 +41,15 @@ enum class TransformOperationType {
   Rotate,
   Skew
 };
+
+/*
+ * Classification of a transform matrix by what it can do to a point, from the
+ * cheapest to the most expensive to apply.
+ * `Scale` allows translation, `Affine2D` allows any 2D linear part plus
+ * translation; `Perspective` covers everything else.
+ */
+enum class TransformKind { Identity, Translate, Scale, Affine2D, Perspective };
+
 struct TransformOperation {
   TransformOperationType type;
   Float x;
@@ -121,6 +130,19 @@ struct Transform {
       Transform const &lhs,
       Transform const &rhs);
 
+  /*
+   * Returns the cheapest kind describing the matrix.
+   * The kind is derived from the matrix on every call because the matrix can
+   * be mutated directly; that costs a few comparisons and no allocations.
+   */
+  TransformKind getKind() const;
+
+  /*
+   * Returns `true` if the matrix is the identity matrix. Unlike comparing with
+   * `Transform::Identity()`, does not construct a temporary transform.
+   */
+  bool isIdentity() const;
+
   /*
    * Equality operators.
    */
@@ -66,3 +66,63 @@ TEST(TransformTest, scalingAndTranslatingRect) {
   EXPECT_EQ(transformedRect.size.width, 150);
   EXPECT_EQ(transformedRect.size.height, 200);
 }
+
+TEST(TransformTest, classifyingTransforms) {
+  EXPECT_EQ(Transform::Identity().getKind(), TransformKind::Identity);
+  EXPECT_TRUE(Transform::Identity().isIdentity());
+  EXPECT_EQ(
+      Transform::Translate(10, 20, 0).getKind(), TransformKind::Translate);
+  EXPECT_EQ(Transform::Scale(2, 3, 1).getKind(), TransformKind::Scale);
+  EXPECT_EQ(
+      (Transform::Scale(2, 2, 1) * Transform::Translate(10, 20, 0)).getKind(),
+      TransformKind::Scale);
+  EXPECT_EQ(Transform::RotateZ(M_PI_4).getKind(), TransformKind::Affine2D);
+  EXPECT_EQ(Transform::Skew(0.5, 0).getKind(), TransformKind::Affine2D);
+  EXPECT_EQ(Transform::RotateX(M_PI_4).getKind(), TransformKind::Perspective);
+  EXPECT_EQ(Transform::Perspective(100).getKind(), TransformKind::Perspective);
+
+  auto transform = Transform::Identity();
+  transform.matrix[12] = 5;
+  EXPECT_EQ(transform.getKind(), TransformKind::Translate);
+  EXPECT_FALSE(transform.isIdentity());
+}
+
+TEST(TransformTest, multiplyingTransforms) {
+  auto lhs = Transform::RotateZ(0.3) * Transform::Translate(10, 20, 0);
+  auto rhs = Transform::Scale(2, 3, 1) * Transform::Perspective(400);
+  auto result = lhs * rhs;
+
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++) {
+      auto expected = Float{0};
+      for (int k = 0; k < 4; k++) {
+        expected += rhs.at(i, k) * lhs.at(k, j);
+      }
+      ASSERT_NEAR(result.at(i, j), expected, 0.0001);
+    }
+  }
+
+  EXPECT_EQ(result.operations.size(), 4);
+  EXPECT_EQ(lhs * Transform::Identity(), lhs);
+  EXPECT_EQ(Transform::Identity() * rhs, rhs);
+}
+
+TEST(TransformTest, translatingAndSkewingRect) {
+  auto rect = facebook::react::Rect{{10, 20}, {30, 40}};
+
+  auto translatedRect = rect * Transform::Translate(5, -5, 0);
+  EXPECT_EQ(translatedRect.origin.x, 15);
+  EXPECT_EQ(translatedRect.origin.y, 15);
+  EXPECT_EQ(translatedRect.size.width, 30);
+  EXPECT_EQ(translatedRect.size.height, 40);
+
+  auto flippedRect = rect * Transform::Scale(-1, 1, 1);
+  EXPECT_EQ(flippedRect.origin.x, 10);
+  EXPECT_EQ(flippedRect.size.width, 30);
+
+  auto skewedRect = rect * Transform::Skew(M_PI_4, 0);
+  ASSERT_NEAR(skewedRect.origin.x, -10, 0.0001);
+  ASSERT_NEAR(skewedRect.origin.y, 20, 0.0001);
+  ASSERT_NEAR(skewedRect.size.width, 70, 0.0001);
+  ASSERT_NEAR(skewedRect.size.height, 40, 0.0001);
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/graphics/Transform.h>
+
+namespace facebook {
+namespace react {
+
+auto rect = Rect{{10, 20}, {300, 400}};
+auto point = Point{100, 200};
+
+auto identityTransform = Transform::Identity();
+auto translateTransform = Transform::Translate(10, 20, 0);
+auto scaleTransform = Transform::Scale(0.5, 2, 1);
+auto rotateTransform = Transform::RotateZ(0.5);
+auto perspectiveTransform =
+    Transform::Perspective(400) * Transform::RotateX(0.5);
+
+static void transformClassification(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(rotateTransform.getKind());
+  }
+}
+BENCHMARK(transformClassification);
+
+static void transformMultiplication(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(rotateTransform * perspectiveTransform);
+  }
+}
+BENCHMARK(transformMultiplication);
+
+static void transformInterpolation(benchmark::State &state) {
+  auto lhs = Transform::Translate(0, 0, 0) * Transform::Scale(1, 1, 1) *
+      Transform::Rotate(0, 0, 0);
+  auto rhs = Transform::Translate(100, 50, 0) * Transform::Scale(2, 2, 1) *
+      Transform::Rotate(0, 0, 1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Transform::Interpolate(0.5, lhs, rhs));
+  }
+}
+BENCHMARK(transformInterpolation);
+
+static void pointMappingIdentity(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(point * identityTransform);
+  }
+}
+BENCHMARK(pointMappingIdentity);
+
+static void pointMappingTranslate(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(point * translateTransform);
+  }
+}
+BENCHMARK(pointMappingTranslate);
+
+static void sizeMappingIdentity(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(rect.size * identityTransform);
+  }
+}
+BENCHMARK(sizeMappingIdentity);
+
+static void rectMappingIdentity(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(rect * identityTransform);
+  }
+}
+BENCHMARK(rectMappingIdentity);
+
+static void rectMappingTranslate(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(rect * translateTransform);
+  }
+}
+BENCHMARK(rectMappingTranslate);
+
+static void rectMappingScale(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(rect * scaleTransform);
+  }
+}
+BENCHMARK(rectMappingScale);
+
+static void rectMappingAffine2D(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(rect * rotateTransform);
+  }
+}
+BENCHMARK(rectMappingAffine2D);
+
+static void rectMappingPerspective(benchmark::State &state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(rect * perspectiveTransform);
+  }
+}
+BENCHMARK(rectMappingPerspective);
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();
@@ -19,7 +19,7 @@ LOCAL_CFLAGS := \
 
 LOCAL_CFLAGS += -fexceptions -frtti -std=c++14 -Wall
 
-LOCAL_STATIC_LIBRARIES :=
+LOCAL_STATIC_LIBRARIES := reactperflogger
 
 LOCAL_SHARED_LIBRARIES := libbetter libyoga libfolly_futures glog libfolly_json libglog_init libreact_render_core libreact_render_debug libreact_render_components_view libreact_render_components_root libreact_utils
 
@@ -34,4 +34,5 @@ $(call import-module,react/renderer/components/view)
 $(call import-module,react/renderer/core)
 $(call import-module,react/renderer/debug)
 $(call import-module,react/utils)
+$(call import-module,reactperflogger)
 $(call import-module,yogajni)
@@ -193,10 +193,60 @@ static void reorderInPlaceIfNeeded(ShadowViewNodePair::List &pairs) noexcept {
       pairs.begin(), pairs.end(), &shouldFirstPairComesBeforeSecondOne);
 }
 
+/*
+ * Returns the rect which children of the node's children are culled to (see
+ * `ShadowNodeTraits::Trait::CullsContent`), in the coordinate space of the
+ * node's children.
+ */
+static better::optional<Rect> contentCullingRectForShadowNode(
+    ShadowNode const &shadowNode) {
+  if (!shadowNode.getTraits().check(ShadowNodeTraits::Trait::CullsContent)) {
+    return {};
+  }
+
+  auto layoutableShadowNode =
+      traitCast<LayoutableShadowNode const *>(&shadowNode);
+  if (layoutableShadowNode == nullptr) {
+    return {};
+  }
+
+  return layoutableShadowNode->getContentCullingRect();
+}
+
+/*
+ * Returns `true` if the view (with frame in the same coordinate space as the
+ * culling rect) must not be mounted. Descendants which overflow the view's
+ * frame count as part of the view, so that they are not culled with it while
+ * they are visible.
+ */
+static bool isCulled(
+    ShadowView const &shadowView,
+    better::optional<Rect> const &cullingRect) {
+  return cullingRect.has_value() &&
+      shadowView.layoutMetrics != EmptyLayoutMetrics &&
+      !cullingRect->intersects(insetBy(
+          shadowView.layoutMetrics.frame,
+          shadowView.layoutMetrics.overflowInset));
+}
+
+/*
+ * Returns `true` if the children of the pairs must be diffed: the nodes are
+ * different, or the same node is culled differently (e.g. because a parent
+ * scroll view was scrolled).
+ */
+static bool shouldDiffChildren(
+    ShadowViewNodePair const &oldPair,
+    ShadowViewNodePair const &newPair) {
+  return oldPair.shadowNode != newPair.shadowNode ||
+      oldPair.cullingRect != newPair.cullingRect;
+}
+
 static void sliceChildShadowNodeViewPairsRecursivelyV2(
     ShadowViewNodePair::List &pairList,
     Point layoutOffset,
-    ShadowNode const &shadowNode) {
+    ShadowNode const &shadowNode,
+    better::optional<Rect> const &cullingRect,
+    better::optional<Rect> const &contentCullingRect) {
   for (auto const &sharedChildShadowNode : shadowNode.getChildren()) {
     auto &childShadowNode = *sharedChildShadowNode;
 
@@ -215,6 +265,10 @@ static void sliceChildShadowNodeViewPairsRecursivelyV2(
       shadowView.layoutMetrics.frame.origin += layoutOffset;
     }
 
+    if (isCulled(shadowView, cullingRect)) {
+      continue;
+    }
+
     // This might not be a FormsView, or a FormsStackingContext. We let the
     // differ handle removal of flattened views from the Mounting layer and
     // shuffling their children around.
@@ -225,17 +279,24 @@ static void sliceChildShadowNodeViewPairsRecursivelyV2(
     pairList.push_back(
         {shadowView, &childShadowNode, areChildrenFlattened, isConcreteView});
 
+    if (contentCullingRect) {
+      pairList.back().cullingRect = Rect{
+          contentCullingRect->origin - shadowView.layoutMetrics.frame.origin,
+          contentCullingRect->size};
+    }
+
     if (!childShadowNode.getTraits().check(
             ShadowNodeTraits::Trait::FormsStackingContext)) {
       sliceChildShadowNodeViewPairsRecursivelyV2(
-          pairList, origin, childShadowNode);
+          pairList, origin, childShadowNode, cullingRect, contentCullingRect);
     }
   }
 }
 
-ShadowViewNodePair::List sliceChildShadowNodeViewPairsV2(
+static ShadowViewNodePair::List sliceChildShadowNodeViewPairsV2(
     ShadowNode const &shadowNode,
-    bool allowFlattened) {
+    bool allowFlattened,
+    better::optional<Rect> const &cullingRect) {
   auto pairList = ShadowViewNodePair::List{};
 
   if (!shadowNode.getTraits().check(
@@ -245,7 +306,12 @@ ShadowViewNodePair::List sliceChildShadowNodeViewPairsV2(
     return pairList;
   }
 
-  sliceChildShadowNodeViewPairsRecursivelyV2(pairList, {0, 0}, shadowNode);
+  sliceChildShadowNodeViewPairsRecursivelyV2(
+      pairList,
+      {0, 0},
+      shadowNode,
+      cullingRect,
+      contentCullingRectForShadowNode(shadowNode));
 
   // Sorting pairs based on `orderIndex` if needed.
   reorderInPlaceIfNeeded(pairList);
@@ -259,6 +325,24 @@ ShadowViewNodePair::List sliceChildShadowNodeViewPairsV2(
   return pairList;
 }
 
+ShadowViewNodePair::List sliceChildShadowNodeViewPairsV2(
+    ShadowNode const &shadowNode,
+    bool allowFlattened) {
+  return sliceChildShadowNodeViewPairsV2(shadowNode, allowFlattened, {});
+}
+
+/*
+ * Slices children of the pair's node, culled to the pair's culling rect.
+ */
+static ShadowViewNodePair::List sliceChildShadowNodeViewPairsV2(
+    ShadowViewNodePair const &shadowViewNodePair,
+    bool allowFlattened = false) {
+  return sliceChildShadowNodeViewPairsV2(
+      *shadowViewNodePair.shadowNode,
+      allowFlattened,
+      shadowViewNodePair.cullingRect);
+}
+
 /*
  * Before we start to diff, let's make sure all our core data structures are in
  * good shape to deliver the best performance.
@@ -367,7 +451,7 @@ static void calculateShadowViewMutationsFlattener(
 
   // Step 1: iterate through entire tree
   ShadowViewNodePair::List treeChildren =
-      sliceChildShadowNodeViewPairsV2(*node.shadowNode);
+      sliceChildShadowNodeViewPairsV2(node);
 
   DEBUG_LOGS({
     LOG(ERROR) << "Differ Flattener 1.4: "
@@ -494,12 +578,12 @@ static void calculateShadowViewMutationsFlattener(
 
       // Update children if appropriate.
       if (!oldTreeNodePair.flattened && !newTreeNodePair.flattened) {
-        if (oldTreeNodePair.shadowNode != newTreeNodePair.shadowNode) {
+        if (shouldDiffChildren(oldTreeNodePair, newTreeNodePair)) {
           calculateShadowViewMutationsV2(
               mutationInstructionContainer.downwardMutations,
               newTreeNodePair.shadowView,
-              sliceChildShadowNodeViewPairsV2(*oldTreeNodePair.shadowNode),
-              sliceChildShadowNodeViewPairsV2(*newTreeNodePair.shadowNode));
+              sliceChildShadowNodeViewPairsV2(oldTreeNodePair),
+              sliceChildShadowNodeViewPairsV2(newTreeNodePair));
         }
       } else if (oldTreeNodePair.flattened != newTreeNodePair.flattened) {
         // We need to handle one of the children being flattened or unflattened,
@@ -529,7 +613,7 @@ static void calculateShadowViewMutationsFlattener(
             // Memory note: these oldFlattenedNodes all disappear at the end of
             // this "else" block, including any annotations we put on them.
             auto newFlattenedNodes = sliceChildShadowNodeViewPairsV2(
-                *newTreeNodePair.shadowNode, true);
+                newTreeNodePair, true);
             for (size_t i = 0; i < newFlattenedNodes.size(); i++) {
               auto &newChild = newFlattenedNodes[i];
 
@@ -581,7 +665,7 @@ static void calculateShadowViewMutationsFlattener(
             // Memory note: these oldFlattenedNodes all disappear at the end of
             // this "else" block, including any annotations we put on them.
             auto oldFlattenedNodes = sliceChildShadowNodeViewPairsV2(
-                *oldTreeNodePair.shadowNode, true);
+                oldTreeNodePair, true);
             for (size_t i = 0; i < oldFlattenedNodes.size(); i++) {
               auto &oldChild = oldFlattenedNodes[i];
 
@@ -648,7 +732,7 @@ static void calculateShadowViewMutationsFlattener(
                             .destructiveDownwardMutations,
                         oldFlattenedNode.shadowView,
                         sliceChildShadowNodeViewPairsV2(
-                            *oldFlattenedNode.shadowNode),
+                            oldFlattenedNode),
                         {});
                   }
                 }
@@ -740,7 +824,7 @@ static void calculateShadowViewMutationsFlattener(
         calculateShadowViewMutationsV2(
             mutationInstructionContainer.destructiveDownwardMutations,
             treeChildPair.shadowView,
-            sliceChildShadowNodeViewPairsV2(*treeChildPair.shadowNode),
+            sliceChildShadowNodeViewPairsV2(treeChildPair),
             {});
       }
     } else {
@@ -752,7 +836,7 @@ static void calculateShadowViewMutationsFlattener(
             mutationInstructionContainer.downwardMutations,
             treeChildPair.shadowView,
             {},
-            sliceChildShadowNodeViewPairsV2(*treeChildPair.shadowNode));
+            sliceChildShadowNodeViewPairsV2(treeChildPair));
       }
     }
   }
@@ -858,11 +942,11 @@ static void calculateShadowViewMutationsV2(
 
     // Recursively update tree if ShadowNode pointers are not equal
     if (!oldChildPair.flattened &&
-        oldChildPair.shadowNode != newChildPair.shadowNode) {
+        shouldDiffChildren(oldChildPair, newChildPair)) {
       auto oldGrandChildPairs =
-          sliceChildShadowNodeViewPairsV2(*oldChildPair.shadowNode);
+          sliceChildShadowNodeViewPairsV2(oldChildPair);
       auto newGrandChildPairs =
-          sliceChildShadowNodeViewPairsV2(*newChildPair.shadowNode);
+          sliceChildShadowNodeViewPairsV2(newChildPair);
       calculateShadowViewMutationsV2(
           *(newGrandChildPairs.size() ? &downwardMutations
                                       : &destructiveDownwardMutations),
@@ -900,7 +984,7 @@ static void calculateShadowViewMutationsV2(
       calculateShadowViewMutationsV2(
           destructiveDownwardMutations,
           oldChildPair.shadowView,
-          sliceChildShadowNodeViewPairsV2(*oldChildPair.shadowNode),
+          sliceChildShadowNodeViewPairsV2(oldChildPair),
           {});
     }
   } else if (index == oldChildPairs.size()) {
@@ -928,7 +1012,7 @@ static void calculateShadowViewMutationsV2(
           downwardMutations,
           newChildPair.shadowView,
           {},
-          sliceChildShadowNodeViewPairsV2(*newChildPair.shadowNode));
+          sliceChildShadowNodeViewPairsV2(newChildPair));
     }
   } else {
     // Collect map of tags in the new list
@@ -1049,7 +1133,7 @@ static void calculateShadowViewMutationsV2(
               // the children could be listed before the parent, interwoven with
               // children from other nodes, etc.
               auto oldFlattenedNodes = sliceChildShadowNodeViewPairsV2(
-                  *oldChildPair.shadowNode, true);
+                  oldChildPair, true);
               for (size_t i = 0, j = 0;
                    i < oldChildPairs.size() && j < oldFlattenedNodes.size();
                    i++) {
@@ -1095,11 +1179,11 @@ static void calculateShadowViewMutationsV2(
 
           // Update subtrees if View is not flattened, and if node addresses are
           // not equal
-          if (oldChildPair.shadowNode != newChildPair.shadowNode) {
+          if (shouldDiffChildren(oldChildPair, newChildPair)) {
             auto oldGrandChildPairs =
-                sliceChildShadowNodeViewPairsV2(*oldChildPair.shadowNode);
+                sliceChildShadowNodeViewPairsV2(oldChildPair);
             auto newGrandChildPairs =
-                sliceChildShadowNodeViewPairsV2(*newChildPair.shadowNode);
+                sliceChildShadowNodeViewPairsV2(newChildPair);
             calculateShadowViewMutationsV2(
                 *(newGrandChildPairs.size() ? &downwardMutations
                                             : &destructiveDownwardMutations),
@@ -1170,7 +1254,7 @@ static void calculateShadowViewMutationsV2(
               // the children could be listed before the parent, interwoven with
               // children from other nodes, etc.
               auto oldFlattenedNodes = sliceChildShadowNodeViewPairsV2(
-                  *oldChildPair.shadowNode, true);
+                  oldChildPair, true);
               for (size_t i = 0, j = 0;
                    i < oldChildPairs.size() && j < oldFlattenedNodes.size();
                    i++) {
@@ -1258,12 +1342,12 @@ static void calculateShadowViewMutationsV2(
             }
           }
           if (!oldChildPair.flattened &&
-              oldChildPair.shadowNode != newChildPair.shadowNode) {
+              shouldDiffChildren(oldChildPair, newChildPair)) {
             // Update subtrees
             auto oldGrandChildPairs =
-                sliceChildShadowNodeViewPairsV2(*oldChildPair.shadowNode);
+                sliceChildShadowNodeViewPairsV2(oldChildPair);
             auto newGrandChildPairs =
-                sliceChildShadowNodeViewPairsV2(*newChildPair.shadowNode);
+                sliceChildShadowNodeViewPairsV2(newChildPair);
             calculateShadowViewMutationsV2(
                 *(newGrandChildPairs.size() ? &downwardMutations
                                             : &destructiveDownwardMutations),
@@ -1364,7 +1448,7 @@ static void calculateShadowViewMutationsV2(
         calculateShadowViewMutationsV2(
             destructiveDownwardMutations,
             oldChildPair.shadowView,
-            sliceChildShadowNodeViewPairsV2(*oldChildPair.shadowNode),
+            sliceChildShadowNodeViewPairsV2(oldChildPair),
             {});
       }
     }
@@ -1407,7 +1491,7 @@ static void calculateShadowViewMutationsV2(
           downwardMutations,
           newChildPair.shadowView,
           {},
-          sliceChildShadowNodeViewPairsV2(*newChildPair.shadowNode));
+          sliceChildShadowNodeViewPairsV2(newChildPair));
     }
   }
 
@@ -1445,7 +1529,9 @@ static void calculateShadowViewMutationsV2(
 static void sliceChildShadowNodeViewPairsRecursively(
     ShadowViewNodePair::List &pairList,
     Point layoutOffset,
-    ShadowNode const &shadowNode) {
+    ShadowNode const &shadowNode,
+    better::optional<Rect> const &cullingRect,
+    better::optional<Rect> const &contentCullingRect) {
   for (auto const &sharedChildShadowNode : shadowNode.getChildren()) {
     auto &childShadowNode = *sharedChildShadowNode;
 
@@ -1464,23 +1550,37 @@ static void sliceChildShadowNodeViewPairsRecursively(
       shadowView.layoutMetrics.frame.origin += layoutOffset;
     }
 
+    if (isCulled(shadowView, cullingRect)) {
+      continue;
+    }
+
+    auto childCullingRect = better::optional<Rect>{};
+    if (contentCullingRect) {
+      childCullingRect = Rect{
+          contentCullingRect->origin - shadowView.layoutMetrics.frame.origin,
+          contentCullingRect->size};
+    }
+
     if (childShadowNode.getTraits().check(
             ShadowNodeTraits::Trait::FormsStackingContext)) {
       pairList.push_back({shadowView, &childShadowNode});
+      pairList.back().cullingRect = childCullingRect;
     } else {
       if (childShadowNode.getTraits().check(
               ShadowNodeTraits::Trait::FormsView)) {
         pairList.push_back({shadowView, &childShadowNode});
+        pairList.back().cullingRect = childCullingRect;
       }
 
       sliceChildShadowNodeViewPairsRecursively(
-          pairList, origin, childShadowNode);
+          pairList, origin, childShadowNode, cullingRect, contentCullingRect);
     }
   }
 }
 
-ShadowViewNodePair::List sliceChildShadowNodeViewPairs(
-    ShadowNode const &shadowNode) {
+static ShadowViewNodePair::List sliceChildShadowNodeViewPairs(
+    ShadowNode const &shadowNode,
+    better::optional<Rect> const &cullingRect) {
   auto pairList = ShadowViewNodePair::List{};
 
   if (!shadowNode.getTraits().check(
@@ -1489,11 +1589,30 @@ ShadowViewNodePair::List sliceChildShadowNodeViewPairs(
     return pairList;
   }
 
-  sliceChildShadowNodeViewPairsRecursively(pairList, {0, 0}, shadowNode);
+  sliceChildShadowNodeViewPairsRecursively(
+      pairList,
+      {0, 0},
+      shadowNode,
+      cullingRect,
+      contentCullingRectForShadowNode(shadowNode));
 
   return pairList;
 }
 
+ShadowViewNodePair::List sliceChildShadowNodeViewPairs(
+    ShadowNode const &shadowNode) {
+  return sliceChildShadowNodeViewPairs(shadowNode, {});
+}
+
+/*
+ * Slices children of the pair's node, culled to the pair's culling rect.
+ */
+static ShadowViewNodePair::List sliceChildShadowNodeViewPairs(
+    ShadowViewNodePair const &shadowViewNodePair) {
+  return sliceChildShadowNodeViewPairs(
+      *shadowViewNodePair.shadowNode, shadowViewNodePair.cullingRect);
+}
+
 static void calculateShadowViewMutations(
     ShadowViewMutation::List &mutations,
     ShadowView const &parentShadowView,
@@ -1554,9 +1673,9 @@ static void calculateShadowViewMutations(
     }
 
     auto oldGrandChildPairs =
-        sliceChildShadowNodeViewPairs(*oldChildPair.shadowNode);
+        sliceChildShadowNodeViewPairs(oldChildPair);
     auto newGrandChildPairs =
-        sliceChildShadowNodeViewPairs(*newChildPair.shadowNode);
+        sliceChildShadowNodeViewPairs(newChildPair);
     calculateShadowViewMutations(
         *(newGrandChildPairs.size() ? &downwardMutations
                                     : &destructiveDownwardMutations),
@@ -1589,7 +1708,7 @@ static void calculateShadowViewMutations(
       calculateShadowViewMutations(
           destructiveDownwardMutations,
           oldChildPair.shadowView,
-          sliceChildShadowNodeViewPairs(*oldChildPair.shadowNode),
+          sliceChildShadowNodeViewPairs(oldChildPair),
           {});
     }
   } else if (index == oldChildPairs.size()) {
@@ -1613,7 +1732,7 @@ static void calculateShadowViewMutations(
           downwardMutations,
           newChildPair.shadowView,
           {},
-          sliceChildShadowNodeViewPairs(*newChildPair.shadowNode));
+          sliceChildShadowNodeViewPairs(newChildPair));
     }
   } else {
     // Collect map of tags in the new list
@@ -1669,11 +1788,11 @@ static void calculateShadowViewMutations(
           }
 
           // Update subtrees
-          if (oldChildPair.shadowNode != newChildPair.shadowNode) {
+          if (shouldDiffChildren(oldChildPair, newChildPair)) {
             auto oldGrandChildPairs =
-                sliceChildShadowNodeViewPairs(*oldChildPair.shadowNode);
+                sliceChildShadowNodeViewPairs(oldChildPair);
             auto newGrandChildPairs =
-                sliceChildShadowNodeViewPairs(*newChildPair.shadowNode);
+                sliceChildShadowNodeViewPairs(newChildPair);
             calculateShadowViewMutations(
                 *(newGrandChildPairs.size() ? &downwardMutations
                                             : &destructiveDownwardMutations),
@@ -1718,11 +1837,11 @@ static void calculateShadowViewMutations(
           }
 
           // Update subtrees
-          if (oldChildPair.shadowNode != newChildPair.shadowNode) {
+          if (shouldDiffChildren(oldChildPair, newChildPair)) {
             auto oldGrandChildPairs =
-                sliceChildShadowNodeViewPairs(*oldChildPair.shadowNode);
+                sliceChildShadowNodeViewPairs(oldChildPair);
             auto newGrandChildPairs =
-                sliceChildShadowNodeViewPairs(*newChildPair.shadowNode);
+                sliceChildShadowNodeViewPairs(newChildPair);
             calculateShadowViewMutations(
                 *(newGrandChildPairs.size() ? &downwardMutations
                                             : &destructiveDownwardMutations),
@@ -1758,7 +1877,7 @@ static void calculateShadowViewMutations(
           calculateShadowViewMutations(
               destructiveDownwardMutations,
               oldChildPair.shadowView,
-              sliceChildShadowNodeViewPairs(*oldChildPair.shadowNode),
+              sliceChildShadowNodeViewPairs(oldChildPair),
               {});
 
           oldIndex++;
@@ -1807,7 +1926,7 @@ static void calculateShadowViewMutations(
           downwardMutations,
           newChildPair.shadowView,
           {},
-          sliceChildShadowNodeViewPairs(*newChildPair.shadowNode));
+          sliceChildShadowNodeViewPairs(newChildPair));
     }
   }
 
@@ -290,6 +290,10 @@ CommitStatus ShadowTree::tryCommit(
     CommitOptions commitOptions) const {
   SystraceSection s("ShadowTree::tryCommit");
 
+  // Nodes cloned by the transaction and by commit hooks (e.g. layout) belong
+  // to this surface.
+  SurfaceArena::Scope arenaScope(arena_.get());
+
   auto telemetry = TransactionTelemetry{};
   telemetry.willCommit();
 
@@ -15,6 +15,7 @@
 #include <react/renderer/core/LayoutConstraints.h>
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/core/SurfaceArena.h>
 #include <react/renderer/mounting/MountingCoordinator.h>
 #include <react/renderer/mounting/ShadowTreeDelegate.h>
 #include <react/renderer/mounting/ShadowTreeRevision.h>
@@ -107,6 +108,22 @@ class ShadowTree final {
     enableReparentingDetection_ = value;
   }
 
+  /*
+   * Sets an arena which shadow nodes, props and states cloned during commits
+   * of the tree are allocated from. Must be called before the tree is
+   * registered and accessible from other threads.
+   */
+  void setArena(SurfaceArena::Shared arena) {
+    arena_ = std::move(arena);
+  }
+
+  /*
+   * Returns the arena of the tree or `nullptr` if the tree does not use one.
+   */
+  SurfaceArena::Shared const &getArena() const {
+    return arena_;
+  }
+
  private:
   void emitLayoutEvents(
       std::vector<LayoutableShadowNode const *> &affectedLayoutableNodes) const;
@@ -117,6 +134,7 @@ class ShadowTree final {
   mutable ShadowTreeRevision currentRevision_; // Protected by `commitMutex_`.
   MountingCoordinator::Shared mountingCoordinator_;
   bool enableReparentingDetection_{false};
+  SurfaceArena::Shared arena_;
 };
 
 } // namespace react
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <better/optional.h>
 #include <better/small_vector.h>
 #include <folly/Hash.h>
 #include <react/renderer/core/EventEmitter.h>
@@ -74,6 +75,13 @@ struct ShadowViewNodePair final {
 
   bool inOtherTree{false};
 
+  /*
+   * If set, only children whose frames intersect the rect (in the coordinate
+   * space of children's frames) are mounted. Set on children of nodes with
+   * `CullsContent` trait.
+   */
+  better::optional<Rect> cullingRect{};
+
   /*
    * The stored pointer to `ShadowNode` represents an identity of the pair.
    */
@@ -12,6 +12,27 @@
 namespace facebook {
 namespace react {
 
+constexpr size_t SurfaceTelemetry::kMaxNumberOfRecordedSlowTransactions;
+constexpr int SurfaceTelemetry::kNumberOfStages;
+
+static TelemetryDuration durationBetween(
+    TelemetryTimePoint start,
+    TelemetryTimePoint end) {
+  if (start == kTelemetryUndefinedTimePoint ||
+      end == kTelemetryUndefinedTimePoint) {
+    return {};
+  }
+  return std::max<TelemetryDuration>(end - start, TelemetryDuration{});
+}
+
+TelemetryDuration SurfaceTelemetry::SlowTransaction::getStageTime(
+    Stage stage) const {
+  return stageTimes[static_cast<int>(stage)];
+}
+
+SurfaceTelemetry::SurfaceTelemetry(TelemetryDuration frameBudget)
+    : frameBudget_(frameBudget) {}
+
 void SurfaceTelemetry::incorporate(
     TransactionTelemetry const &telemetry,
     int numberOfMutations) {
@@ -23,6 +44,8 @@ void SurfaceTelemetry::incorporate(
   numberOfTransactions_++;
   numberOfMutations_ += numberOfMutations;
   numberOfTextMeasurements_ += telemetry.getNumberOfTextMeasurements();
+  numberOfPremeasuredTextMeasurements_ +=
+      telemetry.getNumberOfPremeasuredTextMeasurements();
   lastRevisionNumber_ = telemetry.getRevisionNumber();
 
   while (recentTransactionTelemetries_.size() >=
@@ -31,6 +54,53 @@ void SurfaceTelemetry::incorporate(
   }
 
   recentTransactionTelemetries_.push_back(telemetry);
+
+  // Commit includes layout, and layout includes text measurement; stage
+  // durations are made exclusive so they add up to the total.
+  auto commitTime = durationBetween(
+      telemetry.getCommitStartTime(), telemetry.getCommitEndTime());
+  auto layoutTime = durationBetween(
+      telemetry.getLayoutStartTime(), telemetry.getLayoutEndTime());
+  auto textMeasureTime = std::min(telemetry.getTextMeasureTime(), layoutTime);
+  layoutTime = std::min(layoutTime, commitTime);
+
+  auto stageTimes = std::array<TelemetryDuration, kNumberOfStages>{};
+  stageTimes[static_cast<int>(Stage::Commit)] = commitTime - layoutTime;
+  stageTimes[static_cast<int>(Stage::Layout)] = layoutTime - textMeasureTime;
+  stageTimes[static_cast<int>(Stage::TextMeasure)] = textMeasureTime;
+  stageTimes[static_cast<int>(Stage::Diff)] = durationBetween(
+      telemetry.getDiffStartTime(), telemetry.getDiffEndTime());
+  stageTimes[static_cast<int>(Stage::Mount)] = durationBetween(
+      telemetry.getMountStartTime(), telemetry.getMountEndTime());
+
+  auto totalTime = TelemetryDuration{};
+  auto dominantStage = 0;
+  for (auto i = 0; i < kNumberOfStages; i++) {
+    histograms_[i].record(stageTimes[i]);
+    totalTime += stageTimes[i];
+    if (stageTimes[i] > stageTimes[dominantStage]) {
+      dominantStage = i;
+    }
+  }
+
+  if (totalTime <= frameBudget_) {
+    return;
+  }
+
+  numberOfSlowTransactions_++;
+
+  while (recentSlowTransactions_.size() >=
+         kMaxNumberOfRecordedSlowTransactions) {
+    recentSlowTransactions_.erase(recentSlowTransactions_.begin());
+  }
+
+  recentSlowTransactions_.push_back(
+      {telemetry.getRevisionNumber(),
+       totalTime,
+       stageTimes,
+       static_cast<Stage>(dominantStage),
+       numberOfMutations,
+       telemetry.getNumberOfTextMeasurements()});
 }
 
 TelemetryDuration SurfaceTelemetry::getLayoutTime() const {
@@ -61,6 +131,10 @@ int SurfaceTelemetry::getNumberOfTextMeasurements() const {
   return numberOfTextMeasurements_;
 }
 
+int SurfaceTelemetry::getNumberOfPremeasuredTextMeasurements() const {
+  return numberOfPremeasuredTextMeasurements_;
+}
+
 int SurfaceTelemetry::getLastRevisionNumber() const {
   return lastRevisionNumber_;
 }
@@ -76,5 +150,22 @@ SurfaceTelemetry::getRecentTransactionTelemetries() const {
   return result;
 }
 
+TelemetryHistogram const &SurfaceTelemetry::getHistogram(Stage stage) const {
+  return histograms_[static_cast<int>(stage)];
+}
+
+TelemetryDuration SurfaceTelemetry::getFrameBudget() const {
+  return frameBudget_;
+}
+
+int SurfaceTelemetry::getNumberOfSlowTransactions() const {
+  return numberOfSlowTransactions_;
+}
+
+std::vector<SurfaceTelemetry::SlowTransaction>
+SurfaceTelemetry::getRecentSlowTransactions() const {
+  return {recentSlowTransactions_.begin(), recentSlowTransactions_.end()};
+}
+
 } // namespace react
 } // namespace facebook
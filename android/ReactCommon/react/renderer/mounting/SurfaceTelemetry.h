@@ -8,8 +8,10 @@
 #pragma once
 
 #include <better/small_vector.h>
+#include <array>
 #include <vector>
 
+#include <react/renderer/mounting/TelemetryHistogram.h>
 #include <react/renderer/mounting/TransactionTelemetry.h>
 #include <react/utils/Telemetry.h>
 
@@ -23,6 +25,33 @@ namespace react {
 class SurfaceTelemetry final {
  public:
   constexpr static size_t kMaxNumberOfRecordedCommitTelemetries = 16;
+  constexpr static size_t kMaxNumberOfRecordedSlowTransactions = 16;
+
+  /*
+   * Stages of a transaction. Durations of stages don't overlap: the commit
+   * stage excludes layout and the layout stage excludes text measurement.
+   */
+  enum class Stage { Commit, Layout, TextMeasure, Diff, Mount };
+  constexpr static int kNumberOfStages = 5;
+
+  /*
+   * A transaction which took longer (commit, diff and mount combined) than
+   * the frame budget, with a breakdown of where the time went.
+   */
+  class SlowTransaction final {
+   public:
+    int revisionNumber;
+    TelemetryDuration totalTime;
+    std::array<TelemetryDuration, kNumberOfStages> stageTimes;
+    Stage dominantStage;
+    int numberOfMutations;
+    int numberOfTextMeasurements;
+
+    TelemetryDuration getStageTime(Stage stage) const;
+  };
+
+  SurfaceTelemetry(
+      TelemetryDuration frameBudget = std::chrono::milliseconds(16));
 
   /*
    * Metrics
@@ -35,10 +64,21 @@ class SurfaceTelemetry final {
   int getNumberOfTransactions() const;
   int getNumberOfMutations() const;
   int getNumberOfTextMeasurements() const;
+  int getNumberOfPremeasuredTextMeasurements() const;
   int getLastRevisionNumber() const;
 
   std::vector<TransactionTelemetry> getRecentTransactionTelemetries() const;
 
+  /*
+   * Distribution of durations of the given stage over all transactions.
+   * Histograms of different surfaces can be merged.
+   */
+  TelemetryHistogram const &getHistogram(Stage stage) const;
+
+  TelemetryDuration getFrameBudget() const;
+  int getNumberOfSlowTransactions() const;
+  std::vector<SlowTransaction> getRecentSlowTransactions() const;
+
   /*
    * Incorporate data from given transaction telemetry into aggregated data
    * for the Surface.
@@ -56,11 +96,19 @@ class SurfaceTelemetry final {
   int numberOfTransactions_{};
   int numberOfMutations_{};
   int numberOfTextMeasurements_{};
+  int numberOfPremeasuredTextMeasurements_{};
   int lastRevisionNumber_{};
 
   better::
       small_vector<TransactionTelemetry, kMaxNumberOfRecordedCommitTelemetries>
           recentTransactionTelemetries_{};
+
+  std::array<TelemetryHistogram, kNumberOfStages> histograms_{};
+
+  TelemetryDuration frameBudget_;
+  int numberOfSlowTransactions_{};
+  better::small_vector<SlowTransaction, kMaxNumberOfRecordedSlowTransactions>
+      recentSlowTransactions_{};
 };
 
 } // namespace react
@@ -8,6 +8,7 @@
 #include "TelemetryController.h"
 
 #include <react/renderer/mounting/MountingCoordinator.h>
+#include <reactperflogger/StartupTimeline.h>
 
 namespace facebook {
 namespace react {
@@ -16,6 +17,27 @@ TelemetryController::TelemetryController(
     MountingCoordinator const &mountingCoordinator) noexcept
     : mountingCoordinator_(mountingCoordinator) {}
 
+static void logFirstTransaction(
+    SurfaceId surfaceId,
+    TransactionTelemetry const &telemetry) {
+  if (!StartupTimeline::isRecording()) {
+    return;
+  }
+
+  auto tag = std::to_string(surfaceId);
+  auto log = [&](char const *name, TelemetryTimePoint time) {
+    if (time != kTelemetryUndefinedTimePoint) {
+      StartupTimeline::logEvent(
+          name, tag.c_str(), StartupTimeline::kDefaultInstanceKey, time);
+    }
+  };
+
+  log(StartupTimeline::kFirstCommitStart, telemetry.getCommitStartTime());
+  log(StartupTimeline::kFirstCommitEnd, telemetry.getCommitEndTime());
+  log(StartupTimeline::kFirstMountStart, telemetry.getMountStartTime());
+  log(StartupTimeline::kFirstMountEnd, telemetry.getMountEndTime());
+}
+
 bool TelemetryController::pullTransaction(
     std::function<void(MountingTransactionMetadata metadata)> willMount,
     std::function<void(ShadowViewMutationList const &mutations)> doMount,
@@ -42,6 +64,10 @@ bool TelemetryController::pullTransaction(
   doMount(std::move(transaction.getMutations()));
   telemetry.didMount();
 
+  if (compoundTelemetry.getNumberOfTransactions() == 0) {
+    logFirstTransaction(surfaceId, telemetry);
+  }
+
   compoundTelemetry.incorporate(telemetry, numberOfMutations);
 
   didMount({surfaceId, number, telemetry, compoundTelemetry});
@@ -53,5 +79,10 @@ bool TelemetryController::pullTransaction(
   return true;
 }
 
+SurfaceTelemetry TelemetryController::getSurfaceTelemetry() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return compoundTelemetry_;
+}
+
 } // namespace react
 } // namespace facebook
@@ -47,6 +47,13 @@ class TelemetryController final {
       std::function<void(ShadowViewMutationList const &mutations)> doMount,
       std::function<void(MountingTransactionMetadata metadata)> didMount) const;
 
+  /*
+   * Returns telemetry aggregated from all transactions pulled so far,
+   * including per-stage latency histograms and recent slow transactions.
+   * Can be called from any thread.
+   */
+  SurfaceTelemetry getSurfaceTelemetry() const;
+
  private:
   MountingCoordinator const &mountingCoordinator_;
   mutable SurfaceTelemetry compoundTelemetry_{};
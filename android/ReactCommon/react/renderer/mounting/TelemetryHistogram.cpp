@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "TelemetryHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace facebook {
+namespace react {
+
+constexpr int TelemetryHistogram::kSubBucketBits;
+constexpr int TelemetryHistogram::kNumberOfSubBuckets;
+constexpr int TelemetryHistogram::kMaxExponent;
+constexpr int TelemetryHistogram::kNumberOfBuckets;
+
+static int highestBit(uint64_t value) {
+  auto bit = 0;
+  while (value >>= 1) {
+    bit++;
+  }
+  return bit;
+}
+
+int TelemetryHistogram::bucketIndex(uint64_t microseconds) {
+  if (microseconds < kNumberOfSubBuckets) {
+    return static_cast<int>(microseconds);
+  }
+
+  auto exponent = highestBit(microseconds);
+  if (exponent > kMaxExponent) {
+    return kNumberOfBuckets - 1;
+  }
+
+  auto subBucket = static_cast<int>(
+      (microseconds >> (exponent - kSubBucketBits)) &
+      (kNumberOfSubBuckets - 1));
+  return kNumberOfSubBuckets * (exponent - kSubBucketBits + 1) + subBucket;
+}
+
+uint64_t TelemetryHistogram::bucketLowerBound(int index) {
+  if (index < kNumberOfSubBuckets) {
+    return static_cast<uint64_t>(index);
+  }
+
+  auto exponent = index / kNumberOfSubBuckets + kSubBucketBits - 1;
+  auto subBucket = static_cast<uint64_t>(index % kNumberOfSubBuckets);
+  return (uint64_t{1} << exponent) +
+      (subBucket << (exponent - kSubBucketBits));
+}
+
+void TelemetryHistogram::record(TelemetryDuration duration) {
+  auto microseconds = std::max<int64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(duration).count(),
+      0);
+  counts_[bucketIndex(static_cast<uint64_t>(microseconds))]++;
+  count_++;
+  total_ += duration;
+  max_ = std::max(max_, duration);
+}
+
+void TelemetryHistogram::merge(TelemetryHistogram const &histogram) {
+  for (auto i = 0; i < kNumberOfBuckets; i++) {
+    counts_[i] += histogram.counts_[i];
+  }
+  count_ += histogram.count_;
+  total_ += histogram.total_;
+  max_ = std::max(max_, histogram.max_);
+}
+
+int TelemetryHistogram::getCount() const {
+  return count_;
+}
+
+TelemetryDuration TelemetryHistogram::getTotal() const {
+  return total_;
+}
+
+TelemetryDuration TelemetryHistogram::getMax() const {
+  return max_;
+}
+
+TelemetryDuration TelemetryHistogram::getPercentile(double percentile) const {
+  if (count_ == 0) {
+    return {};
+  }
+
+  auto rank = static_cast<int64_t>(
+      std::ceil(std::min(std::max(percentile, 0.0), 100.0) / 100 * count_));
+  rank = std::max<int64_t>(rank, 1);
+
+  auto accumulated = int64_t{0};
+  for (auto i = 0; i < kNumberOfBuckets; i++) {
+    accumulated += counts_[i];
+    if (accumulated >= rank) {
+      auto upperBound = i + 1 < kNumberOfBuckets
+          ? TelemetryDuration{std::chrono::microseconds(
+                bucketLowerBound(i + 1))}
+          : max_;
+      return std::min(upperBound, max_);
+    }
+  }
+  return max_;
+}
+
+std::vector<TelemetryHistogram::Bucket> TelemetryHistogram::getBuckets()
+    const {
+  auto buckets = std::vector<Bucket>{};
+  for (auto i = 0; i < kNumberOfBuckets; i++) {
+    if (counts_[i] == 0) {
+      continue;
+    }
+    auto lowerBound = std::chrono::microseconds(bucketLowerBound(i));
+    auto upperBound = i + 1 < kNumberOfBuckets
+        ? TelemetryDuration{std::chrono::microseconds(bucketLowerBound(i + 1))}
+        : std::max<TelemetryDuration>(max_, lowerBound);
+    buckets.push_back({lowerBound, upperBound, static_cast<int>(counts_[i])});
+  }
+  return buckets;
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <react/utils/Telemetry.h>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Fixed-size histogram of durations with log-linear buckets: every power of
+ * two (of microseconds) is split into `kNumberOfSubBuckets` equal buckets,
+ * so a bucket is never wider than 1/8 of its lower bound (durations under
+ * 8 microseconds are recorded exactly).
+ * Histograms can be merged, e.g. to aggregate them across surfaces.
+ */
+class TelemetryHistogram final {
+ public:
+  static constexpr int kSubBucketBits = 3;
+  static constexpr int kNumberOfSubBuckets = 1 << kSubBucketBits;
+  /*
+   * Durations over 2^31 microseconds (about 36 minutes) are recorded in the
+   * last bucket.
+   */
+  static constexpr int kMaxExponent = 31;
+  static constexpr int kNumberOfBuckets =
+      kNumberOfSubBuckets * (kMaxExponent - kSubBucketBits + 2);
+
+  class Bucket final {
+   public:
+    TelemetryDuration lowerBound;
+    TelemetryDuration upperBound;
+    int count;
+  };
+
+  void record(TelemetryDuration duration);
+  void merge(TelemetryHistogram const &histogram);
+
+  int getCount() const;
+  TelemetryDuration getTotal() const;
+  TelemetryDuration getMax() const;
+
+  /*
+   * Returns an estimation of the percentile (between 0 and 100) of recorded
+   * durations: the upper bound of the bucket containing it (clamped to the
+   * maximum recorded duration). Returns zero if nothing was recorded.
+   */
+  TelemetryDuration getPercentile(double percentile) const;
+
+  /*
+   * Returns buckets which have some durations recorded, in ascending order.
+   */
+  std::vector<Bucket> getBuckets() const;
+
+ private:
+  static int bucketIndex(uint64_t microseconds);
+  static uint64_t bucketLowerBound(int index);
+
+  std::array<uint32_t, kNumberOfBuckets> counts_{};
+  int count_{0};
+  TelemetryDuration total_{};
+  TelemetryDuration max_{};
+};
+
+} // namespace react
+} // namespace facebook
@@ -56,8 +56,19 @@ void TransactionTelemetry::willLayout() {
   layoutStartTime_ = telemetryTimePointNow();
 }
 
-void TransactionTelemetry::didMeasureText() {
+void TransactionTelemetry::willMeasureText() {
+  textMeasureStartTime_ = telemetryTimePointNow();
+}
+
+void TransactionTelemetry::didMeasureText(bool wasPremeasured) {
   numberOfTextMeasurements_++;
+  if (wasPremeasured) {
+    numberOfPremeasuredTextMeasurements_++;
+  }
+  if (textMeasureStartTime_ != kTelemetryUndefinedTimePoint) {
+    textMeasureTime_ += telemetryTimePointNow() - textMeasureStartTime_;
+    textMeasureStartTime_ = kTelemetryUndefinedTimePoint;
+  }
 }
 
 void TransactionTelemetry::didLayout() {
@@ -130,10 +141,18 @@ TelemetryTimePoint TransactionTelemetry::getMountEndTime() const {
   return mountEndTime_;
 }
 
+TelemetryDuration TransactionTelemetry::getTextMeasureTime() const {
+  return textMeasureTime_;
+}
+
 int TransactionTelemetry::getNumberOfTextMeasurements() const {
   return numberOfTextMeasurements_;
 }
 
+int TransactionTelemetry::getNumberOfPremeasuredTextMeasurements() const {
+  return numberOfPremeasuredTextMeasurements_;
+}
+
 int TransactionTelemetry::getRevisionNumber() const {
   return revisionNumber_;
 }
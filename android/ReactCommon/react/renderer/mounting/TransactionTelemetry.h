@@ -36,7 +36,8 @@ class TransactionTelemetry final {
   void willCommit();
   void didCommit();
   void willLayout();
-  void didMeasureText();
+  void willMeasureText();
+  void didMeasureText(bool wasPremeasured = false);
   void didLayout();
   void willMount();
   void didMount();
@@ -55,7 +56,13 @@ class TransactionTelemetry final {
   TelemetryTimePoint getMountStartTime() const;
   TelemetryTimePoint getMountEndTime() const;
 
+  /*
+   * Total time spent between `willMeasureText` and `didMeasureText` calls.
+   */
+  TelemetryDuration getTextMeasureTime() const;
+
   int getNumberOfTextMeasurements() const;
+  int getNumberOfPremeasuredTextMeasurements() const;
   int getRevisionNumber() const;
 
  private:
@@ -67,8 +74,12 @@ class TransactionTelemetry final {
   TelemetryTimePoint layoutEndTime_{kTelemetryUndefinedTimePoint};
   TelemetryTimePoint mountStartTime_{kTelemetryUndefinedTimePoint};
   TelemetryTimePoint mountEndTime_{kTelemetryUndefinedTimePoint};
+  TelemetryTimePoint textMeasureStartTime_{kTelemetryUndefinedTimePoint};
+
+  TelemetryDuration textMeasureTime_{};
 
   int numberOfTextMeasurements_{0};
+  int numberOfPremeasuredTextMeasurements_{0};
   int revisionNumber_{0};
 };
 
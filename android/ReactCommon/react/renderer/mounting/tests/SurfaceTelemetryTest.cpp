@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/mounting/SurfaceTelemetry.h>
+#include <react/renderer/mounting/TelemetryHistogram.h>
+
+using namespace facebook::react;
+
+template <typename ClockT>
+void sleep(double durationInSeconds) {
+  auto timepoint = ClockT::now() +
+      std::chrono::milliseconds((long long)(durationInSeconds * 1000));
+  while (ClockT::now() < timepoint) {
+  }
+}
+
+TEST(SurfaceTelemetryTest, histogramPercentiles) {
+  auto histogram = TelemetryHistogram{};
+  EXPECT_EQ(histogram.getPercentile(50), TelemetryDuration{});
+
+  for (auto i = 1; i <= 100; i++) {
+    histogram.record(std::chrono::microseconds(i * 100));
+  }
+
+  EXPECT_EQ(histogram.getCount(), 100);
+  EXPECT_EQ(histogram.getMax(), std::chrono::microseconds(10000));
+  EXPECT_EQ(histogram.getTotal(), std::chrono::microseconds(505000));
+
+  // Buckets are at most 1/8 of their lower bound wide.
+  auto p50 = histogram.getPercentile(50);
+  EXPECT_GE(p50, std::chrono::microseconds(5000));
+  EXPECT_LE(p50, std::chrono::microseconds(5000 * 9 / 8));
+  auto p99 = histogram.getPercentile(99);
+  EXPECT_GE(p99, std::chrono::microseconds(9900));
+  EXPECT_LE(p99, histogram.getMax());
+  EXPECT_EQ(histogram.getPercentile(100), histogram.getMax());
+}
+
+TEST(SurfaceTelemetryTest, histogramBuckets) {
+  auto histogram = TelemetryHistogram{};
+  histogram.record(std::chrono::microseconds(3));
+  histogram.record(std::chrono::microseconds(3));
+  histogram.record(std::chrono::microseconds(1000));
+
+  auto buckets = histogram.getBuckets();
+  ASSERT_EQ(buckets.size(), 2);
+  EXPECT_EQ(buckets[0].lowerBound, std::chrono::microseconds(3));
+  EXPECT_EQ(buckets[0].upperBound, std::chrono::microseconds(4));
+  EXPECT_EQ(buckets[0].count, 2);
+  EXPECT_LE(buckets[1].lowerBound, std::chrono::microseconds(1000));
+  EXPECT_GT(buckets[1].upperBound, std::chrono::microseconds(1000));
+  EXPECT_EQ(buckets[1].count, 1);
+}
+
+TEST(SurfaceTelemetryTest, histogramMerge) {
+  auto histogramA = TelemetryHistogram{};
+  auto histogramB = TelemetryHistogram{};
+  histogramA.record(std::chrono::milliseconds(1));
+  histogramB.record(std::chrono::milliseconds(30));
+  histogramB.record(std::chrono::hours(2));
+
+  histogramA.merge(histogramB);
+
+  EXPECT_EQ(histogramA.getCount(), 3);
+  EXPECT_EQ(histogramA.getMax(), std::chrono::hours(2));
+  EXPECT_EQ(histogramA.getBuckets().size(), 3);
+  EXPECT_EQ(histogramA.getPercentile(0), std::chrono::microseconds(1024));
+}
+
+TEST(SurfaceTelemetryTest, slowTransactions) {
+  auto surfaceTelemetry = SurfaceTelemetry{std::chrono::milliseconds(50)};
+
+  auto fastTelemetry = TransactionTelemetry{};
+  fastTelemetry.willCommit();
+  fastTelemetry.willLayout();
+  fastTelemetry.didLayout();
+  fastTelemetry.didCommit();
+  fastTelemetry.willDiff();
+  fastTelemetry.didDiff();
+  fastTelemetry.willMount();
+  fastTelemetry.didMount();
+  surfaceTelemetry.incorporate(fastTelemetry, 1);
+
+  auto slowTelemetry = TransactionTelemetry{};
+  slowTelemetry.setRevisionNumber(2);
+  slowTelemetry.willCommit();
+  slowTelemetry.willLayout();
+  slowTelemetry.willMeasureText();
+  sleep<TelemetryClock>(0.1);
+  slowTelemetry.didMeasureText();
+  slowTelemetry.didLayout();
+  slowTelemetry.didCommit();
+  slowTelemetry.willDiff();
+  slowTelemetry.didDiff();
+  slowTelemetry.willMount();
+  slowTelemetry.didMount();
+  surfaceTelemetry.incorporate(slowTelemetry, 42);
+
+  EXPECT_EQ(surfaceTelemetry.getNumberOfSlowTransactions(), 1);
+  auto slowTransactions = surfaceTelemetry.getRecentSlowTransactions();
+  ASSERT_EQ(slowTransactions.size(), 1);
+
+  auto const &slowTransaction = slowTransactions[0];
+  EXPECT_EQ(slowTransaction.revisionNumber, 2);
+  EXPECT_EQ(slowTransaction.numberOfMutations, 42);
+  EXPECT_EQ(slowTransaction.numberOfTextMeasurements, 1);
+  EXPECT_EQ(
+      slowTransaction.dominantStage, SurfaceTelemetry::Stage::TextMeasure);
+  EXPECT_GE(
+      slowTransaction.getStageTime(SurfaceTelemetry::Stage::TextMeasure),
+      std::chrono::milliseconds(100));
+  EXPECT_GE(slowTransaction.totalTime, std::chrono::milliseconds(100));
+
+  auto const &histogram =
+      surfaceTelemetry.getHistogram(SurfaceTelemetry::Stage::TextMeasure);
+  EXPECT_EQ(histogram.getCount(), 2);
+  EXPECT_GE(histogram.getMax(), std::chrono::milliseconds(100));
+}
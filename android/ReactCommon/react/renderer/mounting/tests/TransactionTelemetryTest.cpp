@@ -51,7 +51,8 @@ TEST(TransactionTelemetryTest, normalUseCase) {
 
   telemetry.didMeasureText();
   TransactionTelemetry::threadLocalTelemetry()->didMeasureText();
-  TransactionTelemetry::threadLocalTelemetry()->didMeasureText();
+  TransactionTelemetry::threadLocalTelemetry()->didMeasureText(
+      /* wasPremeasured */ true);
 
   telemetry.didLayout();
   sleep<TelemetryClock>(0.1);
@@ -79,6 +80,7 @@ TEST(TransactionTelemetryTest, normalUseCase) {
   EXPECT_EQ_WITH_THRESHOLD(mountDuration, 100, threshold);
 
   EXPECT_EQ(telemetry.getNumberOfTextMeasurements(), 3);
+  EXPECT_EQ(telemetry.getNumberOfPremeasuredTextMeasurements(), 1);
   EXPECT_EQ(telemetry.getRevisionNumber(), 42);
 }
 
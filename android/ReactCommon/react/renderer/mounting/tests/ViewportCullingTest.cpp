@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/scrollview/ScrollViewComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/Differentiator.h>
+#include <react/renderer/mounting/StubViewTree.h>
+#include <react/renderer/mounting/stubs.h>
+
+using namespace facebook::react;
+
+static constexpr Tag kContentContainerTag = 3;
+static constexpr Tag kFirstItemTag = 10;
+static constexpr int kNumberOfItems = 10;
+static constexpr Float kItemHeight = 100;
+
+/*
+ * Builds a tree with a 100x100 scroll view, with a column of 100x100 items
+ * in its content container. Children of the last item overflow it upwards by
+ * `lastItemOverflow`.
+ */
+static RootShadowNode::Shared buildTree(
+    ComponentBuilder &builder,
+    Float cullingOverscan,
+    std::shared_ptr<ScrollViewShadowNode> &scrollViewShadowNode,
+    Float lastItemOverflow = 0) {
+  auto items = std::vector<ElementFragment>{};
+  for (auto i = 0; i < kNumberOfItems; i++) {
+    // clang-format off
+    items.push_back(
+      Element<ViewShadowNode>()
+        .tag(kFirstItemTag + i)
+        .props([] {
+          auto sharedProps = std::make_shared<ViewProps>();
+          sharedProps->collapsable = false;
+          return sharedProps;
+        })
+        .finalize([=](ViewShadowNode &shadowNode){
+          auto layoutMetrics = EmptyLayoutMetrics;
+          layoutMetrics.frame.origin = {0, i * kItemHeight};
+          layoutMetrics.frame.size = {100, kItemHeight};
+          if (i == kNumberOfItems - 1) {
+            layoutMetrics.overflowInset.top = -lastItemOverflow;
+          }
+          shadowNode.setLayoutMetrics(layoutMetrics);
+        }));
+    // clang-format on
+  }
+
+  // clang-format off
+  auto element =
+    Element<RootShadowNode>()
+      .tag(1)
+      .finalize([](RootShadowNode &shadowNode){
+        shadowNode.sealRecursive();
+      })
+      .children({
+        Element<ScrollViewShadowNode>()
+          .tag(2)
+          .reference(scrollViewShadowNode)
+          .props([=] {
+            auto sharedProps = std::make_shared<ScrollViewProps>();
+            sharedProps->cullingOverscan = cullingOverscan;
+            return sharedProps;
+          })
+          .finalize([](ScrollViewShadowNode &shadowNode){
+            auto layoutMetrics = EmptyLayoutMetrics;
+            layoutMetrics.frame.size = {100, 100};
+            shadowNode.setLayoutMetrics(layoutMetrics);
+          })
+          .children({
+            Element<ViewShadowNode>()
+              .tag(kContentContainerTag)
+              .props([] {
+                auto sharedProps = std::make_shared<ViewProps>();
+                sharedProps->collapsable = false;
+                return sharedProps;
+              })
+              .finalize([](ViewShadowNode &shadowNode){
+                auto layoutMetrics = EmptyLayoutMetrics;
+                layoutMetrics.frame.size = {100, kNumberOfItems * kItemHeight};
+                shadowNode.setLayoutMetrics(layoutMetrics);
+              })
+              .children(items)
+          })
+      });
+  // clang-format on
+
+  return builder.build(element);
+}
+
+static RootShadowNode::Shared scrollTo(
+    RootShadowNode const &rootShadowNode,
+    ScrollViewShadowNode const &scrollViewShadowNode,
+    Float contentOffsetY) {
+  auto stateData = ScrollViewState{};
+  stateData.contentOffset = {0, contentOffsetY};
+  auto state = scrollViewShadowNode.getComponentDescriptor().createState(
+      scrollViewShadowNode.getFamily(),
+      std::make_shared<ScrollViewState const>(stateData));
+
+  return std::static_pointer_cast<RootShadowNode const>(
+      rootShadowNode.cloneTree(
+          scrollViewShadowNode.getFamily(),
+          [&](ShadowNode const &oldShadowNode) {
+            return oldShadowNode.clone(
+                {ShadowNodeFragment::propsPlaceholder(),
+                 ShadowNodeFragment::childrenPlaceholder(),
+                 state});
+          }));
+}
+
+/*
+ * Returns tags of items which were created, deleted, inserted to or removed
+ * from the content container, in the order of mutations.
+ */
+static std::vector<Tag> itemTags(
+    ShadowViewMutation::List const &mutations,
+    ShadowViewMutation::Type type) {
+  auto tags = std::vector<Tag>{};
+  for (auto const &mutation : mutations) {
+    if (mutation.type != type) {
+      continue;
+    }
+    auto tag = type == ShadowViewMutation::Create ||
+            type == ShadowViewMutation::Insert
+        ? mutation.newChildShadowView.tag
+        : mutation.oldChildShadowView.tag;
+    if (tag >= kFirstItemTag) {
+      tags.push_back(tag);
+    }
+  }
+  std::sort(tags.begin(), tags.end());
+  return tags;
+}
+
+/*
+ * Checks that the mounted views are the ones of the shadow tree, with only
+ * the items with given tags (in this order) in the content container.
+ */
+static void expectMountedItems(
+    StubViewTree const &viewTree,
+    RootShadowNode const &rootShadowNode,
+    std::vector<Tag> const &tags) {
+  auto unculledViewTree = stubViewTreeFromShadowNode(rootShadowNode);
+
+  EXPECT_EQ(viewTree.registry.size(), tags.size() + 3);
+  for (auto const &pair : viewTree.registry) {
+    if (pair.first == viewTree.rootTag) {
+      continue;
+    }
+    ASSERT_EQ(unculledViewTree.registry.count(pair.first), 1) << pair.first;
+    EXPECT_TRUE(*pair.second == *unculledViewTree.registry.at(pair.first))
+        << pair.first;
+  }
+
+  auto const &rootView = viewTree.getRootStubView();
+  ASSERT_EQ(rootView.children.size(), 1);
+  auto const &scrollView = *rootView.children[0];
+  ASSERT_EQ(scrollView.children.size(), 1);
+  auto const &contentContainerView = *scrollView.children[0];
+  EXPECT_EQ(contentContainerView.tag, kContentContainerTag);
+
+  auto mountedTags = std::vector<Tag>{};
+  for (auto const &itemView : contentContainerView.children) {
+    mountedTags.push_back(itemView->tag);
+  }
+  EXPECT_EQ(mountedTags, tags);
+}
+
+/*
+ * Diffs the shadow trees, applies the mutations to the view tree and returns
+ * them.
+ */
+static ShadowViewMutation::List mount(
+    StubViewTree &viewTree,
+    RootShadowNode const &oldRootShadowNode,
+    RootShadowNode const &newRootShadowNode,
+    bool enableReparentingDetection) {
+  auto mutations = calculateShadowViewMutations(
+      oldRootShadowNode, newRootShadowNode, enableReparentingDetection);
+  viewTree.mutate(mutations);
+  return mutations;
+}
+
+static void testViewportCulling(bool enableReparentingDetection) {
+  auto builder = simpleComponentBuilder();
+  auto emptyRootShadowNode =
+      builder.build(Element<RootShadowNode>().tag(1).finalize(
+          [](RootShadowNode &shadowNode) { shadowNode.sealRecursive(); }));
+  auto viewTree = StubViewTree(ShadowView(*emptyRootShadowNode));
+
+  auto scrollViewShadowNode = std::shared_ptr<ScrollViewShadowNode>{};
+  auto rootShadowNode = buildTree(builder, 50, scrollViewShadowNode);
+
+  // The visible area (0...100) extended by the overscan.
+  auto mutations = mount(
+      viewTree,
+      *emptyRootShadowNode,
+      *rootShadowNode,
+      enableReparentingDetection);
+  expectMountedItems(viewTree, *rootShadowNode, {10, 11});
+
+  // Scrolling a bit does not mount or unmount anything.
+  auto scrolledRootShadowNode =
+      scrollTo(*rootShadowNode, *scrollViewShadowNode, 20);
+  mutations = mount(
+      viewTree,
+      *rootShadowNode,
+      *scrolledRootShadowNode,
+      enableReparentingDetection);
+  EXPECT_TRUE(itemTags(mutations, ShadowViewMutation::Insert).empty());
+  EXPECT_TRUE(itemTags(mutations, ShadowViewMutation::Remove).empty());
+  expectMountedItems(viewTree, *scrolledRootShadowNode, {10, 11});
+
+  // Scrolling to 450...550 (400...600 with the overscan) mounts items which
+  // became visible and unmounts items which are not visible anymore.
+  auto farScrolledRootShadowNode =
+      scrollTo(*scrolledRootShadowNode, *scrollViewShadowNode, 450);
+  mutations = mount(
+      viewTree,
+      *scrolledRootShadowNode,
+      *farScrolledRootShadowNode,
+      enableReparentingDetection);
+  EXPECT_EQ(
+      itemTags(mutations, ShadowViewMutation::Remove),
+      (std::vector<Tag>{10, 11}));
+  EXPECT_EQ(
+      itemTags(mutations, ShadowViewMutation::Delete),
+      (std::vector<Tag>{10, 11}));
+  expectMountedItems(viewTree, *farScrolledRootShadowNode, {14, 15});
+
+  // Scrolling back creates the views of the first items again, in a later
+  // transaction than the one which deleted them and with the same props.
+  auto scrolledBackRootShadowNode =
+      scrollTo(*farScrolledRootShadowNode, *scrollViewShadowNode, 0);
+  mutations = mount(
+      viewTree,
+      *farScrolledRootShadowNode,
+      *scrolledBackRootShadowNode,
+      enableReparentingDetection);
+  EXPECT_EQ(
+      itemTags(mutations, ShadowViewMutation::Create),
+      (std::vector<Tag>{10, 11}));
+  EXPECT_EQ(
+      itemTags(mutations, ShadowViewMutation::Insert),
+      (std::vector<Tag>{10, 11}));
+  EXPECT_EQ(
+      itemTags(mutations, ShadowViewMutation::Delete),
+      (std::vector<Tag>{14, 15}));
+  expectMountedItems(viewTree, *scrolledBackRootShadowNode, {10, 11});
+}
+
+TEST(ViewportCullingTest, cullingIsDisabledByDefault) {
+  auto builder = simpleComponentBuilder();
+  auto emptyRootShadowNode =
+      builder.build(Element<RootShadowNode>().tag(1).finalize(
+          [](RootShadowNode &shadowNode) { shadowNode.sealRecursive(); }));
+  auto viewTree = StubViewTree(ShadowView(*emptyRootShadowNode));
+
+  auto scrollViewShadowNode = std::shared_ptr<ScrollViewShadowNode>{};
+  auto rootShadowNode = buildTree(builder, -1, scrollViewShadowNode);
+
+  mount(viewTree, *emptyRootShadowNode, *rootShadowNode, false);
+  expectMountedItems(
+      viewTree,
+      *rootShadowNode,
+      {10, 11, 12, 13, 14, 15, 16, 17, 18, 19});
+}
+
+TEST(ViewportCullingTest, mountsOnlyVisibleItems) {
+  testViewportCulling(false);
+}
+
+TEST(ViewportCullingTest, mountsOnlyVisibleItemsWithReparentingDetection) {
+  testViewportCulling(true);
+}
+
+TEST(ViewportCullingTest, itemsWithVisibleOverflowAreNotCulled) {
+  auto builder = simpleComponentBuilder();
+  auto emptyRootShadowNode =
+      builder.build(Element<RootShadowNode>().tag(1).finalize(
+          [](RootShadowNode &shadowNode) { shadowNode.sealRecursive(); }));
+  auto viewTree = StubViewTree(ShadowView(*emptyRootShadowNode));
+
+  // The last item (900...1000) has children which reach up to 50, into the
+  // visible area.
+  auto scrollViewShadowNode = std::shared_ptr<ScrollViewShadowNode>{};
+  auto rootShadowNode = buildTree(builder, 50, scrollViewShadowNode, 850);
+
+  mount(viewTree, *emptyRootShadowNode, *rootShadowNode, false);
+  expectMountedItems(viewTree, *rootShadowNode, {10, 11, 19});
+}
@@ -113,6 +113,10 @@ Scheduler::Scheduler(
   uiManager_->experimentEnableStateUpdateWithAutorepeat =
       reactNativeConfig_->getBool(
           "react_fabric:enable_state_update_with_autorepeat_android");
+  uiManager_->experimentEnableSurfaceArenas = reactNativeConfig_->getBool(
+      "react_fabric:enable_surface_arenas_android");
+  uiManager_->experimentEnableTextPremeasurement = reactNativeConfig_->getBool(
+      "react_fabric:enable_text_premeasurement_android");
 #else
   enableReparentingDetection_ = reactNativeConfig_->getBool(
       "react_fabric:enable_reparenting_detection_ios");
@@ -121,6 +125,10 @@ Scheduler::Scheduler(
   uiManager_->experimentEnableStateUpdateWithAutorepeat =
       reactNativeConfig_->getBool(
           "react_fabric:enable_state_update_with_autorepeat_ios");
+  uiManager_->experimentEnableSurfaceArenas = reactNativeConfig_->getBool(
+      "react_fabric:enable_surface_arenas_ios");
+  uiManager_->experimentEnableTextPremeasurement = reactNativeConfig_->getBool(
+      "react_fabric:enable_text_premeasurement_ios");
 #endif
 }
 
@@ -194,6 +202,10 @@ void Scheduler::startSurface(
       mountingOverrideDelegate,
       enableReparentingDetection_);
 
+  if (uiManager_->experimentEnableSurfaceArenas) {
+    shadowTree->setArena(SurfaceArena::create());
+  }
+
   auto uiManager = uiManager_;
 
   uiManager->getShadowTreeRegistry().add(std::move(shadowTree));
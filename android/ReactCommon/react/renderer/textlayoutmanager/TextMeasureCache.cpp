@@ -61,5 +61,115 @@ bool LineMeasurement::operator==(LineMeasurement const &rhs) const {
              rhs.xHeight);
 }
 
+better::optional<TextMeasurement> TextMeasureCache::find(
+    TextMeasureCacheKey const &key) const {
+  auto iterator = map_.find(key);
+  if (iterator == map_.end()) {
+    return {};
+  }
+
+  auto measurement = iterator->second.measurement;
+  measurement.wasPremeasured = iterator->second.isPremeasured;
+  iterator->second.isPremeasured = false;
+  return measurement;
+}
+
+TextMeasurement TextMeasureCache::measure(
+    TextMeasureCacheKey const &key,
+    Generator const &generator,
+    std::promise<TextMeasurement> &promise,
+    bool isPremeasurement) const {
+  try {
+    auto measurement = generator(key);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.set(key, Entry{measurement, isPremeasurement});
+    pendingMeasurements_.erase(key);
+    promise.set_value(measurement);
+    return measurement;
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pendingMeasurements_.erase(key);
+    promise.set_exception(std::current_exception());
+    throw;
+  }
+}
+
+TextMeasurement TextMeasureCache::get(
+    TextMeasureCacheKey const &key,
+    Generator const &generator) const {
+  auto promise = std::promise<TextMeasurement>{};
+  auto pendingMeasurement = std::shared_future<TextMeasurement>{};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto measurement = find(key);
+    if (measurement) {
+      return *measurement;
+    }
+
+    auto iterator = pendingMeasurements_.find(key);
+    if (iterator != pendingMeasurements_.end()) {
+      pendingMeasurement = iterator->second;
+    } else {
+      pendingMeasurements_.emplace(key, promise.get_future().share());
+    }
+  }
+
+  if (!pendingMeasurement.valid()) {
+    return measure(key, generator, promise, false);
+  }
+
+  // Waiting for a measurement in progress is cheaper than making another one.
+  try {
+    auto measurement = pendingMeasurement.get();
+    std::lock_guard<std::mutex> lock(mutex_);
+    return find(key).value_or(measurement);
+  } catch (...) {
+    // The other measurement failed; trying again here.
+    return generator(key);
+  }
+}
+
+void TextMeasureCache::premeasure(
+    TextMeasureCacheKey const &key,
+    Generator const &generator) const {
+  auto promise = std::promise<TextMeasurement>{};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (map_.exists(key) ||
+        pendingMeasurements_.find(key) != pendingMeasurements_.end()) {
+      return;
+    }
+    pendingMeasurements_.emplace(key, promise.get_future().share());
+  }
+
+  try {
+    measure(key, generator, promise, true);
+  } catch (...) {
+    // Layout will measure the text again (and report the failure).
+  }
+}
+
+LinesMeasurements TextMeasureCache::getLines(
+    TextMeasureCacheKey const &key,
+    LinesGenerator const &generator) const {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iterator = map_.find(key);
+    if (iterator != map_.end() && iterator->second.lines) {
+      return *iterator->second.lines;
+    }
+  }
+
+  auto lines = generator(key);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iterator = map_.find(key);
+  if (iterator != map_.end()) {
+    iterator->second.lines = lines;
+  }
+  return lines;
+}
+
 } // namespace react
 } // namespace facebook
@@ -7,11 +7,17 @@
 
 #pragma once
 
+#include <functional>
+#include <future>
+#include <mutex>
+#include <unordered_map>
+
+#include <better/optional.h>
+#include <folly/container/EvictingCacheMap.h>
 #include <react/renderer/attributedstring/AttributedString.h>
 #include <react/renderer/attributedstring/ParagraphAttributes.h>
 #include <react/renderer/core/LayoutConstraints.h>
 #include <react/utils/FloatComparison.h>
-#include <react/utils/SimpleThreadSafeCache.h>
 
 namespace facebook {
 namespace react {
@@ -54,6 +60,13 @@ class TextMeasurement final {
 
   Size size;
   Attachments attachments;
+
+  /*
+   * Whether the measurement was made ahead of layout by
+   * `TextMeasureCache::premeasure`. Set only for the first use of such a
+   * measurement.
+   */
+  bool wasPremeasured{false};
 };
 
 // The Key type that is used for Text Measure Cache.
@@ -73,15 +86,6 @@ class TextMeasureCacheKey final {
  */
 constexpr auto kSimpleThreadSafeCacheSizeCap = size_t{256};
 
-/*
- * Thread-safe, evicting hash table designed to store text measurement
- * information.
- */
-using TextMeasureCache = SimpleThreadSafeCache<
-    TextMeasureCacheKey,
-    TextMeasurement,
-    kSimpleThreadSafeCacheSizeCap>;
-
 inline bool areTextAttributesEquivalentLayoutWise(
     TextAttributes const &lhs,
     TextAttributes const &rhs) {
@@ -129,6 +133,7 @@ inline size_t textAttributesHashLayoutWise(
 inline bool areAttributedStringFragmentsEquivalentLayoutWise(
     AttributedString::Fragment const &lhs,
     AttributedString::Fragment const &rhs) {
+  // Fragment strings are interned, so comparing them is a pointer comparison.
   return lhs.string == rhs.string &&
       areTextAttributesEquivalentLayoutWise(
              lhs.textAttributes, rhs.textAttributes) &&
@@ -146,7 +151,7 @@ inline size_t textAttributesHashLayoutWise(
   // between hash and equivalence functions (and cause cache misses).
   return folly::hash::hash_combine(
       0,
-      fragment.string,
+      fragment.string.hash(),
       textAttributesHashLayoutWise(fragment.textAttributes));
 }
 
@@ -216,3 +221,86 @@ struct hash<facebook::react::TextMeasureCacheKey> {
 };
 
 } // namespace std
+
+namespace facebook {
+namespace react {
+
+/*
+ * Thread-safe, evicting hash table designed to store text measurement
+ * information.
+ * Besides measurements made on demand (during layout), it stores measurements
+ * made ahead of layout (speculatively, on a background thread).
+ */
+class TextMeasureCache final {
+ public:
+  using Generator =
+      std::function<TextMeasurement(TextMeasureCacheKey const &key)>;
+  using LinesGenerator =
+      std::function<LinesMeasurements(TextMeasureCacheKey const &key)>;
+
+  TextMeasureCache() : map_{kSimpleThreadSafeCacheSizeCap} {}
+
+  /*
+   * Returns a measurement with a given key from the cache. If there is none,
+   * waits for a measurement of the key in progress (e.g. a pre-measurement)
+   * or constructs the measurement using given generator function and stores
+   * it in the cache. The generator is called without holding the lock.
+   * Can be called from any thread.
+   */
+  TextMeasurement get(TextMeasureCacheKey const &key, Generator const &generator)
+      const;
+
+  /*
+   * Constructs a measurement using given generator function and stores it in
+   * the cache, unless the key is already cached or being measured.
+   * Meant to be called on a background thread, ahead of layout.
+   */
+  void premeasure(TextMeasureCacheKey const &key, Generator const &generator)
+      const;
+
+  /*
+   * Returns lines of the text with a given key. Lines are stored alongside
+   * the measurement of the key, so they are only cached while the key is
+   * measured (which is always the case right after layout measured it).
+   * The generator is called without holding the lock.
+   * Can be called from any thread.
+   */
+  LinesMeasurements getLines(
+      TextMeasureCacheKey const &key,
+      LinesGenerator const &generator) const;
+
+ private:
+  class Entry final {
+   public:
+    TextMeasurement measurement;
+    bool isPremeasured;
+    better::optional<LinesMeasurements> lines{};
+  };
+
+  /*
+   * Returns the cached measurement with a given key (if any), marking it as
+   * pre-measured for the first use of a pre-measurement.
+   * Must be called with `mutex_` locked.
+   */
+  better::optional<TextMeasurement> find(TextMeasureCacheKey const &key) const;
+
+  /*
+   * Constructs a measurement which was registered as pending with `promise`,
+   * stores it and fulfills the promise.
+   */
+  TextMeasurement measure(
+      TextMeasureCacheKey const &key,
+      Generator const &generator,
+      std::promise<TextMeasurement> &promise,
+      bool isPremeasurement) const;
+
+  mutable folly::EvictingCacheMap<TextMeasureCacheKey, Entry> map_;
+  mutable std::unordered_map<
+      TextMeasureCacheKey,
+      std::shared_future<TextMeasurement>>
+      pendingMeasurements_;
+  mutable std::mutex mutex_;
+};
+
+} // namespace react
+} // namespace facebook
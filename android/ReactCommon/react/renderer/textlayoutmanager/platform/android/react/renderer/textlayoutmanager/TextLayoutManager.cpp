@@ -36,6 +36,18 @@ TextMeasurement TextLayoutManager::measure(
       });
 }
 
+void TextLayoutManager::premeasure(
+    AttributedString const &attributedString,
+    ParagraphAttributes const &paragraphAttributes,
+    LayoutConstraints const &layoutConstraints) const {
+  measureCache_.premeasure(
+      {attributedString, paragraphAttributes, layoutConstraints},
+      [&](TextMeasureCacheKey const &key) {
+        return doMeasure(
+            attributedString, paragraphAttributes, layoutConstraints);
+      });
+}
+
 TextMeasurement TextLayoutManager::measureCachedSpannableById(
     int64_t cacheId,
     ParagraphAttributes paragraphAttributes,
@@ -106,8 +118,26 @@ TextMeasurement TextLayoutManager::measureCachedSpannableById(
 }
 
 LinesMeasurements TextLayoutManager::measureLines(
-    AttributedString attributedString,
-    ParagraphAttributes paragraphAttributes,
+    AttributedString const &attributedString,
+    ParagraphAttributes const &paragraphAttributes,
+    LayoutConstraints const &layoutConstraints) const {
+  return measureCache_.getLines(
+      {attributedString, paragraphAttributes, layoutConstraints},
+      [&](TextMeasureCacheKey const &key) {
+        // The measurement is cached (layout has just made it), so this does
+        // not call into Java.
+        auto size = measure(
+                        AttributedStringBox{attributedString},
+                        paragraphAttributes,
+                        layoutConstraints)
+                        .size;
+        return doMeasureLines(attributedString, paragraphAttributes, size);
+      });
+}
+
+LinesMeasurements TextLayoutManager::doMeasureLines(
+    AttributedString const &attributedString,
+    ParagraphAttributes const &paragraphAttributes,
     Size size) const {
   const jni::global_ref<jobject> &fabricUIManager =
       contextContainer_->at<jni::global_ref<jobject>>("FabricUIManager");
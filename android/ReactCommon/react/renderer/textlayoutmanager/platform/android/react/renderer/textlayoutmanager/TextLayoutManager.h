@@ -37,6 +37,17 @@ class TextLayoutManager {
       ParagraphAttributes paragraphAttributes,
       LayoutConstraints layoutConstraints) const;
 
+  /*
+   * Measures `attributedString` ahead of layout and stores the result in the
+   * measure cache (unless it is already there), so that a following `measure`
+   * call with the same arguments does not need to measure.
+   * Meant to be called on a background thread.
+   */
+  void premeasure(
+      AttributedString const &attributedString,
+      ParagraphAttributes const &paragraphAttributes,
+      LayoutConstraints const &layoutConstraints) const;
+
   /**
    * Measures an AttributedString on the platform, as identified by some
    * opaque cache ID.
@@ -47,13 +58,14 @@ class TextLayoutManager {
       LayoutConstraints layoutConstraints) const;
 
   /*
-   * Measures lines of `attributedString` using native text rendering
-   * infrastructure.
+   * Measures lines of `attributedString` laid out with given constraints
+   * using native text rendering infrastructure. Lines are cached alongside
+   * the measurement made by `measure` with the same arguments.
    */
   LinesMeasurements measureLines(
-      AttributedString attributedString,
-      ParagraphAttributes paragraphAttributes,
-      Size size) const;
+      AttributedString const &attributedString,
+      ParagraphAttributes const &paragraphAttributes,
+      LayoutConstraints const &layoutConstraints) const;
 
   /*
    * Returns an opaque pointer to platform-specific TextLayoutManager.
@@ -67,6 +79,11 @@ class TextLayoutManager {
       ParagraphAttributes paragraphAttributes,
       LayoutConstraints layoutConstraints) const;
 
+  LinesMeasurements doMeasureLines(
+      AttributedString const &attributedString,
+      ParagraphAttributes const &paragraphAttributes,
+      Size size) const;
+
   void *self_;
   ContextContainer::Shared contextContainer_;
   TextMeasureCache measureCache_{};
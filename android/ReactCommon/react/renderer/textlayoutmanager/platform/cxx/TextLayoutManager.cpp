@@ -23,5 +23,10 @@ TextMeasurement TextLayoutManager::measure(
   return TextMeasurement{{0, 0}, {}};
 }
 
+void TextLayoutManager::premeasure(
+    AttributedString const &attributedString,
+    ParagraphAttributes const &paragraphAttributes,
+    LayoutConstraints const &layoutConstraints) const {}
+
 } // namespace react
 } // namespace facebook
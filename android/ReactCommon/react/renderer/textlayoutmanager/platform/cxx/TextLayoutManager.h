@@ -40,6 +40,17 @@ class TextLayoutManager {
       ParagraphAttributes paragraphAttributes,
       LayoutConstraints layoutConstraints) const;
 
+  /*
+   * Measures `attributedString` ahead of layout and stores the result in the
+   * measure cache (unless it is already there), so that a following `measure`
+   * call with the same arguments does not need to measure.
+   * Meant to be called on a background thread.
+   */
+  void premeasure(
+      AttributedString const &attributedString,
+      ParagraphAttributes const &paragraphAttributes,
+      LayoutConstraints const &layoutConstraints) const;
+
   /*
    * Returns an opaque pointer to platform-specific TextLayoutManager.
    * Is used on a native views layer to delegate text rendering to the manager.
@@ -40,13 +40,25 @@ class TextLayoutManager {
       LayoutConstraints layoutConstraints) const;
 
   /*
-   * Measures lines of `attributedString` using native text rendering
-   * infrastructure.
+   * Measures `attributedString` ahead of layout and stores the result in the
+   * measure cache (unless it is already there), so that a following `measure`
+   * call with the same arguments does not need to measure.
+   * Meant to be called on a background thread.
+   */
+  void premeasure(
+      AttributedString const &attributedString,
+      ParagraphAttributes const &paragraphAttributes,
+      LayoutConstraints const &layoutConstraints) const;
+
+  /*
+   * Measures lines of `attributedString` laid out with given constraints
+   * using native text rendering infrastructure. Lines are cached alongside
+   * the measurement made by `measure` with the same arguments.
    */
   LinesMeasurements measureLines(
-      AttributedString attributedString,
-      ParagraphAttributes paragraphAttributes,
-      Size size) const;
+      AttributedString const &attributedString,
+      ParagraphAttributes const &paragraphAttributes,
+      LayoutConstraints const &layoutConstraints) const;
 
   /*
    * Returns an opaque pointer to platform-specific TextLayoutManager.
@@ -62,15 +62,35 @@ TextMeasurement TextLayoutManager::measure(
   return measurement;
 }
 
+void TextLayoutManager::premeasure(
+    AttributedString const &attributedString,
+    ParagraphAttributes const &paragraphAttributes,
+    LayoutConstraints const &layoutConstraints) const
+{
+  RCTTextLayoutManager *textLayoutManager = (RCTTextLayoutManager *)unwrapManagedObject(self_);
+
+  measureCache_.premeasure(
+      {attributedString, paragraphAttributes, layoutConstraints}, [&](TextMeasureCacheKey const &key) {
+        return [textLayoutManager measureAttributedString:attributedString
+                                      paragraphAttributes:paragraphAttributes
+                                        layoutConstraints:layoutConstraints];
+      });
+}
+
 LinesMeasurements TextLayoutManager::measureLines(
-    AttributedString attributedString,
-    ParagraphAttributes paragraphAttributes,
-    Size size) const
+    AttributedString const &attributedString,
+    ParagraphAttributes const &paragraphAttributes,
+    LayoutConstraints const &layoutConstraints) const
 {
   RCTTextLayoutManager *textLayoutManager = (RCTTextLayoutManager *)unwrapManagedObject(self_);
-  return [textLayoutManager getLinesForAttributedString:attributedString
-                                    paragraphAttributes:paragraphAttributes
-                                                   size:{size.width, size.height}];
+
+  return measureCache_.getLines(
+      {attributedString, paragraphAttributes, layoutConstraints}, [&](TextMeasureCacheKey const &key) {
+        auto size = measure(AttributedStringBox{attributedString}, paragraphAttributes, layoutConstraints).size;
+        return [textLayoutManager getLinesForAttributedString:attributedString
+                                          paragraphAttributes:paragraphAttributes
+                                                         size:{size.width, size.height}];
+      });
 }
 
 } // namespace react
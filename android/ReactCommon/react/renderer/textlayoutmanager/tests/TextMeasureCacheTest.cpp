@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/textlayoutmanager/TextMeasureCache.h>
+
+using namespace facebook::react;
+
+static TextMeasureCacheKey keyWithWidth(Float width) {
+  auto key = TextMeasureCacheKey{};
+  key.layoutConstraints.maximumSize.width = width;
+  return key;
+}
+
+/*
+ * A generator which counts its calls and measures everything as `size`.
+ */
+class CountingGenerator {
+ public:
+  explicit CountingGenerator(Size size) : size_(size) {}
+
+  TextMeasureCache::Generator operator()() {
+    return [this](TextMeasureCacheKey const &) {
+      callCount++;
+      auto measurement = TextMeasurement{};
+      measurement.size = size_;
+      return measurement;
+    };
+  }
+
+  std::atomic<int> callCount{0};
+
+ private:
+  Size size_;
+};
+
+/*
+ * A generator which blocks until it is released, so that other calls can be
+ * made while its measurement is in progress.
+ */
+class BlockingGenerator {
+ public:
+  TextMeasureCache::Generator operator()(Size size) {
+    return [this, size](TextMeasureCacheKey const &) {
+      started_.set_value();
+      released_.wait();
+      if (shouldFail_) {
+        throw std::runtime_error("Measuring failed");
+      }
+      auto measurement = TextMeasurement{};
+      measurement.size = size;
+      return measurement;
+    };
+  }
+
+  void waitUntilStarted() {
+    started_.get_future().wait();
+    // Gives calls made next the time to start waiting for the measurement.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  }
+
+  void release(bool shouldFail = false) {
+    shouldFail_ = shouldFail;
+    releasePromise_.set_value();
+  }
+
+ private:
+  std::promise<void> started_;
+  std::promise<void> releasePromise_;
+  std::shared_future<void> released_{releasePromise_.get_future().share()};
+  bool shouldFail_{false};
+};
+
+TEST(TextMeasureCacheTest, testMeasurementsAreCached) {
+  TextMeasureCache cache;
+  CountingGenerator generator{Size{10, 20}};
+
+  EXPECT_EQ(cache.get(keyWithWidth(100), generator()).size, (Size{10, 20}));
+  EXPECT_EQ(cache.get(keyWithWidth(100), generator()).size, (Size{10, 20}));
+  EXPECT_EQ(generator.callCount, 1);
+
+  cache.get(keyWithWidth(200), generator());
+  EXPECT_EQ(generator.callCount, 2);
+}
+
+TEST(TextMeasureCacheTest, testConcurrentMeasurementsOfTheSameKeyAreMadeOnce) {
+  TextMeasureCache cache;
+  BlockingGenerator producer;
+  CountingGenerator waiter{Size{1, 1}};
+
+  auto producerMeasurement = std::async(std::launch::async, [&] {
+    return cache.get(keyWithWidth(100), producer(Size{10, 20}));
+  });
+  producer.waitUntilStarted();
+  auto waiterMeasurement = std::async(std::launch::async, [&] {
+    return cache.get(keyWithWidth(100), waiter());
+  });
+  producer.release();
+
+  // The waiter gets the result of the producer instead of measuring.
+  EXPECT_EQ(producerMeasurement.get().size, (Size{10, 20}));
+  EXPECT_EQ(waiterMeasurement.get().size, (Size{10, 20}));
+  EXPECT_EQ(waiter.callCount, 0);
+}
+
+TEST(TextMeasureCacheTest, testWaitersMeasureAgainIfTheProducerFails) {
+  TextMeasureCache cache;
+  BlockingGenerator producer;
+  CountingGenerator waiter{Size{1, 1}};
+
+  auto producerMeasurement = std::async(std::launch::async, [&] {
+    return cache.get(keyWithWidth(100), producer(Size{10, 20}));
+  });
+  producer.waitUntilStarted();
+  auto waiterMeasurement = std::async(std::launch::async, [&] {
+    return cache.get(keyWithWidth(100), waiter());
+  });
+  producer.release(true);
+
+  EXPECT_THROW(producerMeasurement.get(), std::runtime_error);
+  EXPECT_EQ(waiterMeasurement.get().size, (Size{1, 1}));
+  EXPECT_EQ(waiter.callCount, 1);
+}
+
+TEST(TextMeasureCacheTest, testPremeasurementsAreMarkedOnFirstUse) {
+  TextMeasureCache cache;
+  CountingGenerator premeasurer{Size{10, 20}};
+  CountingGenerator layout{Size{1, 1}};
+
+  cache.premeasure(keyWithWidth(100), premeasurer());
+  EXPECT_EQ(premeasurer.callCount, 1);
+
+  // A hit.
+  auto measurement = cache.get(keyWithWidth(100), layout());
+  EXPECT_EQ(measurement.size, (Size{10, 20}));
+  EXPECT_TRUE(measurement.wasPremeasured);
+  EXPECT_FALSE(cache.get(keyWithWidth(100), layout()).wasPremeasured);
+
+  // A miss.
+  measurement = cache.get(keyWithWidth(200), layout());
+  EXPECT_EQ(measurement.size, (Size{1, 1}));
+  EXPECT_FALSE(measurement.wasPremeasured);
+  EXPECT_EQ(layout.callCount, 1);
+
+  // Keys which are measured already are not measured again.
+  cache.premeasure(keyWithWidth(100), premeasurer());
+  cache.premeasure(keyWithWidth(200), premeasurer());
+  EXPECT_EQ(premeasurer.callCount, 1);
+  EXPECT_FALSE(cache.get(keyWithWidth(200), layout()).wasPremeasured);
+}
+
+TEST(TextMeasureCacheTest, testLayoutWaitsForPendingPremeasurement) {
+  TextMeasureCache cache;
+  BlockingGenerator premeasurer;
+  CountingGenerator layout{Size{1, 1}};
+
+  auto premeasurement = std::async(std::launch::async, [&] {
+    cache.premeasure(keyWithWidth(100), premeasurer(Size{10, 20}));
+  });
+  premeasurer.waitUntilStarted();
+  auto measurement = std::async(std::launch::async, [&] {
+    return cache.get(keyWithWidth(100), layout());
+  });
+  premeasurer.release();
+  premeasurement.get();
+
+  auto result = measurement.get();
+  EXPECT_EQ(result.size, (Size{10, 20}));
+  EXPECT_TRUE(result.wasPremeasured);
+  EXPECT_EQ(layout.callCount, 0);
+}
+
+TEST(TextMeasureCacheTest, testFailedPremeasurementsAreMeasuredByLayout) {
+  TextMeasureCache cache;
+  CountingGenerator layout{Size{1, 1}};
+
+  cache.premeasure(
+      keyWithWidth(100), [](TextMeasureCacheKey const &) -> TextMeasurement {
+        throw std::runtime_error("Measuring failed");
+      });
+
+  auto measurement = cache.get(keyWithWidth(100), layout());
+  EXPECT_EQ(measurement.size, (Size{1, 1}));
+  EXPECT_FALSE(measurement.wasPremeasured);
+  EXPECT_EQ(layout.callCount, 1);
+}
+
+TEST(TextMeasureCacheTest, testLinesAreCachedWithMeasurements) {
+  TextMeasureCache cache;
+  auto linesCallCount = 0;
+  auto linesGenerator = [&](TextMeasureCacheKey const &) {
+    linesCallCount++;
+    return LinesMeasurements{};
+  };
+
+  // Lines of keys which are not measured are not cached.
+  cache.getLines(keyWithWidth(100), linesGenerator);
+  cache.getLines(keyWithWidth(100), linesGenerator);
+  EXPECT_EQ(linesCallCount, 2);
+
+  CountingGenerator generator{Size{10, 20}};
+  cache.get(keyWithWidth(100), generator());
+  cache.getLines(keyWithWidth(100), linesGenerator);
+  cache.getLines(keyWithWidth(100), linesGenerator);
+  EXPECT_EQ(linesCallCount, 3);
+}
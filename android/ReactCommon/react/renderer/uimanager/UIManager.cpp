@@ -13,6 +13,8 @@
 
 #include <glog/logging.h>
 
+#include <stdexcept>
+
 namespace facebook {
 namespace react {
 
@@ -30,6 +32,63 @@ SharedShadowNode UIManager::createNode(
   SystraceSection s("UIManager::createNode");
 
   auto &componentDescriptor = componentDescriptorRegistry_->at(name);
+  return createNode(
+      componentDescriptor,
+      tag,
+      name,
+      surfaceId,
+      rawProps,
+      std::move(eventTarget));
+}
+
+SharedShadowNode UIManager::createNode(
+    Tag tag,
+    InternedComponentHandle internedComponentHandle,
+    SurfaceId surfaceId,
+    const RawProps &rawProps,
+    SharedEventTarget eventTarget) const {
+  SystraceSection s("UIManager::createNode");
+
+  auto internedComponent = componentDescriptorRegistry_->findInternedComponent(
+      internedComponentHandle);
+  if (internedComponent == nullptr) {
+    throw std::invalid_argument("Unknown interned component handle");
+  }
+
+  if (internedComponent->isFallback) {
+    // The component might have been registered since the name was interned.
+    return createNode(
+        tag,
+        internedComponent->viewName,
+        surfaceId,
+        rawProps,
+        std::move(eventTarget));
+  }
+
+  return createNode(
+      *internedComponent->componentDescriptor,
+      tag,
+      internedComponent->viewName,
+      surfaceId,
+      rawProps,
+      std::move(eventTarget));
+}
+
+InternedComponentHandle UIManager::internComponentName(
+    std::string const &name) const {
+  return componentDescriptorRegistry_->internComponentName(name);
+}
+
+SharedShadowNode UIManager::createNode(
+    ComponentDescriptor const &componentDescriptor,
+    Tag tag,
+    std::string const &name,
+    SurfaceId surfaceId,
+    const RawProps &rawProps,
+    SharedEventTarget eventTarget) const {
+  auto arena = getSurfaceArena(surfaceId);
+  SurfaceArena::Scope arenaScope(arena.get());
+
   auto fallbackDescriptor =
       componentDescriptorRegistry_->getFallbackComponentDescriptor();
 
@@ -67,6 +126,9 @@ SharedShadowNode UIManager::cloneNode(
     const RawProps *rawProps) const {
   SystraceSection s("UIManager::cloneNode");
 
+  auto arena = getSurfaceArena(shadowNode->getSurfaceId());
+  SurfaceArena::Scope arenaScope(arena.get());
+
   auto &componentDescriptor = shadowNode->getComponentDescriptor();
   auto clonedShadowNode = componentDescriptor.cloneShadowNode(
       *shadowNode,
@@ -88,6 +150,17 @@ void UIManager::appendChild(
 
   auto &componentDescriptor = parentShadowNode->getComponentDescriptor();
   componentDescriptor.appendChild(parentShadowNode, childShadowNode);
+
+  // Text is the only kind of content which is worth preparing ahead of
+  // layout (and looking up the layout context for).
+  if (experimentEnableTextPremeasurement && backgroundExecutor_ &&
+      childShadowNode->getTraits().check(ShadowNodeTraits::Trait::TextKind)) {
+    childShadowNode->getComponentDescriptor().prepareLayout(
+        *parentShadowNode,
+        childShadowNode,
+        getLayoutContext(childShadowNode->getSurfaceId()),
+        backgroundExecutor_);
+  }
 }
 
 void UIManager::completeSurface(
@@ -332,6 +405,35 @@ ShadowTreeRegistry const &UIManager::getShadowTreeRegistry() const {
 
 #pragma mark - ShadowTreeDelegate
 
+SurfaceArena::Shared UIManager::getSurfaceArena(SurfaceId surfaceId) const {
+  if (!experimentEnableSurfaceArenas) {
+    return nullptr;
+  }
+
+  if (cachedArenaSurfaceId_ == surfaceId) {
+    return cachedArena_.lock();
+  }
+
+  auto arena = SurfaceArena::Shared{};
+  shadowTreeRegistry_.visit(surfaceId, [&](ShadowTree const &shadowTree) {
+    arena = shadowTree.getArena();
+  });
+
+  cachedArenaSurfaceId_ = surfaceId;
+  cachedArena_ = arena;
+  return arena;
+}
+
+LayoutContext UIManager::getLayoutContext(SurfaceId surfaceId) const {
+  auto layoutContext = LayoutContext{};
+  shadowTreeRegistry_.visit(surfaceId, [&](ShadowTree const &shadowTree) {
+    layoutContext = shadowTree.getCurrentRevision()
+                        .rootShadowNode->getConcreteProps()
+                        .layoutContext;
+  });
+  return layoutContext;
+}
+
 void UIManager::shadowTreeDidFinishTransaction(
     ShadowTree const &shadowTree,
     MountingCoordinator::Shared const &mountingCoordinator) const {
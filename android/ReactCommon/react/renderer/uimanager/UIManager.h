@@ -67,6 +67,12 @@ class UIManager final : public ShadowTreeDelegate {
       std::function<void(UIManagerBinding const &uiManagerBinding)> callback)
       const;
 
+  /*
+   * The shadow trees of the running surfaces, which `completeRoot` commits
+   * to.
+   */
+  ShadowTreeRegistry const &getShadowTreeRegistry() const;
+
 #pragma mark - ShadowTreeDelegate
 
   void shadowTreeDidFinishTransaction(
@@ -77,6 +83,8 @@ class UIManager final : public ShadowTreeDelegate {
    * Temporary flags.
    */
   bool experimentEnableStateUpdateWithAutorepeat{false};
+  bool experimentEnableSurfaceArenas{false};
+  bool experimentEnableTextPremeasurement{false};
 
  private:
   friend class UIManagerBinding;
@@ -89,6 +97,28 @@ class UIManager final : public ShadowTreeDelegate {
       const RawProps &props,
       SharedEventTarget eventTarget) const;
 
+  /*
+   * Same as above, but takes a name resolved by `internComponentName`;
+   * finding a component descriptor this way does not lock.
+   */
+  ShadowNode::Shared createNode(
+      Tag tag,
+      InternedComponentHandle internedComponentHandle,
+      SurfaceId surfaceId,
+      const RawProps &props,
+      SharedEventTarget eventTarget) const;
+
+  InternedComponentHandle internComponentName(
+      std::string const &componentName) const;
+
+  ShadowNode::Shared createNode(
+      ComponentDescriptor const &componentDescriptor,
+      Tag tag,
+      std::string const &componentName,
+      SurfaceId surfaceId,
+      const RawProps &props,
+      SharedEventTarget eventTarget) const;
+
   ShadowNode::Shared cloneNode(
       const ShadowNode::Shared &shadowNode,
       const SharedShadowNodeSharedList &children = nullptr,
@@ -148,7 +178,16 @@ class UIManager final : public ShadowTreeDelegate {
       jsi::Value const &successCallback,
       jsi::Value const &failureCallback) const;
 
-  ShadowTreeRegistry const &getShadowTreeRegistry() const;
+  /*
+   * Returns the arena of a shadow tree with given `surfaceId` or `nullptr`
+   * if arenas are disabled. Must be called on the JavaScript thread.
+   */
+  SurfaceArena::Shared getSurfaceArena(SurfaceId surfaceId) const;
+
+  /*
+   * Returns the layout context the surface was last laid out with.
+   */
+  LayoutContext getLayoutContext(SurfaceId surfaceId) const;
 
   SharedComponentDescriptorRegistry componentDescriptorRegistry_;
   UIManagerDelegate *delegate_;
@@ -162,6 +201,12 @@ class UIManager final : public ShadowTreeDelegate {
   // determine whether a commit should be cancelled. Only to be used
   // inside UIManagerBinding.
   std::atomic_uint_fast8_t completeRootEventCounter_{0};
+
+  // Used only when `experimentEnableSurfaceArenas` is enabled.
+  // Accessed on the JavaScript thread only. The reference is weak, so the
+  // cache does not keep memory of a stopped surface alive.
+  mutable SurfaceId cachedArenaSurfaceId_{-1};
+  mutable std::weak_ptr<SurfaceArena> cachedArena_;
 };
 
 } // namespace react
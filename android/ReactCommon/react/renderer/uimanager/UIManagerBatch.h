@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Opcodes of a command buffer accepted by `nativeFabricUIManager.applyBatch`.
+ *
+ * `applyBatch(buffer, values)` takes an `ArrayBuffer` of 32-bit integers and
+ * an array of JavaScript values. Every command is an opcode followed by a
+ * fixed number of operands. Shadow nodes and child sets are referred to by
+ * *slots* (indices in two separate per-batch tables), JavaScript values
+ * (component names, props, instance handles, existing nodes) by indices in
+ * `values`. Slots must be less than the number of words of the buffer.
+ * A `props` operand of `-1` means "no props".
+ *
+ * The call returns an array of the nodes referred to by `ExportNode`
+ * commands, in order.
+ */
+enum class UIManagerBatchOpcode : int32_t {
+  /*
+   * `slot, tag, surfaceId, componentName, props, instanceHandle`
+   * Same as `createNode`; the component name value can be a string or
+   * a number returned by `internComponentName`.
+   */
+  CreateNode = 0,
+
+  /*
+   * `slot, sourceSlot, props, flags`
+   * Same as `cloneNode*`; `props` may be `-1`; `flags & 1` drops children.
+   */
+  CloneNode = 1,
+
+  /*
+   * `parentSlot, childSlot`
+   * Same as `appendChild`.
+   */
+  AppendChild = 2,
+
+  /*
+   * `childSetSlot`
+   * Same as `createChildSet`.
+   */
+  CreateChildSet = 3,
+
+  /*
+   * `childSetSlot, childSlot`
+   * Same as `appendChildToSet`.
+   */
+  AppendChildToSet = 4,
+
+  /*
+   * `surfaceId, childSetSlot`
+   * Same as `completeRoot`.
+   */
+  CompleteRoot = 5,
+
+  /*
+   * `slot, node`
+   * Puts a node created outside of the batch (a value of `values`) into
+   * a slot.
+   */
+  ImportNode = 6,
+
+  /*
+   * `slot`
+   * Adds a node to the result of the call.
+   */
+  ExportNode = 7,
+};
+
+/*
+ * Value of `flags` of `CloneNode` which makes the clone have no children.
+ */
+constexpr int32_t UIManagerBatchCloneWithEmptyChildren = 1;
+
+} // namespace react
+} // namespace facebook
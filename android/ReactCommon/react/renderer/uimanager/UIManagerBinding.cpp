@@ -8,10 +8,16 @@
 #include "UIManagerBinding.h"
 
 #include <react/renderer/debug/SystraceSection.h>
+#include <react/renderer/uimanager/UIManagerBatch.h>
 
 #include <glog/logging.h>
 #include <jsi/JSIDynamic.h>
 
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 namespace facebook {
 namespace react {
 
@@ -33,6 +39,20 @@ static jsi::Object getModule(
   return moduleAsValue.asObject(runtime);
 }
 
+/*
+ * Calls `function` and reports a view name or an interned component handle
+ * rejected by the component registry as a JavaScript error.
+ */
+template <typename FunctionT>
+static auto resolvingComponent(jsi::Runtime &runtime, FunctionT &&function)
+    -> decltype(function()) {
+  try {
+    return function();
+  } catch (std::logic_error const &error) {
+    throw jsi::JSError(runtime, error.what());
+  }
+}
+
 std::shared_ptr<UIManagerBinding> UIManagerBinding::createAndInstallIfNeeded(
     jsi::Runtime &runtime) {
   auto uiManagerModuleName = "nativeFabricUIManager";
@@ -171,6 +191,219 @@ void UIManagerBinding::invalidate() const {
   uiManager_->setDelegate(nullptr);
 }
 
+void UIManagerBinding::completeSurface(
+    std::shared_ptr<UIManager> const &uiManager,
+    SurfaceId surfaceId,
+    SharedShadowNodeUnsharedList const &rootChildren) {
+  if (!uiManager->backgroundExecutor_) {
+    uiManager->completeSurface(surfaceId, rootChildren, {true, {}});
+    return;
+  }
+
+  uiManager->completeRootEventCounter_ += 1;
+  uiManager->backgroundExecutor_(
+      [uiManager,
+       surfaceId,
+       rootChildren,
+       eventCount = uiManager->completeRootEventCounter_.load()] {
+        auto shouldCancel = [eventCount, uiManager]() -> bool {
+          // If `eventCounter_` was incremented, another `completeSurface`
+          // call has been scheduled and current `completeSurface` should be
+          // cancelled.
+          return uiManager->completeRootEventCounter_ > eventCount;
+        };
+        uiManager->completeSurface(
+            surfaceId, rootChildren, {true, shouldCancel});
+      });
+}
+
+jsi::Value UIManagerBinding::applyBatch(
+    jsi::Runtime &runtime,
+    jsi::ArrayBuffer &buffer,
+    jsi::Array const &values) const {
+  SystraceSection s("UIManagerBinding::applyBatch");
+
+  auto words = reinterpret_cast<int32_t const *>(buffer.data(runtime));
+  auto wordCount = buffer.size(runtime) / sizeof(int32_t);
+  auto valueCount = values.size(runtime);
+
+  auto nodes = std::vector<ShadowNode::Shared>{};
+  auto childSets = std::vector<SharedShadowNodeUnsharedList>{};
+  // Component names are usually shared by many nodes of a batch; they are
+  // interned once per value.
+  auto componentHandles =
+      std::unordered_map<int32_t, InternedComponentHandle>{};
+  auto exportedNodes = std::vector<ShadowNode::Shared>{};
+
+  auto position = size_t{0};
+
+  auto fail = [&](char const *reason) {
+    throw jsi::JSError(
+        runtime,
+        std::string{"applyBatch: "} + reason + " at word " +
+            std::to_string(position));
+  };
+
+  auto operandAt = [&](size_t offset) -> int32_t {
+    if (position + offset >= wordCount) {
+      fail("unexpected end of the buffer");
+    }
+    return words[position + offset];
+  };
+
+  auto valueAt = [&](int32_t index) -> jsi::Value {
+    if (index < 0 || static_cast<size_t>(index) >= valueCount) {
+      fail("value index is out of bounds");
+    }
+    return values.getValueAtIndex(runtime, index);
+  };
+
+  auto nodeValueAt = [&](int32_t index) -> ShadowNode::Shared {
+    auto value = valueAt(index);
+    if (!value.isObject() ||
+        !value.getObject(runtime).isHostObject<ShadowNodeWrapper>(runtime)) {
+      fail("value is not a node");
+    }
+    return shadowNodeFromValue(runtime, value);
+  };
+
+  auto nodeAt = [&](int32_t slot) -> ShadowNode::Shared const & {
+    if (slot < 0 || static_cast<size_t>(slot) >= nodes.size() ||
+        !nodes[slot]) {
+      fail("node slot is empty");
+    }
+    return nodes[slot];
+  };
+
+  // Every command which fills a slot takes at least two words, so a batch
+  // never needs more slots than it has words. Bounding slots by that keeps
+  // a bogus slot from growing the tables.
+  auto checkSlot = [&](int32_t slot) {
+    if (slot < 0 || static_cast<size_t>(slot) >= wordCount) {
+      fail("slot is out of bounds");
+    }
+  };
+
+  auto setNodeAt = [&](int32_t slot, ShadowNode::Shared node) {
+    checkSlot(slot);
+    if (static_cast<size_t>(slot) >= nodes.size()) {
+      nodes.resize(slot + 1);
+    }
+    nodes[slot] = std::move(node);
+  };
+
+  auto childSetAt =
+      [&](int32_t slot) -> SharedShadowNodeUnsharedList const & {
+    if (slot < 0 || static_cast<size_t>(slot) >= childSets.size() ||
+        !childSets[slot]) {
+      fail("child set slot is empty");
+    }
+    return childSets[slot];
+  };
+
+  while (position < wordCount) {
+    auto opcode = static_cast<UIManagerBatchOpcode>(words[position]);
+    switch (opcode) {
+      case UIManagerBatchOpcode::CreateNode: {
+        auto tag = static_cast<Tag>(operandAt(2));
+        auto nameIndex = operandAt(4);
+        auto componentHandle = componentHandles.find(nameIndex);
+        if (componentHandle == componentHandles.end()) {
+          auto nameValue = valueAt(nameIndex);
+          auto internedComponentHandle = nameValue.isNumber()
+              ? internedComponentHandleFromValue(runtime, nameValue)
+              : resolvingComponent(runtime, [&] {
+                  return uiManager_->internComponentName(
+                      stringFromValue(runtime, nameValue));
+                });
+          componentHandle =
+              componentHandles.emplace(nameIndex, internedComponentHandle)
+                  .first;
+        }
+        auto surfaceId = static_cast<SurfaceId>(operandAt(3));
+        auto rawProps = RawProps(runtime, valueAt(operandAt(5)));
+        auto eventTarget =
+            std::make_shared<EventTarget>(runtime, valueAt(operandAt(6)), tag);
+        setNodeAt(operandAt(1), resolvingComponent(runtime, [&] {
+                    return uiManager_->createNode(
+                        tag,
+                        componentHandle->second,
+                        surfaceId,
+                        rawProps,
+                        std::move(eventTarget));
+                  }));
+        position += 7;
+        break;
+      }
+      case UIManagerBatchOpcode::CloneNode: {
+        auto const &sourceNode = nodeAt(operandAt(2));
+        auto propsIndex = operandAt(3);
+        auto children = SharedShadowNodeSharedList{};
+        if (operandAt(4) & UIManagerBatchCloneWithEmptyChildren) {
+          children = ShadowNode::emptySharedShadowNodeSharedList();
+        }
+        auto clonedNode = ShadowNode::Shared{};
+        if (propsIndex != -1) {
+          auto const &rawProps = RawProps(runtime, valueAt(propsIndex));
+          clonedNode = uiManager_->cloneNode(sourceNode, children, &rawProps);
+        } else {
+          clonedNode = uiManager_->cloneNode(sourceNode, children);
+        }
+        setNodeAt(operandAt(1), std::move(clonedNode));
+        position += 5;
+        break;
+      }
+      case UIManagerBatchOpcode::AppendChild: {
+        uiManager_->appendChild(nodeAt(operandAt(1)), nodeAt(operandAt(2)));
+        position += 3;
+        break;
+      }
+      case UIManagerBatchOpcode::CreateChildSet: {
+        auto slot = operandAt(1);
+        checkSlot(slot);
+        if (static_cast<size_t>(slot) >= childSets.size()) {
+          childSets.resize(slot + 1);
+        }
+        childSets[slot] = std::make_shared<SharedShadowNodeList>();
+        position += 2;
+        break;
+      }
+      case UIManagerBatchOpcode::AppendChildToSet: {
+        childSetAt(operandAt(1))->push_back(nodeAt(operandAt(2)));
+        position += 3;
+        break;
+      }
+      case UIManagerBatchOpcode::CompleteRoot: {
+        completeSurface(
+            uiManager_,
+            static_cast<SurfaceId>(operandAt(1)),
+            childSetAt(operandAt(2)));
+        position += 3;
+        break;
+      }
+      case UIManagerBatchOpcode::ImportNode: {
+        setNodeAt(operandAt(1), nodeValueAt(operandAt(2)));
+        position += 3;
+        break;
+      }
+      case UIManagerBatchOpcode::ExportNode: {
+        exportedNodes.push_back(nodeAt(operandAt(1)));
+        position += 2;
+        break;
+      }
+      default:
+        fail("unknown opcode");
+    }
+  }
+
+  auto result = jsi::Array(runtime, exportedNodes.size());
+  for (size_t i = 0; i < exportedNodes.size(); i++) {
+    result.setValueAtIndex(
+        runtime, i, valueFromShadowNode(runtime, exportedNodes[i]));
+  }
+  return result;
+}
+
 jsi::Value UIManagerBinding::get(
     jsi::Runtime &runtime,
     jsi::PropNameID const &name) {
@@ -205,17 +438,57 @@ jsi::Value UIManagerBinding::get(
   //    a CPU tick (or more) after the JS VM is deallocated.
   UIManager *uiManager = uiManager_.get();
 
+  // Semantic: Resolves a view name into a number which can be passed to
+  // `createNode` (and `applyBatch`) instead of the name.
+  if (methodName == "internComponentName") {
+    return jsi::Function::createFromHostFunction(
+        runtime,
+        name,
+        1,
+        // Not `noexcept`: the registry rejects names past its capacity.
+        [uiManager](
+            jsi::Runtime & runtime,
+            jsi::Value const &thisValue,
+            jsi::Value const *arguments,
+            size_t count) -> jsi::Value {
+          auto viewName = stringFromValue(runtime, arguments[0]);
+          return jsi::Value{resolvingComponent(runtime, [&] {
+            return uiManager->internComponentName(viewName);
+          })};
+        });
+  }
+
   // Semantic: Creates a new node with given pieces.
   if (methodName == "createNode") {
     return jsi::Function::createFromHostFunction(
         runtime,
         name,
         5,
+        // Not `noexcept`: an unknown interned component handle is reported
+        // as a JavaScript error.
         [uiManager](
             jsi::Runtime & runtime,
             jsi::Value const &thisValue,
             jsi::Value const *arguments,
-            size_t count) noexcept->jsi::Value {
+            size_t count) -> jsi::Value {
+          if (arguments[1].isNumber()) {
+            auto tag = tagFromValue(runtime, arguments[0]);
+            auto internedComponentHandle =
+                internedComponentHandleFromValue(runtime, arguments[1]);
+            auto surfaceId = surfaceIdFromValue(runtime, arguments[2]);
+            auto rawProps = RawProps(runtime, arguments[3]);
+            auto eventTarget =
+                eventTargetFromValue(runtime, arguments[4], arguments[0]);
+            return valueFromShadowNode(
+                runtime, resolvingComponent(runtime, [&] {
+                  return uiManager->createNode(
+                      tag,
+                      internedComponentHandle,
+                      surfaceId,
+                      rawProps,
+                      std::move(eventTarget));
+                }));
+          }
           return valueFromShadowNode(
               runtime,
               uiManager->createNode(
@@ -425,37 +698,15 @@ jsi::Value UIManagerBinding::get(
           runtime,
           name,
           2,
-          [ uiManager, sharedUIManager = uiManager_ ](
+          [sharedUIManager = uiManager_](
               jsi::Runtime & runtime,
               jsi::Value const &thisValue,
               jsi::Value const *arguments,
               size_t count) noexcept->jsi::Value {
-            auto surfaceId = surfaceIdFromValue(runtime, arguments[0]);
-            auto shadowNodeList =
-                shadowNodeListFromValue(runtime, arguments[1]);
-
-            if (sharedUIManager->backgroundExecutor_) {
-              sharedUIManager->completeRootEventCounter_ += 1;
-              sharedUIManager->backgroundExecutor_(
-                  [sharedUIManager,
-                   surfaceId,
-                   shadowNodeList,
-                   eventCount =
-                       sharedUIManager->completeRootEventCounter_.load()] {
-                    auto shouldCancel = [eventCount,
-                                         sharedUIManager]() -> bool {
-                      // If `eventCounter_` was incremented, another
-                      // `completeSurface` call has been scheduled and current
-                      // `completeSurface` should be cancelled.
-                      return sharedUIManager->completeRootEventCounter_ >
-                          eventCount;
-                    };
-                    sharedUIManager->completeSurface(
-                        surfaceId, shadowNodeList, {true, shouldCancel});
-                  });
-            } else {
-              uiManager->completeSurface(surfaceId, shadowNodeList, {true, {}});
-            }
+            completeSurface(
+                sharedUIManager,
+                surfaceIdFromValue(runtime, arguments[0]),
+                shadowNodeListFromValue(runtime, arguments[1]));
 
             return jsi::Value::undefined();
           });
@@ -481,6 +732,36 @@ jsi::Value UIManagerBinding::get(
     }
   }
 
+  // Semantic: Runs a sequence of `createNode`, `cloneNode*`, `appendChild`,
+  // `createChildSet`, `appendChildToSet` and `completeRoot` calls encoded
+  // in an `ArrayBuffer` (see `UIManagerBatch.h`).
+  if (methodName == "applyBatch") {
+    return jsi::Function::createFromHostFunction(
+        runtime,
+        name,
+        2,
+        // Not `noexcept`: a malformed buffer is reported as a JavaScript error.
+        [this](
+            jsi::Runtime & runtime,
+            jsi::Value const &thisValue,
+            jsi::Value const *arguments,
+            size_t count) -> jsi::Value {
+          if (count < 2 || !arguments[0].isObject() ||
+              !arguments[0].getObject(runtime).isArrayBuffer(runtime) ||
+              !arguments[1].isObject() ||
+              !arguments[1].getObject(runtime).isArray(runtime)) {
+            throw jsi::JSError(
+                runtime, "applyBatch expects an ArrayBuffer and an Array");
+          }
+          auto buffer =
+              arguments[0].getObject(runtime).getArrayBuffer(runtime);
+          return applyBatch(
+              runtime,
+              buffer,
+              arguments[1].getObject(runtime).getArray(runtime));
+        });
+  }
+
   if (methodName == "registerEventHandler") {
     return jsi::Function::createFromHostFunction(
         runtime,
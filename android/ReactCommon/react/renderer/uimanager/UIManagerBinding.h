@@ -81,6 +81,24 @@ class UIManagerBinding : public jsi::HostObject {
   jsi::Value get(jsi::Runtime &runtime, jsi::PropNameID const &name) override;
 
  private:
+  /*
+   * Runs the commands of `nativeFabricUIManager.applyBatch` (see
+   * `UIManagerBatchOpcode`) and returns the exported nodes.
+   */
+  jsi::Value applyBatch(
+      jsi::Runtime &runtime,
+      jsi::ArrayBuffer &buffer,
+      jsi::Array const &values) const;
+
+  /*
+   * Commits the new children of a surface, asynchronously if `uiManager` has
+   * a background executor.
+   */
+  static void completeSurface(
+      std::shared_ptr<UIManager> const &uiManager,
+      SurfaceId surfaceId,
+      SharedShadowNodeUnsharedList const &rootChildren);
+
   std::shared_ptr<UIManager> uiManager_;
   std::unique_ptr<EventHandler const> eventHandler_;
 };
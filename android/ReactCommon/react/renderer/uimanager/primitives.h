@@ -10,9 +10,12 @@
 #include <folly/dynamic.h>
 #include <jsi/JSIDynamic.h>
 #include <jsi/jsi.h>
+#include <react/renderer/componentregistry/ComponentDescriptorRegistry.h>
 #include <react/renderer/core/EventHandler.h>
 #include <react/renderer/core/ShadowNode.h>
 
+#include <limits>
+
 namespace facebook {
 namespace react {
 
@@ -88,6 +91,19 @@ inline static SurfaceId surfaceIdFromValue(
   return (SurfaceId)value.getNumber();
 }
 
+inline static InternedComponentHandle internedComponentHandleFromValue(
+    jsi::Runtime &runtime,
+    jsi::Value const &value) {
+  auto number = value.getNumber();
+  // Converting a number out of the range of the handle is undefined; such
+  // numbers (and NaN) are mapped to `-1`, which is never a valid handle.
+  if (!(number >= 0 &&
+        number <= std::numeric_limits<InternedComponentHandle>::max())) {
+    return -1;
+  }
+  return (InternedComponentHandle)number;
+}
+
 inline static std::string stringFromValue(
     jsi::Runtime &runtime,
     jsi::Value const &value) {
@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/image/ImageComponentDescriptor.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/scrollview/ScrollViewComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeDelegate.h>
+#include <react/renderer/uimanager/UIManager.h>
+#include <react/renderer/uimanager/UIManagerBinding.h>
+#include <react/utils/ContextContainer.h>
+
+namespace facebook {
+namespace react {
+
+class DummyShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  void shadowTreeDidFinishTransaction(
+      ShadowTree const &shadowTree,
+      MountingCoordinator::Shared const &mountingCoordinator) const override{};
+};
+
+/*
+ * A `UIManager` with `View` registered and `ScrollView` as the fallback
+ * component, bound to a Hermes runtime as `nativeFabricUIManager`.
+ */
+class UIManagerBindingTest : public ::testing::Test {
+ protected:
+  UIManagerBindingTest() {
+    auto contextContainer = std::make_shared<ContextContainer const>();
+    auto eventDispatcher = EventDispatcher::Shared{};
+    auto parameters =
+        ComponentDescriptorParameters{eventDispatcher, contextContainer};
+
+    providerRegistry_.add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+    componentDescriptorRegistry_ =
+        providerRegistry_.createComponentDescriptorRegistry(parameters);
+    std::const_pointer_cast<ComponentDescriptorRegistry>(
+        componentDescriptorRegistry_)
+        ->setFallbackComponentDescriptor(
+            std::make_shared<ScrollViewComponentDescriptor>(parameters));
+
+    uiManager_ = std::make_shared<UIManager>();
+    uiManager_->setDelegate(nullptr);
+    uiManager_->setComponentDescriptorRegistry(componentDescriptorRegistry_);
+
+    runtime_ = hermes::makeHermesRuntime();
+    binding_ = UIManagerBinding::createAndInstallIfNeeded(*runtime_);
+    binding_->attach(uiManager_);
+  }
+
+  ~UIManagerBindingTest() {
+    binding_->attach(nullptr);
+  }
+
+  jsi::Value evaluate(std::string const &source) {
+    return runtime_->evaluateJavaScript(
+        std::make_shared<jsi::StringBuffer>(source), "test.js");
+  }
+
+  /*
+   * Evaluates `expression` and returns the message of the error it throws.
+   */
+  std::string errorMessageOf(std::string const &expression) {
+    auto message = evaluate(
+        "(function() { try { " + expression +
+        "; } catch (error) { return error.message; } return ''; })()");
+    return message.asString(*runtime_).utf8(*runtime_);
+  }
+
+  ShadowNode::Shared createNodeWithHandle(
+      Tag tag,
+      InternedComponentHandle handle) {
+    auto node = evaluate(
+        "nativeFabricUIManager.createNode(" + std::to_string(tag) + ", " +
+        std::to_string(handle) + ", 1, {}, {})");
+    return shadowNodeFromValue(*runtime_, node);
+  }
+
+  /*
+   * Returns JavaScript which applies a batch made of `words` with the global
+   * `values` array.
+   */
+  static std::string batch(std::string const &words) {
+    return "nativeFabricUIManager.applyBatch(new Int32Array([" + words +
+        "]).buffer, values)";
+  }
+
+  /*
+   * Evaluates `expression`, which returns the nodes exported by a batch.
+   */
+  std::vector<ShadowNode::Shared> exportedNodesOf(
+      std::string const &expression) {
+    auto array = evaluate(expression).asObject(*runtime_).asArray(*runtime_);
+    auto nodes = std::vector<ShadowNode::Shared>{};
+    for (size_t i = 0; i < array.size(*runtime_); i++) {
+      nodes.push_back(
+          shadowNodeFromValue(*runtime_, array.getValueAtIndex(*runtime_, i)));
+    }
+    return nodes;
+  }
+
+  static std::string nativeIdOf(ShadowNode::Shared const &node) {
+    return std::static_pointer_cast<ViewProps const>(node->getProps())
+        ->nativeId;
+  }
+
+  ComponentDescriptorProviderRegistry providerRegistry_{};
+  SharedComponentDescriptorRegistry componentDescriptorRegistry_;
+  std::shared_ptr<UIManager> uiManager_;
+  std::unique_ptr<jsi::Runtime> runtime_;
+  std::shared_ptr<UIManagerBinding> binding_;
+};
+
+TEST_F(UIManagerBindingTest, testInterningTheSameNameReturnsTheSameHandle) {
+  auto const &registry = *componentDescriptorRegistry_;
+  auto viewHandle = registry.internComponentName("View");
+  EXPECT_EQ(registry.internComponentName("View"), viewHandle);
+  EXPECT_NE(registry.internComponentName("ScrollView"), viewHandle);
+
+  auto handleFromJS =
+      evaluate("nativeFabricUIManager.internComponentName('View')");
+  EXPECT_EQ(handleFromJS.asNumber(), viewHandle);
+
+  auto internedComponent = registry.findInternedComponent(viewHandle);
+  ASSERT_NE(internedComponent, nullptr);
+  EXPECT_EQ(internedComponent->viewName, "View");
+  EXPECT_FALSE(internedComponent->isFallback);
+
+  auto node = createNodeWithHandle(7, viewHandle);
+  EXPECT_EQ(std::string{node->getComponentName()}, "View");
+  EXPECT_EQ(node->getTag(), 7);
+}
+
+TEST_F(UIManagerBindingTest, testFallbackNamesAreResolvedAgainWhenCreating) {
+  auto const &registry = *componentDescriptorRegistry_;
+  auto imageHandle = registry.internComponentName("Image");
+  auto internedComponent = registry.findInternedComponent(imageHandle);
+  ASSERT_NE(internedComponent, nullptr);
+  EXPECT_TRUE(internedComponent->isFallback);
+  EXPECT_EQ(
+      internedComponent->componentDescriptor,
+      registry.getFallbackComponentDescriptor());
+
+  EXPECT_EQ(
+      std::string{createNodeWithHandle(2, imageHandle)->getComponentName()},
+      "ScrollView");
+
+  // A component registered after the name was interned is picked up.
+  providerRegistry_.add(
+      concreteComponentDescriptorProvider<ImageComponentDescriptor>());
+  EXPECT_EQ(registry.internComponentName("Image"), imageHandle);
+  EXPECT_EQ(
+      std::string{createNodeWithHandle(4, imageHandle)->getComponentName()},
+      "Image");
+}
+
+TEST_F(UIManagerBindingTest, testInvalidHandlesAreReportedAsJSErrors) {
+  auto viewHandle =
+      componentDescriptorRegistry_->internComponentName("View");
+
+  for (auto handle : {std::to_string(viewHandle + 1),
+                      std::string{"-1"},
+                      std::string{"1e20"},
+                      std::string{"NaN"}}) {
+    EXPECT_EQ(
+        errorMessageOf(
+            "nativeFabricUIManager.createNode(2, " + handle + ", 1, {}, {})"),
+        "Unknown interned component handle")
+        << handle;
+  }
+
+  // The binding is still usable.
+  EXPECT_EQ(
+      std::string{createNodeWithHandle(2, viewHandle)->getComponentName()},
+      "View");
+}
+
+TEST_F(UIManagerBindingTest, testRunningOutOfHandlesIsReportedAsJSError) {
+  auto message = errorMessageOf(
+      "for (var i = 0; i < 10000; i++) {"
+      "  nativeFabricUIManager.internComponentName('View' + i);"
+      "}");
+  EXPECT_EQ(message, "Too many distinct view names were interned");
+
+  // Names interned before keep their handles.
+  auto handle = evaluate("nativeFabricUIManager.internComponentName('View0')");
+  EXPECT_EQ(
+      handle.asNumber(),
+      componentDescriptorRegistry_->internComponentName("View0"));
+}
+
+TEST_F(UIManagerBindingTest, testBatchCreatesAndClonesNodes) {
+  evaluate(
+      "var existing = nativeFabricUIManager.createNode(20, 'View', 1, {}, {});"
+      "var values = ["
+      "  nativeFabricUIManager.internComponentName('View'),"
+      "  {nativeID: 'a'}, {}, 'View', {nativeID: 'b'}, existing];");
+
+  auto nodes = exportedNodesOf(batch(
+      // `CreateNode` with an interned name and with a string name.
+      "0, 0, 10, 1, 0, 1, 2,"
+      "0, 1, 11, 1, 3, 2, 2,"
+      // `AppendChild`
+      "2, 0, 1,"
+      // `CloneNode` with new props, and without props and children.
+      "1, 2, 0, 4, 0,"
+      "1, 3, 0, -1, 1,"
+      // `ImportNode`
+      "6, 4, 5,"
+      // `ExportNode`
+      "7, 0, 7, 1, 7, 2, 7, 3, 7, 4"));
+
+  ASSERT_EQ(nodes.size(), 5);
+  EXPECT_EQ(nodes[0]->getTag(), 10);
+  EXPECT_EQ(std::string{nodes[0]->getComponentName()}, "View");
+  EXPECT_EQ(nativeIdOf(nodes[0]), "a");
+  ASSERT_EQ(nodes[0]->getChildren().size(), 1);
+  EXPECT_EQ(nodes[0]->getChildren()[0], nodes[1]);
+
+  EXPECT_EQ(nodes[1]->getTag(), 11);
+  EXPECT_EQ(std::string{nodes[1]->getComponentName()}, "View");
+  EXPECT_EQ(nativeIdOf(nodes[1]), "");
+
+  EXPECT_EQ(nodes[2]->getTag(), 10);
+  EXPECT_EQ(nativeIdOf(nodes[2]), "b");
+  EXPECT_EQ(nodes[2]->getChildren(), nodes[0]->getChildren());
+
+  EXPECT_EQ(nodes[3]->getTag(), 10);
+  EXPECT_EQ(nativeIdOf(nodes[3]), "a");
+  EXPECT_TRUE(nodes[3]->getChildren().empty());
+
+  EXPECT_EQ(
+      nodes[4], shadowNodeFromValue(*runtime_, evaluate("existing")));
+}
+
+TEST_F(UIManagerBindingTest, testBatchCompletesRoot) {
+  auto shadowTreeDelegate = DummyShadowTreeDelegate{};
+  auto eventDispatcher = EventDispatcher::Shared{};
+  RootComponentDescriptor rootComponentDescriptor{
+      ComponentDescriptorParameters{eventDispatcher, nullptr, nullptr}};
+  auto const &shadowTreeRegistry = uiManager_->getShadowTreeRegistry();
+  shadowTreeRegistry.add(std::make_unique<ShadowTree>(
+      SurfaceId{1},
+      LayoutConstraints{},
+      LayoutContext{},
+      rootComponentDescriptor,
+      shadowTreeDelegate,
+      std::weak_ptr<MountingOverrideDelegate const>{}));
+
+  evaluate("var values = ['View', {}, {}];");
+  auto nodes = exportedNodesOf(batch(
+      "0, 0, 10, 1, 0, 1, 2,"
+      "0, 1, 11, 1, 0, 1, 2,"
+      // `CreateChildSet`, `AppendChildToSet` and `CompleteRoot`
+      "3, 0,"
+      "4, 0, 0,"
+      "4, 0, 1,"
+      "5, 1, 0,"
+      "7, 0, 7, 1"));
+
+  auto rootChildren = SharedShadowNodeList{};
+  shadowTreeRegistry.visit(1, [&](ShadowTree const &shadowTree) {
+    rootChildren =
+        shadowTree.getCurrentRevision().rootShadowNode->getChildren();
+  });
+  ASSERT_EQ(rootChildren.size(), 2);
+  EXPECT_EQ(rootChildren[0]->getTag(), 10);
+  EXPECT_EQ(rootChildren[1]->getTag(), 11);
+  EXPECT_EQ(rootChildren, nodes);
+
+  shadowTreeRegistry.remove(1);
+}
+
+TEST_F(UIManagerBindingTest, testMalformedBatchesAreReportedAsJSErrors) {
+  evaluate("var values = ['View', {}, {}];");
+  auto const createNode = std::string{"0, 0, 10, 1, 0, 1, 2"};
+
+  auto expectations = std::vector<std::pair<std::string, std::string>>{
+      {"0, 0, 10, 1", "unexpected end of the buffer at word 0"},
+      {createNode + ", 1, 1, 0", "unexpected end of the buffer at word 7"},
+      {"99", "unknown opcode at word 0"},
+      {createNode + ", -1", "unknown opcode at word 7"},
+      {"0, 0, 10, 1, 3, 1, 2", "value index is out of bounds at word 0"},
+      {createNode + ", 1, 1, 0, -2, 0",
+       "value index is out of bounds at word 7"},
+      {"7, 0", "node slot is empty at word 0"},
+      {createNode + ", 2, 0, 1", "node slot is empty at word 7"},
+      {createNode + ", 1, 1, -1, -1, 0", "node slot is empty at word 7"},
+      {"4, 0, 0", "child set slot is empty at word 0"},
+      {"3, 0, 5, 1, 1", "child set slot is empty at word 2"},
+      {"0, 1000000, 10, 1, 0, 1, 2", "slot is out of bounds at word 0"},
+      {"3, 2", "slot is out of bounds at word 0"},
+      {"3, -1", "slot is out of bounds at word 0"},
+      {"6, 0, 1", "value is not a node at word 0"},
+  };
+  for (auto const &expectation : expectations) {
+    EXPECT_EQ(
+        errorMessageOf(batch(expectation.first)),
+        "applyBatch: " + expectation.second)
+        << expectation.first;
+  }
+
+  for (auto arguments : {std::string{""},
+                         std::string{"new Int32Array([7, 0]), values"},
+                         std::string{"new ArrayBuffer(0), {}"}}) {
+    EXPECT_EQ(
+        errorMessageOf(
+            "nativeFabricUIManager.applyBatch(" + arguments + ")"),
+        "applyBatch expects an ArrayBuffer and an Array")
+        << arguments;
+  }
+
+  // The binding is still usable.
+  auto nodes = exportedNodesOf(batch(createNode + ", 7, 0"));
+  ASSERT_EQ(nodes.size(), 1);
+  EXPECT_EQ(nodes[0]->getTag(), 10);
+}
+
+} // namespace react
+} // namespace facebook
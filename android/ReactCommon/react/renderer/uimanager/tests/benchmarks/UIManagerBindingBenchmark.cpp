@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <hermes/hermes.h>
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+#include <react/renderer/uimanager/UIManager.h>
+#include <react/renderer/uimanager/UIManagerBinding.h>
+#include <react/utils/ContextContainer.h>
+#include <memory>
+#include <string>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Builds a tree of `count` views (every node has up to four children) the
+ * way the React renderer does during the first render: children are created
+ * before their parents, then the root is completed.
+ * `renderWithCalls` uses one host function call per operation,
+ * `renderWithBatch` encodes the same operations for `applyBatch`.
+ * There is no surface with the given id, so `completeRoot` does not commit.
+ */
+static auto const renderSource = std::string{R"JS(
+var UIManager = nativeFabricUIManager;
+var props = {flex: 1, padding: 4, backgroundColor: 0xff00ff00};
+
+function renderWithCalls(count, surfaceId) {
+  var nodes = new Array(count);
+  for (var i = count - 1; i >= 0; i--) {
+    var node = UIManager.createNode(i * 2 + 2, 'View', surfaceId, props, {});
+    for (var child = i * 4 + 1; child <= i * 4 + 4 && child < count; child++) {
+      UIManager.appendChild(node, nodes[child]);
+    }
+    nodes[i] = node;
+  }
+  var childSet = UIManager.createChildSet(surfaceId);
+  UIManager.appendChildToSet(childSet, nodes[0]);
+  UIManager.completeRoot(surfaceId, childSet);
+  return nodes;
+}
+
+function renderWithBatch(count, surfaceId) {
+  var words = new Int32Array(count * 9 + (count - 1) * 3 + 8);
+  var values = ['View', props];
+  var position = 0;
+  for (var i = count - 1; i >= 0; i--) {
+    values.push({});
+    words[position++] = 0; // CreateNode
+    words[position++] = i;
+    words[position++] = i * 2 + 2;
+    words[position++] = surfaceId;
+    words[position++] = 0;
+    words[position++] = 1;
+    words[position++] = values.length - 1;
+    for (var child = i * 4 + 1; child <= i * 4 + 4 && child < count; child++) {
+      words[position++] = 2; // AppendChild
+      words[position++] = i;
+      words[position++] = child;
+    }
+    words[position++] = 7; // ExportNode
+    words[position++] = i;
+  }
+  words[position++] = 3; // CreateChildSet
+  words[position++] = 0;
+  words[position++] = 4; // AppendChildToSet
+  words[position++] = 0;
+  words[position++] = 0;
+  words[position++] = 5; // CompleteRoot
+  words[position++] = surfaceId;
+  words[position++] = 0;
+  return UIManager.applyBatch(words.buffer, values);
+}
+)JS"};
+
+class RenderEnvironment {
+ public:
+  RenderEnvironment() {
+    auto contextContainer = std::make_shared<ContextContainer const>();
+    auto eventDispatcher = EventDispatcher::Weak{};
+
+    ComponentDescriptorProviderRegistry providerRegistry{};
+    providerRegistry.add(
+        concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+    componentDescriptorRegistry_ =
+        providerRegistry.createComponentDescriptorRegistry(
+            {eventDispatcher, contextContainer});
+
+    uiManager_ = std::make_shared<UIManager>();
+    uiManager_->setDelegate(nullptr);
+    uiManager_->setComponentDescriptorRegistry(componentDescriptorRegistry_);
+
+    runtime_ = hermes::makeHermesRuntime();
+    binding_ = UIManagerBinding::createAndInstallIfNeeded(*runtime_);
+    binding_->attach(uiManager_);
+
+    runtime_->evaluateJavaScript(
+        std::make_shared<jsi::StringBuffer>(renderSource), "render.js");
+  }
+
+  ~RenderEnvironment() {
+    binding_->attach(nullptr);
+  }
+
+  void render(std::string const &functionName, int count) {
+    auto function = runtime_->global().getPropertyAsFunction(
+        *runtime_, functionName.c_str());
+    auto nodes = function.call(*runtime_, count, 1);
+    benchmark::DoNotOptimize(nodes);
+  }
+
+ private:
+  SharedComponentDescriptorRegistry componentDescriptorRegistry_;
+  std::shared_ptr<UIManager> uiManager_;
+  std::unique_ptr<jsi::Runtime> runtime_;
+  std::shared_ptr<UIManagerBinding> binding_;
+};
+
+static RenderEnvironment &renderEnvironment() {
+  static RenderEnvironment environment;
+  return environment;
+}
+
+static void firstRenderWithCalls(benchmark::State &state) {
+  auto &environment = renderEnvironment();
+  for (auto _ : state) {
+    environment.render("renderWithCalls", state.range(0));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(firstRenderWithCalls)->Arg(1000)->Arg(5000)->Arg(10000);
+
+static void firstRenderWithBatch(benchmark::State &state) {
+  auto &environment = renderEnvironment();
+  for (auto _ : state) {
+    environment.render("renderWithBatch", state.range(0));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(firstRenderWithBatch)->Arg(1000)->Arg(5000)->Arg(10000);
+
+} // namespace react
+} // namespace facebook
+
+BENCHMARK_MAIN();
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "StartupTimeline.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+namespace facebook {
+namespace react {
+namespace StartupTimeline {
+
+namespace {
+
+struct InstanceEvents {
+  std::vector<Event> events;
+  int droppedEvents{0};
+};
+
+std::atomic<bool> g_isRecording{false};
+std::mutex g_mutex;
+size_t g_capacity = 0;
+std::unordered_map<int32_t, InstanceEvents> g_instances;
+
+bool isNamed(const Event &event, const char *name) {
+  return strcmp(event.name, name) == 0;
+}
+
+/**
+ * Returns the span from the first `startName` event to the first `endName`
+ * event which follows it.
+ */
+Span getSpan(
+    const std::vector<Event> &events,
+    Clock::time_point origin,
+    const char *startName,
+    const char *endName) {
+  Span span;
+  const Event *start = nullptr;
+  for (const auto &event : events) {
+    if (start == nullptr && isNamed(event, startName)) {
+      start = &event;
+    } else if (start != nullptr && isNamed(event, endName)) {
+      span.isRecorded = true;
+      span.start = start->time - origin;
+      span.end = event.time - origin;
+      break;
+    }
+  }
+  return span;
+}
+
+/**
+ * Sums up sections delimited by `startName` and `endName` events, pairing
+ * them by tag (sections with the same tag are expected to be nested).
+ */
+Total getTotal(
+    const std::vector<Event> &events,
+    const char *startName,
+    const char *endName) {
+  Total total;
+  std::unordered_map<std::string, std::vector<Clock::time_point>> starts;
+  for (const auto &event : events) {
+    if (isNamed(event, startName)) {
+      starts[event.tag].push_back(event.time);
+    } else if (isNamed(event, endName)) {
+      auto &tagStarts = starts[event.tag];
+      if (tagStarts.empty()) {
+        continue;
+      }
+      total.count++;
+      total.time += event.time - tagStarts.back();
+      tagStarts.pop_back();
+    }
+  }
+  return total;
+}
+
+double toMilliseconds(Clock::duration duration) {
+  return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+void appendSpanJSON(std::string &json, const char *name, const Span &span) {
+  char buffer[128];
+  if (!span.isRecorded) {
+    snprintf(buffer, sizeof(buffer), "\"%s\":null", name);
+  } else {
+    snprintf(
+        buffer,
+        sizeof(buffer),
+        "\"%s\":{\"start\":%.3f,\"duration\":%.3f}",
+        name,
+        toMilliseconds(span.start),
+        toMilliseconds(span.getDuration()));
+  }
+  json += buffer;
+}
+
+void appendTotalJSON(std::string &json, const char *name, const Total &total) {
+  char buffer[128];
+  snprintf(
+      buffer,
+      sizeof(buffer),
+      "\"%s\":{\"count\":%d,\"time\":%.3f}",
+      name,
+      total.count,
+      toMilliseconds(total.time));
+  json += buffer;
+}
+
+} // namespace
+
+void start(size_t capacity) {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  g_capacity = capacity;
+  g_instances.clear();
+  g_isRecording = true;
+}
+
+void stop() {
+  g_isRecording = false;
+}
+
+bool isRecording() {
+  return g_isRecording.load(std::memory_order_relaxed);
+}
+
+void logEvent(const char *name, const char *tag, int32_t instanceKey) {
+  if (!isRecording()) {
+    return;
+  }
+  logEvent(name, tag, instanceKey, Clock::now());
+}
+
+void logEvent(
+    const char *name,
+    const char *tag,
+    int32_t instanceKey,
+    Clock::time_point time) {
+  if (!isRecording()) {
+    return;
+  }
+
+  auto event = Event{name,
+                     tag ? std::string{tag} : std::string{},
+                     instanceKey,
+                     time,
+                     std::this_thread::get_id()};
+
+  std::lock_guard<std::mutex> lock(g_mutex);
+  auto &instance = g_instances[instanceKey];
+  if (instance.events.size() >= g_capacity) {
+    instance.droppedEvents++;
+    return;
+  }
+  instance.events.push_back(std::move(event));
+}
+
+std::vector<Event> getEvents(int32_t instanceKey) {
+  std::lock_guard<std::mutex> lock(g_mutex);
+  auto iterator = g_instances.find(instanceKey);
+  if (iterator == g_instances.end()) {
+    return {};
+  }
+  auto events = iterator->second.events;
+
+  // Events with explicit times (e.g. the first commit) can be logged late.
+  std::stable_sort(
+      events.begin(), events.end(), [](const Event &lhs, const Event &rhs) {
+        return lhs.time < rhs.time;
+      });
+  return events;
+}
+
+Breakdown getBreakdown(int32_t instanceKey) {
+  auto events = getEvents(instanceKey);
+
+  Breakdown breakdown;
+  breakdown.instanceKey = instanceKey;
+  {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    auto iterator = g_instances.find(instanceKey);
+    if (iterator != g_instances.end()) {
+      breakdown.droppedEvents = iterator->second.droppedEvents;
+    }
+  }
+  if (events.empty()) {
+    return breakdown;
+  }
+
+  auto origin = events.front().time;
+  breakdown.origin = origin;
+  breakdown.instanceInit = getSpan(
+      events, origin, kReactInstanceInitStart, kReactInstanceInitStop);
+  breakdown.bundleLoad =
+      getSpan(events, origin, kRunJSBundleStart, kRunJSBundleStop);
+  breakdown.firstCommit =
+      getSpan(events, origin, kFirstCommitStart, kFirstCommitEnd);
+  breakdown.firstMount =
+      getSpan(events, origin, kFirstMountStart, kFirstMountEnd);
+  breakdown.nativeModuleSetup =
+      getTotal(events, kNativeModuleSetupStart, kNativeModuleSetupStop);
+  breakdown.moduleCreate =
+      getTotal(events, kModuleCreateStart, kModuleCreateEnd);
+  breakdown.jsSegmentRegistration =
+      getTotal(events, kRegisterJSSegmentStart, kRegisterJSSegmentStop);
+  return breakdown;
+}
+
+std::string getBreakdownJSON(int32_t instanceKey) {
+  auto breakdown = getBreakdown(instanceKey);
+
+  auto json = std::string{"{\"instanceKey\":"} +
+      std::to_string(breakdown.instanceKey) + ",";
+  appendSpanJSON(json, "instanceInit", breakdown.instanceInit);
+  json += ",";
+  appendSpanJSON(json, "bundleLoad", breakdown.bundleLoad);
+  json += ",";
+  appendSpanJSON(json, "firstCommit", breakdown.firstCommit);
+  json += ",";
+  appendSpanJSON(json, "firstMount", breakdown.firstMount);
+  json += ",";
+  appendTotalJSON(json, "nativeModuleSetup", breakdown.nativeModuleSetup);
+  json += ",";
+  appendTotalJSON(json, "moduleCreate", breakdown.moduleCreate);
+  json += ",";
+  appendTotalJSON(
+      json, "jsSegmentRegistration", breakdown.jsSegmentRegistration);
+  json += ",\"droppedEvents\":" + std::to_string(breakdown.droppedEvents) + "}";
+  return json;
+}
+
+} // namespace StartupTimeline
+} // namespace react
+} // namespace facebook
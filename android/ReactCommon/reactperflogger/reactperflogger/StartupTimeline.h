@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace facebook {
+namespace react {
+
+/**
+ * Records timestamped startup events (ReactMarker markers, native module
+ * creation, and the first commit and mount of Fabric surfaces) and turns them
+ * into a cold start breakdown.
+ *
+ * Events are kept per instance key. Events which are not associated with an
+ * instance (module creation, Fabric, markers logged without a key) use
+ * `kDefaultInstanceKey`.
+ */
+namespace StartupTimeline {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int32_t kDefaultInstanceKey = 0;
+
+/**
+ * Names of the events which the breakdown is made of.
+ */
+constexpr const char *kReactInstanceInitStart = "REACT_INSTANCE_INIT_START";
+constexpr const char *kReactInstanceInitStop = "REACT_INSTANCE_INIT_STOP";
+constexpr const char *kRunJSBundleStart = "RUN_JS_BUNDLE_START";
+constexpr const char *kRunJSBundleStop = "RUN_JS_BUNDLE_STOP";
+constexpr const char *kNativeModuleSetupStart = "NATIVE_MODULE_SETUP_START";
+constexpr const char *kNativeModuleSetupStop = "NATIVE_MODULE_SETUP_STOP";
+constexpr const char *kRegisterJSSegmentStart = "REGISTER_JS_SEGMENT_START";
+constexpr const char *kRegisterJSSegmentStop = "REGISTER_JS_SEGMENT_STOP";
+/**
+ * Logged by `BridgeNativeModulePerfLogger` and `TurboModulePerfLogger`, with
+ * the module name as tag.
+ */
+constexpr const char *kModuleCreateStart = "moduleCreateStart";
+constexpr const char *kModuleCreateEnd = "moduleCreateEnd";
+constexpr const char *kFirstCommitStart = "FIRST_COMMIT_START";
+constexpr const char *kFirstCommitEnd = "FIRST_COMMIT_END";
+constexpr const char *kFirstMountStart = "FIRST_MOUNT_START";
+constexpr const char *kFirstMountEnd = "FIRST_MOUNT_END";
+
+struct Event {
+  /**
+   * Must be a string with static storage duration.
+   */
+  const char *name;
+  std::string tag;
+  int32_t instanceKey;
+  Clock::time_point time;
+  std::thread::id threadId;
+};
+
+/**
+ * Part of startup, relative to the first event of the instance.
+ */
+struct Span {
+  bool isRecorded{false};
+  Clock::duration start{};
+  Clock::duration end{};
+
+  Clock::duration getDuration() const {
+    return end - start;
+  }
+};
+
+/**
+ * Time spent in (possibly many) sections of a kind, e.g. setting up native
+ * modules. Sections of a kind can overlap, so `time` is not wall time.
+ */
+struct Total {
+  int count{0};
+  Clock::duration time{};
+};
+
+struct Breakdown {
+  int32_t instanceKey{kDefaultInstanceKey};
+  /**
+   * Time of the first event of the instance.
+   */
+  Clock::time_point origin{};
+  Span instanceInit{};
+  Span bundleLoad{};
+  Span firstCommit{};
+  Span firstMount{};
+  Total nativeModuleSetup{};
+  Total moduleCreate{};
+  Total jsSegmentRegistration{};
+  /**
+   * Events which were not recorded because the timeline was full.
+   */
+  int droppedEvents{0};
+};
+
+/**
+ * Starts recording, dropping previously recorded events. At most `capacity`
+ * events are kept per instance.
+ */
+void start(size_t capacity = 4096);
+void stop();
+bool isRecording();
+
+/**
+ * Can be called from any thread; does nothing unless recording.
+ */
+void logEvent(
+    const char *name,
+    const char *tag = nullptr,
+    int32_t instanceKey = kDefaultInstanceKey);
+void logEvent(
+    const char *name,
+    const char *tag,
+    int32_t instanceKey,
+    Clock::time_point time);
+
+std::vector<Event> getEvents(int32_t instanceKey = kDefaultInstanceKey);
+Breakdown getBreakdown(int32_t instanceKey = kDefaultInstanceKey);
+
+/**
+ * Returns the breakdown as a JSON object, with times in milliseconds.
+ */
+std::string getBreakdownJSON(int32_t instanceKey = kDefaultInstanceKey);
+
+} // namespace StartupTimeline
+
+} // namespace react
+} // namespace facebook
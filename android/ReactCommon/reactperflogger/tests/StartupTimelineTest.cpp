@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <chrono>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <reactperflogger/BridgeNativeModulePerfLogger.h>
+#include <reactperflogger/StartupTimeline.h>
+
+namespace facebook {
+namespace react {
+
+using namespace std::chrono_literals;
+
+class StartupTimelineTest : public ::testing::Test {
+ protected:
+  StartupTimelineTest() {
+    StartupTimeline::start();
+  }
+
+  ~StartupTimelineTest() {
+    StartupTimeline::stop();
+  }
+
+  /*
+   * Logs an event `offset` after the origin of the test.
+   */
+  void log(
+      const char *name,
+      StartupTimeline::Clock::duration offset,
+      const char *tag = nullptr,
+      int32_t instanceKey = StartupTimeline::kDefaultInstanceKey) {
+    StartupTimeline::logEvent(name, tag, instanceKey, origin_ + offset);
+  }
+
+  StartupTimeline::Clock::time_point origin_{StartupTimeline::Clock::now()};
+};
+
+TEST_F(StartupTimelineTest, testSpansStartAtFirstStartAndEndAtNextStop) {
+  log("ORIGIN", 0ms);
+  log(StartupTimeline::kRunJSBundleStop, 2ms);
+  log(StartupTimeline::kRunJSBundleStart, 3ms);
+  log(StartupTimeline::kRunJSBundleStart, 4ms);
+  log(StartupTimeline::kRunJSBundleStop, 7ms);
+  log(StartupTimeline::kRunJSBundleStop, 9ms);
+
+  auto breakdown = StartupTimeline::getBreakdown();
+  EXPECT_EQ(breakdown.origin, origin_);
+  ASSERT_TRUE(breakdown.bundleLoad.isRecorded);
+  EXPECT_EQ(breakdown.bundleLoad.start, 3ms);
+  EXPECT_EQ(breakdown.bundleLoad.end, 7ms);
+  EXPECT_EQ(breakdown.bundleLoad.getDuration(), 4ms);
+}
+
+TEST_F(StartupTimelineTest, testSpansWithoutStopAreNotRecorded) {
+  log(StartupTimeline::kFirstCommitStart, 1ms);
+  log(StartupTimeline::kFirstMountStart, 2ms);
+  log(StartupTimeline::kFirstMountEnd, 5ms);
+
+  auto breakdown = StartupTimeline::getBreakdown();
+  EXPECT_FALSE(breakdown.firstCommit.isRecorded);
+  EXPECT_FALSE(breakdown.instanceInit.isRecorded);
+  ASSERT_TRUE(breakdown.firstMount.isRecorded);
+  EXPECT_EQ(breakdown.firstMount.start, 1ms);
+  EXPECT_EQ(breakdown.firstMount.getDuration(), 3ms);
+
+  auto json = StartupTimeline::getBreakdownJSON();
+  EXPECT_NE(json.find("\"firstCommit\":null"), std::string::npos) << json;
+  EXPECT_NE(
+      json.find("\"firstMount\":{\"start\":1.000,\"duration\":3.000}"),
+      std::string::npos)
+      << json;
+}
+
+TEST_F(StartupTimelineTest, testTotalsPairSectionsByTag) {
+  // `A` and `B` overlap; the sections of the second `A` are nested.
+  log(StartupTimeline::kModuleCreateStart, 0ms, "A");
+  log(StartupTimeline::kModuleCreateStart, 1ms, "B");
+  log(StartupTimeline::kModuleCreateEnd, 3ms, "B");
+  log(StartupTimeline::kModuleCreateEnd, 6ms, "A");
+  log(StartupTimeline::kModuleCreateStart, 7ms, "A");
+  log(StartupTimeline::kModuleCreateStart, 8ms, "A");
+  log(StartupTimeline::kModuleCreateEnd, 9ms, "A");
+  log(StartupTimeline::kModuleCreateEnd, 12ms, "A");
+  // Ends without a start and starts without an end are not counted.
+  log(StartupTimeline::kModuleCreateEnd, 13ms, "C");
+  log(StartupTimeline::kModuleCreateStart, 14ms, "D");
+
+  auto breakdown = StartupTimeline::getBreakdown();
+  EXPECT_EQ(breakdown.moduleCreate.count, 4);
+  EXPECT_EQ(breakdown.moduleCreate.time, 6ms + 2ms + 1ms + 5ms);
+  EXPECT_EQ(breakdown.nativeModuleSetup.count, 0);
+  EXPECT_EQ(breakdown.nativeModuleSetup.time, 0ms);
+}
+
+TEST_F(StartupTimelineTest, testEventsLoggedLateAreOrderedByTime) {
+  log(StartupTimeline::kFirstCommitEnd, 5ms);
+  log(StartupTimeline::kFirstCommitStart, 2ms);
+  log("ORIGIN", 0ms);
+
+  auto events = StartupTimeline::getEvents();
+  ASSERT_EQ(events.size(), 3);
+  EXPECT_STREQ(events[0].name, "ORIGIN");
+  EXPECT_STREQ(events[1].name, StartupTimeline::kFirstCommitStart);
+  EXPECT_STREQ(events[2].name, StartupTimeline::kFirstCommitEnd);
+
+  auto breakdown = StartupTimeline::getBreakdown();
+  EXPECT_EQ(breakdown.firstCommit.start, 2ms);
+  EXPECT_EQ(breakdown.firstCommit.getDuration(), 3ms);
+}
+
+TEST_F(StartupTimelineTest, testInstancesAreKeptApart) {
+  log(StartupTimeline::kReactInstanceInitStart, 1ms, nullptr, 1);
+  log(StartupTimeline::kReactInstanceInitStop, 3ms, nullptr, 2);
+  log(StartupTimeline::kReactInstanceInitStop, 4ms, nullptr, 1);
+
+  auto breakdown = StartupTimeline::getBreakdown(1);
+  EXPECT_EQ(breakdown.instanceKey, 1);
+  ASSERT_TRUE(breakdown.instanceInit.isRecorded);
+  EXPECT_EQ(breakdown.instanceInit.start, 0ms);
+  EXPECT_EQ(breakdown.instanceInit.getDuration(), 3ms);
+  EXPECT_FALSE(StartupTimeline::getBreakdown(2).instanceInit.isRecorded);
+  EXPECT_TRUE(StartupTimeline::getEvents().empty());
+}
+
+TEST_F(StartupTimelineTest, testRecordsOnlyWhileRecording) {
+  StartupTimeline::start(2);
+  log("FIRST", 0ms);
+  log("SECOND", 1ms);
+  log("THIRD", 2ms);
+  EXPECT_EQ(StartupTimeline::getEvents().size(), 2);
+  EXPECT_EQ(StartupTimeline::getBreakdown().droppedEvents, 1);
+
+  StartupTimeline::stop();
+  EXPECT_FALSE(StartupTimeline::isRecording());
+  StartupTimeline::start();
+  log("FOURTH", 3ms);
+  StartupTimeline::stop();
+  log("FIFTH", 4ms);
+
+  auto events = StartupTimeline::getEvents();
+  ASSERT_EQ(events.size(), 1);
+  EXPECT_STREQ(events[0].name, "FOURTH");
+  EXPECT_EQ(StartupTimeline::getBreakdown().droppedEvents, 0);
+}
+
+TEST_F(StartupTimelineTest, testRecordsModuleCreation) {
+  BridgeNativeModulePerfLogger::moduleCreateStart("Module", 1);
+  BridgeNativeModulePerfLogger::moduleCreateEnd("Module", 1);
+
+  auto events = StartupTimeline::getEvents();
+  ASSERT_EQ(events.size(), 2);
+  EXPECT_EQ(events[0].tag, "Module");
+  EXPECT_EQ(StartupTimeline::getBreakdown().moduleCreate.count, 1);
+}
+
+} // namespace react
+} // namespace facebook
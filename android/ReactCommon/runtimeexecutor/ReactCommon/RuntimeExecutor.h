@@ -12,6 +12,8 @@
 
 #include <jsi/jsi.h>
 
+#include <ReactCommon/RuntimeExecutorScheduler.h>
+
 namespace facebook {
 namespace react {
 
@@ -35,13 +37,28 @@ using RuntimeExecutor =
  * about when the `callback` will be executed (before returning to the caller,
  * after that, or in parallel), the only thing that is guaranteed is that there
  * is no synchronization.
+ * The `runtimeExecutor` is called from a shared scheduler thread; tasks with a
+ * higher `priority` are handed over first. The thread serves all runtimes, so
+ * the `runtimeExecutor` must not block on its runtime.
  */
+inline static void executeAsynchronously(
+    RuntimeExecutor const &runtimeExecutor,
+    RuntimeExecutorPriority priority,
+    std::function<void(jsi::Runtime &runtime)> &&callback) noexcept {
+  RuntimeExecutorScheduler::sharedInstance().schedule(
+      priority,
+      [callback = std::move(callback), runtimeExecutor]() mutable {
+        runtimeExecutor(std::move(callback));
+      });
+}
+
 inline static void executeAsynchronously(
     RuntimeExecutor const &runtimeExecutor,
     std::function<void(jsi::Runtime &runtime)> &&callback) noexcept {
-  std::thread{[callback = std::move(callback), runtimeExecutor]() mutable {
-    runtimeExecutor(std::move(callback));
-  }};
+  executeAsynchronously(
+      runtimeExecutor,
+      RuntimeExecutorPriority::AsynchronousBatched,
+      std::move(callback));
 }
 
 /*
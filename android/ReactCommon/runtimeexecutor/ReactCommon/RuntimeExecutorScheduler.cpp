@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "RuntimeExecutorScheduler.h"
+
+#include <algorithm>
+
+namespace facebook {
+namespace react {
+
+static int bucketForLatency(std::chrono::microseconds latency) {
+  auto value = static_cast<uint64_t>(std::max<int64_t>(latency.count(), 0));
+  int bucket = 0;
+  while (value > 0 &&
+         bucket < RuntimeExecutorLatencyHistogram::kBucketCount - 1) {
+    value >>= 1;
+    bucket++;
+  }
+  return bucket;
+}
+
+std::chrono::microseconds RuntimeExecutorLatencyHistogram::percentile(
+    double percentile) const {
+  if (count == 0) {
+    return std::chrono::microseconds{0};
+  }
+
+  auto threshold = static_cast<uint64_t>(percentile * count);
+  auto accumulated = uint64_t{0};
+  for (int bucket = 0; bucket < kBucketCount; bucket++) {
+    accumulated += buckets[bucket];
+    if (accumulated > threshold || accumulated == count) {
+      return std::min(
+          std::chrono::microseconds{int64_t{1} << bucket}, maxLatency);
+    }
+  }
+  return maxLatency;
+}
+
+#pragma mark - Lane
+
+RuntimeExecutorScheduler::Lane::Lane() : head_(&stub_), tail_(&stub_) {}
+
+RuntimeExecutorScheduler::Lane::~Lane() {
+  Task task;
+  Clock::time_point enqueueTime;
+  while (pop(task, enqueueTime)) {
+  }
+  if (tail_ != &stub_) {
+    delete tail_;
+  }
+}
+
+void RuntimeExecutorScheduler::Lane::push(Node *node) noexcept {
+  node->next.store(nullptr, std::memory_order_relaxed);
+  auto previous = head_.exchange(node, std::memory_order_acq_rel);
+  previous->next.store(node, std::memory_order_release);
+}
+
+bool RuntimeExecutorScheduler::Lane::pop(
+    Task &task,
+    Clock::time_point &enqueueTime) noexcept {
+  auto tail = tail_;
+  auto next = tail->next.load(std::memory_order_acquire);
+  if (next == nullptr) {
+    // Either the lane is empty or a producer is in the middle of `push`; in
+    // the latter case the task will be picked on the next iteration.
+    return false;
+  }
+
+  // `next` becomes the new stub; its payload is moved out.
+  task = std::move(next->task);
+  enqueueTime = next->enqueueTime;
+  tail_ = next;
+
+  if (tail != &stub_) {
+    delete tail;
+  }
+  return true;
+}
+
+#pragma mark - RuntimeExecutorScheduler
+
+RuntimeExecutorScheduler &RuntimeExecutorScheduler::sharedInstance() {
+  // Intentionally leaked: the worker must outlive any static destructor that
+  // might still schedule work.
+  static auto scheduler = new RuntimeExecutorScheduler();
+  return *scheduler;
+}
+
+RuntimeExecutorScheduler::RuntimeExecutorScheduler(
+    std::chrono::microseconds timeSlice)
+    : timeSlice_(timeSlice) {
+  thread_ = std::thread([this]() { loop(); });
+}
+
+RuntimeExecutorScheduler::~RuntimeExecutorScheduler() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    isRunning_ = false;
+  }
+  condition_.notify_one();
+  thread_.join();
+}
+
+void RuntimeExecutorScheduler::schedule(
+    RuntimeExecutorPriority priority,
+    Task &&task) noexcept {
+  auto node = new Node{};
+  node->task = std::move(task);
+  node->enqueueTime = Clock::now();
+
+  lanes_[static_cast<int>(priority)].push(node);
+
+  if (pendingCount_.fetch_add(1, std::memory_order_acq_rel) == 0) {
+    // The worker might be about to sleep; taking the mutex guarantees that it
+    // either observes the new count or is already waiting for the signal.
+    std::lock_guard<std::mutex> lock(mutex_);
+    condition_.notify_one();
+  }
+}
+
+RuntimeExecutorLatencyHistogram RuntimeExecutorScheduler::getLatencyHistogram(
+    RuntimeExecutorPriority priority) const noexcept {
+  auto &statistics = statistics_[static_cast<int>(priority)];
+  auto histogram = RuntimeExecutorLatencyHistogram{};
+  for (int bucket = 0; bucket < RuntimeExecutorLatencyHistogram::kBucketCount;
+       bucket++) {
+    histogram.buckets[bucket] =
+        statistics.buckets[bucket].load(std::memory_order_relaxed);
+  }
+  histogram.count = statistics.count.load(std::memory_order_relaxed);
+  histogram.maxLatency = std::chrono::microseconds{
+      statistics.maxLatency.load(std::memory_order_relaxed)};
+  return histogram;
+}
+
+void RuntimeExecutorScheduler::resetLatencyHistograms() noexcept {
+  for (auto &statistics : statistics_) {
+    for (auto &bucket : statistics.buckets) {
+      bucket.store(0, std::memory_order_relaxed);
+    }
+    statistics.count.store(0, std::memory_order_relaxed);
+    statistics.maxLatency.store(0, std::memory_order_relaxed);
+  }
+}
+
+void RuntimeExecutorScheduler::recordLatency(
+    int lane,
+    Clock::duration latency) noexcept {
+  auto microseconds =
+      std::chrono::duration_cast<std::chrono::microseconds>(latency);
+  auto &statistics = statistics_[lane];
+  statistics.buckets[bucketForLatency(microseconds)].fetch_add(
+      1, std::memory_order_relaxed);
+  statistics.count.fetch_add(1, std::memory_order_relaxed);
+
+  auto maxLatency = statistics.maxLatency.load(std::memory_order_relaxed);
+  while (microseconds.count() > maxLatency &&
+         !statistics.maxLatency.compare_exchange_weak(
+             maxLatency, microseconds.count(), std::memory_order_relaxed)) {
+  }
+}
+
+bool RuntimeExecutorScheduler::runNextTask() noexcept {
+  Task task;
+  Clock::time_point enqueueTime;
+
+  for (int lane = 0; lane < kLaneCount; lane++) {
+    if (!lanes_[lane].pop(task, enqueueTime)) {
+      continue;
+    }
+
+    pendingCount_.fetch_sub(1, std::memory_order_acq_rel);
+    recordLatency(lane, Clock::now() - enqueueTime);
+
+    auto isBatched =
+        lane == static_cast<int>(RuntimeExecutorPriority::SynchronousBatched) ||
+        lane == static_cast<int>(RuntimeExecutorPriority::AsynchronousBatched);
+
+    task();
+    return isBatched;
+  }
+
+  // The counter is incremented before a producer finishes linking a node;
+  // let the producer complete.
+  std::this_thread::yield();
+  return false;
+}
+
+void RuntimeExecutorScheduler::loop() noexcept {
+  auto sliceStartTime = Clock::now();
+  auto isInSlice = false;
+
+  while (true) {
+    if (pendingCount_.load(std::memory_order_acquire) == 0 ||
+        !isRunning_.load(std::memory_order_acquire)) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this]() {
+        return !isRunning_ ||
+            pendingCount_.load(std::memory_order_acquire) > 0;
+      });
+      if (!isRunning_) {
+        return;
+      }
+    }
+
+    // Higher lanes are re-checked before every task, so a newly enqueued
+    // discrete event is started right after the currently running task.
+    auto isBatched = runNextTask();
+
+    if (!isBatched) {
+      isInSlice = false;
+      continue;
+    }
+
+    auto now = Clock::now();
+    if (!isInSlice) {
+      isInSlice = true;
+      sliceStartTime = now;
+    } else if (now - sliceStartTime >= timeSlice_) {
+      isInSlice = false;
+      std::this_thread::yield();
+    }
+  }
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace facebook {
+namespace react {
+
+/*
+ * Priority lanes of `RuntimeExecutorScheduler`.
+ * The order and the values match `EventPriority` (see
+ * `react/renderer/core/EventPriority.h`), so a value of one can be
+ * `static_cast`-ed to another. The module does not depend on the renderer,
+ * hence the separate type.
+ */
+enum class RuntimeExecutorPriority : int {
+  SynchronousUnbatched = 0,
+  SynchronousBatched = 1,
+  AsynchronousUnbatched = 2,
+  AsynchronousBatched = 3,
+};
+
+/*
+ * A histogram of times tasks spent in a queue before being started.
+ * Bucket `i` counts tasks that waited less than `2^i` microseconds (the last
+ * bucket also collects everything above that).
+ */
+struct RuntimeExecutorLatencyHistogram {
+  static constexpr int kBucketCount = 24;
+
+  std::array<uint64_t, kBucketCount> buckets{};
+  uint64_t count{0};
+  std::chrono::microseconds maxLatency{0};
+
+  /*
+   * Returns an upper bound of a given percentile (in range [0.0, 1.0]).
+   */
+  std::chrono::microseconds percentile(double percentile) const;
+};
+
+/*
+ * A persistent single-worker task scheduler with priority lanes.
+ * Producers on any thread enqueue into a lock-free multi-producer
+ * single-consumer queue of a given lane; the worker always picks a task from
+ * the highest non-empty lane, so a discrete event never waits behind bulk
+ * batched traffic that was enqueued earlier.
+ * Batched lanes are time-sliced: after running them for `timeSlice` the
+ * worker yields the CPU before continuing.
+ *
+ * Tasks run one at a time, in priority order and, within a lane, in the
+ * order they were scheduled. `sharedInstance` is shared by every
+ * `RuntimeExecutor` of the process, so the asynchronous work of all runtimes
+ * is serialized on its worker: a task which blocks (e.g. a `RuntimeExecutor`
+ * which waits for its runtime instead of posting to it) delays the tasks of
+ * every other runtime.
+ *
+ * Destroying a scheduler waits for the running task (if any) to finish;
+ * tasks which have not started by then are destroyed without being run.
+ */
+class RuntimeExecutorScheduler final {
+ public:
+  using Task = std::function<void()>;
+
+  static constexpr int kLaneCount = 4;
+
+  /*
+   * Returns a process-wide instance which backs `executeAsynchronously`.
+   */
+  static RuntimeExecutorScheduler &sharedInstance();
+
+  explicit RuntimeExecutorScheduler(
+      std::chrono::microseconds timeSlice = std::chrono::milliseconds{4});
+  ~RuntimeExecutorScheduler();
+
+  RuntimeExecutorScheduler(RuntimeExecutorScheduler const &) = delete;
+  RuntimeExecutorScheduler &operator=(RuntimeExecutorScheduler const &) =
+      delete;
+
+  /*
+   * Enqueues a task. Can be called from any thread.
+   */
+  void schedule(RuntimeExecutorPriority priority, Task &&task) noexcept;
+
+  /*
+   * Returns a snapshot of a queue-latency histogram of a given lane.
+   */
+  RuntimeExecutorLatencyHistogram getLatencyHistogram(
+      RuntimeExecutorPriority priority) const noexcept;
+
+  /*
+   * Resets all latency histograms.
+   */
+  void resetLatencyHistograms() noexcept;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Node {
+    std::atomic<Node *> next{nullptr};
+    Task task;
+    Clock::time_point enqueueTime;
+  };
+
+  /*
+   * Unbounded MPSC queue (D. Vyukov) with a stub node.
+   * `push` is wait-free, `pop` must only be called by the worker.
+   */
+  class Lane {
+   public:
+    Lane();
+    ~Lane();
+
+    void push(Node *node) noexcept;
+    bool pop(Task &task, Clock::time_point &enqueueTime) noexcept;
+
+   private:
+    std::atomic<Node *> head_;
+    Node *tail_;
+    Node stub_;
+  };
+
+  struct LaneStatistics {
+    std::array<std::atomic<uint64_t>, RuntimeExecutorLatencyHistogram::
+                                          kBucketCount>
+        buckets{};
+    std::atomic<uint64_t> count{0};
+    std::atomic<int64_t> maxLatency{0};
+  };
+
+  void loop() noexcept;
+  bool runNextTask() noexcept;
+  void recordLatency(int lane, Clock::duration latency) noexcept;
+
+  std::array<Lane, kLaneCount> lanes_;
+  std::array<LaneStatistics, kLaneCount> statistics_;
+
+  std::atomic<int64_t> pendingCount_{0};
+  std::atomic<bool> isRunning_{true};
+  std::mutex mutex_;
+  std::condition_variable condition_;
+
+  std::chrono::microseconds const timeSlice_;
+  std::thread thread_;
+};
+
+} // namespace react
+} // namespace facebook
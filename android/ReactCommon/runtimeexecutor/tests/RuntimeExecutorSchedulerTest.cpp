@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ReactCommon/RuntimeExecutorScheduler.h>
+#include <gtest/gtest.h>
+
+namespace facebook {
+namespace react {
+
+using namespace std::chrono_literals;
+
+class RuntimeExecutorSchedulerTest : public ::testing::Test {
+ protected:
+  /*
+   * Occupies the worker of `scheduler` until `unblock` is called, so that
+   * tasks scheduled meanwhile are queued.
+   */
+  void block(RuntimeExecutorScheduler &scheduler) {
+    auto started = std::make_shared<std::promise<void>>();
+    auto startedFuture = started->get_future();
+    scheduler.schedule(
+        RuntimeExecutorPriority::SynchronousUnbatched,
+        [started, released = released_]() {
+          started->set_value();
+          released.wait();
+        });
+    startedFuture.wait();
+  }
+
+  void unblock() {
+    release_.set_value();
+  }
+
+  /*
+   * Waits until all tasks scheduled before are done.
+   */
+  void drain(RuntimeExecutorScheduler &scheduler) {
+    auto done = std::make_shared<std::promise<void>>();
+    auto doneFuture = done->get_future();
+    // The lowest lane runs last.
+    scheduler.schedule(
+        RuntimeExecutorPriority::AsynchronousBatched,
+        [done]() { done->set_value(); });
+    doneFuture.wait();
+  }
+
+  /*
+   * Returns a task which appends `name` to `order_`. Tasks run on the worker
+   * one at a time, and `drain` makes their writes visible to the test.
+   */
+  RuntimeExecutorScheduler::Task record(std::string name) {
+    return [this, name]() { order_.push_back(name); };
+  }
+
+  std::promise<void> release_;
+  std::shared_future<void> released_{release_.get_future().share()};
+  std::vector<std::string> order_;
+};
+
+TEST_F(RuntimeExecutorSchedulerTest, testTasksRunInPriorityOrder) {
+  RuntimeExecutorScheduler scheduler;
+  block(scheduler);
+
+  scheduler.schedule(
+      RuntimeExecutorPriority::AsynchronousBatched, record("async batched 1"));
+  scheduler.schedule(
+      RuntimeExecutorPriority::SynchronousBatched, record("sync batched"));
+  scheduler.schedule(
+      RuntimeExecutorPriority::AsynchronousUnbatched, record("async"));
+  scheduler.schedule(
+      RuntimeExecutorPriority::SynchronousUnbatched, record("sync 1"));
+  scheduler.schedule(
+      RuntimeExecutorPriority::AsynchronousBatched, record("async batched 2"));
+  scheduler.schedule(
+      RuntimeExecutorPriority::SynchronousUnbatched, record("sync 2"));
+
+  unblock();
+  drain(scheduler);
+
+  EXPECT_EQ(
+      order_,
+      (std::vector<std::string>{"sync 1",
+                                "sync 2",
+                                "sync batched",
+                                "async",
+                                "async batched 1",
+                                "async batched 2"}));
+}
+
+TEST_F(RuntimeExecutorSchedulerTest, testUrgentTasksRunBeforeQueuedTasks) {
+  RuntimeExecutorScheduler scheduler;
+  block(scheduler);
+
+  scheduler.schedule(RuntimeExecutorPriority::AsynchronousBatched, [&]() {
+    order_.push_back("batched 1");
+    scheduler.schedule(
+        RuntimeExecutorPriority::SynchronousUnbatched, record("urgent"));
+  });
+  scheduler.schedule(
+      RuntimeExecutorPriority::AsynchronousBatched, record("batched 2"));
+  scheduler.schedule(
+      RuntimeExecutorPriority::AsynchronousBatched, record("batched 3"));
+
+  unblock();
+  drain(scheduler);
+
+  EXPECT_EQ(
+      order_,
+      (std::vector<std::string>{
+          "batched 1", "urgent", "batched 2", "batched 3"}));
+}
+
+TEST_F(RuntimeExecutorSchedulerTest, testTasksOfEachProducerRunInOrder) {
+  constexpr int kProducerCount = 4;
+  constexpr int kTaskCount = 1000;
+
+  RuntimeExecutorScheduler scheduler;
+  auto sequences = std::vector<std::vector<int>>(kProducerCount);
+
+  auto producers = std::vector<std::thread>{};
+  for (int producer = 0; producer < kProducerCount; producer++) {
+    producers.emplace_back([&, producer]() {
+      for (int i = 0; i < kTaskCount; i++) {
+        scheduler.schedule(
+            RuntimeExecutorPriority::AsynchronousBatched,
+            [&, producer, i]() { sequences[producer].push_back(i); });
+      }
+    });
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  drain(scheduler);
+
+  for (auto const &sequence : sequences) {
+    ASSERT_EQ(sequence.size(), size_t{kTaskCount});
+    for (int i = 0; i < kTaskCount; i++) {
+      EXPECT_EQ(sequence[i], i);
+    }
+  }
+}
+
+TEST_F(RuntimeExecutorSchedulerTest, testShutdownDropsTasksWhichDidNotStart) {
+  auto scheduler = std::make_unique<RuntimeExecutorScheduler>();
+  block(*scheduler);
+
+  auto captured = std::make_shared<int>(0);
+  std::atomic<bool> hasRun{false};
+  for (int i = 0; i < 3; i++) {
+    scheduler->schedule(
+        RuntimeExecutorPriority::SynchronousUnbatched,
+        [captured, &hasRun]() { hasRun = true; });
+  }
+
+  std::atomic<bool> isDestroyed{false};
+  auto destroyer = std::thread([&]() {
+    scheduler.reset();
+    isDestroyed = true;
+  });
+
+  // The destructor waits for the running task.
+  std::this_thread::sleep_for(100ms);
+  EXPECT_FALSE(isDestroyed);
+
+  unblock();
+  destroyer.join();
+
+  // Queued tasks were destroyed without being run.
+  EXPECT_FALSE(hasRun);
+  EXPECT_EQ(captured.use_count(), 1);
+}
+
+TEST_F(RuntimeExecutorSchedulerTest, testLatenciesAreRecordedPerLane) {
+  RuntimeExecutorScheduler scheduler;
+  block(scheduler);
+  for (int i = 0; i < 3; i++) {
+    scheduler.schedule(RuntimeExecutorPriority::AsynchronousUnbatched, [] {});
+  }
+  std::this_thread::sleep_for(2ms);
+  unblock();
+  drain(scheduler);
+
+  auto histogram = scheduler.getLatencyHistogram(
+      RuntimeExecutorPriority::AsynchronousUnbatched);
+  EXPECT_EQ(histogram.count, 3u);
+  EXPECT_GE(histogram.maxLatency, 2ms);
+  EXPECT_GE(histogram.percentile(0.5), 2ms);
+  EXPECT_EQ(
+      scheduler
+          .getLatencyHistogram(RuntimeExecutorPriority::SynchronousBatched)
+          .count,
+      0u);
+
+  scheduler.resetLatencyHistograms();
+  histogram = scheduler.getLatencyHistogram(
+      RuntimeExecutorPriority::AsynchronousUnbatched);
+  EXPECT_EQ(histogram.count, 0u);
+  EXPECT_EQ(histogram.maxLatency, 0us);
+}
+
+TEST(RuntimeExecutorLatencyHistogramTest, testPercentiles) {
+  auto histogram = RuntimeExecutorLatencyHistogram{};
+  EXPECT_EQ(histogram.percentile(0.5), 0us);
+
+  // 6 tasks under 4us (bucket 2), 3 under 1024us and 1 of 3000us.
+  histogram.buckets[2] = 6;
+  histogram.buckets[10] = 3;
+  histogram.buckets[12] = 1;
+  histogram.count = 10;
+  histogram.maxLatency = 3000us;
+
+  EXPECT_EQ(histogram.percentile(0), 4us);
+  EXPECT_EQ(histogram.percentile(0.5), 4us);
+  EXPECT_EQ(histogram.percentile(0.6), 1024us);
+  EXPECT_EQ(histogram.percentile(0.9), 3000us);
+  EXPECT_EQ(histogram.percentile(1), 3000us);
+}
+
+} // namespace react
+} // namespace facebook
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace facebook {
+namespace yoga {
+namespace corpus {
+
+inline bool readFile(const std::string& path, std::string& content) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  std::ostringstream stream;
+  stream << file.rdbuf();
+  content = stream.str();
+  return true;
+}
+
+// Expands every path which is a directory into the (sorted) list of files in
+// it.
+inline std::vector<std::string> listCaptures(
+    const std::vector<std::string>& paths) {
+  std::vector<std::string> captures;
+  for (const auto& path : paths) {
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0 || !S_ISDIR(info.st_mode)) {
+      captures.push_back(path);
+      continue;
+    }
+
+    std::vector<std::string> files;
+    if (auto directory = opendir(path.c_str())) {
+      while (auto entry = readdir(directory)) {
+        auto file = path + "/" + entry->d_name;
+        if (entry->d_name[0] != '.' && stat(file.c_str(), &info) == 0 &&
+            S_ISREG(info.st_mode)) {
+          files.push_back(file);
+        }
+      }
+      closedir(directory);
+    }
+    std::sort(files.begin(), files.end());
+    captures.insert(captures.end(), files.begin(), files.end());
+  }
+  return captures;
+}
+
+} // namespace corpus
+} // namespace yoga
+} // namespace facebook
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// Lays out captured trees (see `yoga/capture/capture.h`) and prints timings.
+//
+//   replay [--iterations=N] <capture or directory>...
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <yoga/capture/capture.h>
+#include "YGCaptureCorpus.h"
+
+using namespace facebook::yoga;
+
+int main(int argc, char** argv) {
+  int iterations = 100;
+  std::vector<std::string> paths;
+  for (int i = 1; i < argc; i++) {
+    if (strncmp(argv[i], "--iterations=", 13) == 0) {
+      iterations = std::max(atoi(argv[i] + 13), 1);
+    } else {
+      paths.push_back(argv[i]);
+    }
+  }
+
+  if (paths.empty()) {
+    fprintf(stderr, "Usage: %s [--iterations=N] <capture>...\n", argv[0]);
+    return 1;
+  }
+
+  int status = 0;
+  for (const auto& path : corpus::listCaptures(paths)) {
+    std::string content;
+    if (!corpus::readFile(path, content)) {
+      fprintf(stderr, "%s: can't read the file\n", path.c_str());
+      status = 1;
+      continue;
+    }
+
+    auto replay = capture::Replay::fromCapture(content);
+    if (replay == nullptr) {
+      fprintf(stderr, "%s: not a valid capture\n", path.c_str());
+      status = 1;
+      continue;
+    }
+
+    // The first layout warms up the caches of the allocator.
+    replay->layout();
+
+    auto total = std::chrono::nanoseconds{0};
+    auto fastest = std::chrono::nanoseconds::max();
+    for (int i = 0; i < iterations; i++) {
+      auto start = std::chrono::steady_clock::now();
+      replay->layout();
+      auto duration = std::chrono::steady_clock::now() - start;
+      total += duration;
+      fastest = std::min(
+          fastest,
+          std::chrono::duration_cast<std::chrono::nanoseconds>(duration));
+    }
+
+    printf(
+        "%s: %zu nodes, %zu measurements, %.1f us mean, %.1f us min "
+        "(%.0f x %.0f)\n",
+        path.c_str(),
+        replay->getNodeCount(),
+        replay->getMeasurementCount(),
+        total.count() / 1000.0 / iterations,
+        fastest.count() / 1000.0,
+        YGNodeLayoutGetWidth(replay->getRoot()),
+        YGNodeLayoutGetHeight(replay->getRoot()));
+  }
+  return status;
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// Runs a benchmark for every capture of a corpus (see
+// `yoga/capture/capture.h`); arguments which are not benchmark flags are
+// captures or directories of them.
+//
+//   benchmarks [--benchmark_filter=...] <capture or directory>...
+
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <memory>
+#include <yoga/capture/capture.h>
+#include "YGCaptureCorpus.h"
+
+using namespace facebook::yoga;
+
+static void layoutCapture(
+    ::benchmark::State& state,
+    std::shared_ptr<capture::Replay> replay) {
+  for (auto _ : state) {
+    replay->layout();
+  }
+  state.counters["nodes"] = replay->getNodeCount();
+}
+
+int main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+
+  std::vector<std::string> paths(argv + 1, argv + argc);
+  if (paths.empty()) {
+    fprintf(stderr, "Usage: %s <capture>...\n", argv[0]);
+    return 1;
+  }
+
+  for (const auto& path : corpus::listCaptures(paths)) {
+    std::string content;
+    std::shared_ptr<capture::Replay> replay;
+    if (corpus::readFile(path, content)) {
+      replay = capture::Replay::fromCapture(content);
+    }
+    if (replay == nullptr) {
+      fprintf(stderr, "Skipping %s: not a valid capture\n", path.c_str());
+      continue;
+    }
+    ::benchmark::RegisterBenchmark(path.c_str(), layoutCapture, replay);
+  }
+
+  ::benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <yoga/Yoga.h>
+#include <yoga/capture/capture.h>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace facebook::yoga;
+
+namespace {
+
+struct Text {
+  float width;
+};
+
+YGSize measureText(
+    YGNodeRef node,
+    float width,
+    YGMeasureMode widthMode,
+    float,
+    YGMeasureMode) {
+  auto text = static_cast<Text*>(YGNodeGetContext(node));
+  auto measuredWidth = text->width;
+  if (widthMode != YGMeasureModeUndefined && measuredWidth > width) {
+    measuredWidth = width;
+  }
+  auto lines = std::ceil(text->width / std::fmax(measuredWidth, 1.0f));
+  if (widthMode == YGMeasureModeExactly) {
+    measuredWidth = width;
+  }
+  return {measuredWidth, lines * 17.0f};
+}
+
+float textBaseline(YGNodeRef, float, float height) {
+  return height * 0.7f;
+}
+
+void collect(YGNodeRef node, std::vector<YGNodeRef>& nodes) {
+  nodes.push_back(node);
+  for (uint32_t i = 0; i < YGNodeGetChildCount(node); i++) {
+    collect(YGNodeGetChild(node, i), nodes);
+  }
+}
+
+class Tree {
+public:
+  // Builds a random tree of `size` nodes covering the styles a capture
+  // records, with measure and baseline functions on some of the leaves.
+  Tree(unsigned seed, int size) : config_(YGConfigNew()) {
+    std::mt19937 random{seed};
+    auto chance = [&](int n) { return random() % n == 0; };
+
+    YGConfigSetPointScaleFactor(config_, 2.625f);
+    YGConfigSetUseWebDefaults(config_, chance(5));
+
+    root_ = YGNodeNewWithConfig(config_);
+    YGNodeStyleSetWidth(root_, 360);
+    std::vector<YGNodeRef> nodes{root_};
+    for (int i = 1; i < size; i++) {
+      auto node = YGNodeNewWithConfig(config_);
+      auto kind = random() % 8;
+      if (kind < 3) {
+        YGNodeStyleSetFlexDirection(node, YGFlexDirectionRow);
+      }
+      if (kind == 0) {
+        YGNodeStyleSetFlexWrap(node, YGWrapWrap);
+      }
+      if (chance(2)) {
+        YGNodeStyleSetFlexShrink(node, 1);
+      }
+      if (chance(4)) {
+        YGNodeStyleSetFlexGrow(node, 1);
+      }
+      if (chance(5)) {
+        YGNodeStyleSetMinWidth(node, float(20 + random() % 60));
+      }
+      if (chance(6)) {
+        YGNodeStyleSetAlignItems(node, YGAlignBaseline);
+      }
+      if (chance(5)) {
+        YGNodeStyleSetPadding(node, YGEdgeAll, 2.5f);
+      }
+      if (chance(5)) {
+        YGNodeStyleSetMarginPercent(node, YGEdgeLeft, 3);
+      }
+      if (chance(7)) {
+        YGNodeStyleSetWidthPercent(node, 40);
+      }
+      if (chance(9)) {
+        YGNodeStyleSetAspectRatio(node, 1.5f);
+      }
+      if (chance(11)) {
+        YGNodeStyleSetPositionType(node, YGPositionTypeAbsolute);
+        YGNodeStyleSetPosition(node, YGEdgeTop, 7);
+      }
+      if (chance(13)) {
+        YGNodeStyleSetBorder(node, YGEdgeBottom, 1);
+      }
+
+      auto parent = nodes[random() % nodes.size()];
+      if (YGNodeHasMeasureFunc(parent)) {
+        parent = root_;
+      }
+      YGNodeInsertChild(parent, node, YGNodeGetChildCount(parent));
+      nodes.push_back(node);
+
+      if (!chance(4)) {
+        texts_.push_back(std::make_unique<Text>(Text{float(10 + random() % 400)}));
+        YGNodeSetContext(node, texts_.back().get());
+        YGNodeSetMeasureFunc(node, measureText);
+        if (chance(3)) {
+          YGNodeSetBaselineFunc(node, textBaseline);
+          YGNodeSetNodeType(node, YGNodeTypeText);
+        }
+      }
+    }
+  }
+
+  ~Tree() {
+    YGNodeFreeRecursive(root_);
+    YGConfigFree(config_);
+  }
+
+  YGNodeRef getRoot() const { return root_; }
+
+private:
+  YGConfigRef config_;
+  YGNodeRef root_;
+  std::vector<std::unique_ptr<Text>> texts_;
+};
+
+class YogaTest_Capture : public ::testing::Test {
+protected:
+  void SetUp() override {
+    capture::setCaptureCallback(
+        [this](const std::string& capture) { capture_ = capture; });
+  }
+
+  void TearDown() override { capture::setCaptureCallback(nullptr); }
+
+  // Replays the last capture and expects it to produce the same layout as
+  // `root` has.
+  void expectReplayMatches(YGNodeRef root) {
+    auto replay = capture::Replay::fromCapture(capture_);
+    ASSERT_NE(replay, nullptr);
+    replay->layout();
+
+    std::vector<YGNodeRef> original;
+    std::vector<YGNodeRef> replayed;
+    collect(root, original);
+    collect(replay->getRoot(), replayed);
+    ASSERT_EQ(replayed.size(), original.size());
+    ASSERT_EQ(replay->getNodeCount(), original.size());
+
+    for (size_t i = 0; i < original.size(); i++) {
+      auto a = original[i];
+      auto b = replayed[i];
+      EXPECT_EQ(YGNodeLayoutGetLeft(a), YGNodeLayoutGetLeft(b)) << "node " << i;
+      EXPECT_EQ(YGNodeLayoutGetTop(a), YGNodeLayoutGetTop(b)) << "node " << i;
+      EXPECT_EQ(YGNodeLayoutGetWidth(a), YGNodeLayoutGetWidth(b))
+          << "node " << i;
+      EXPECT_EQ(YGNodeLayoutGetHeight(a), YGNodeLayoutGetHeight(b))
+          << "node " << i;
+    }
+  }
+
+  std::string capture_;
+};
+
+} // namespace
+
+TEST_F(YogaTest_Capture, captures_every_layout_pass) {
+  Tree tree{1, 20};
+  YGNodeCalculateLayout(
+      tree.getRoot(), YGUndefined, YGUndefined, YGDirectionLTR);
+  ASSERT_FALSE(capture_.empty());
+  EXPECT_EQ(capture_.compare(0, 4, "YGCP"), 0);
+
+  auto first = capture_;
+  capture_.clear();
+  YGNodeStyleSetWidth(tree.getRoot(), 300);
+  YGNodeCalculateLayout(
+      tree.getRoot(), YGUndefined, YGUndefined, YGDirectionLTR);
+  ASSERT_FALSE(capture_.empty());
+  EXPECT_NE(capture_, first);
+
+  capture::setCaptureCallback(nullptr);
+  capture_.clear();
+  YGNodeStyleSetWidth(tree.getRoot(), 200);
+  YGNodeCalculateLayout(
+      tree.getRoot(), YGUndefined, YGUndefined, YGDirectionLTR);
+  EXPECT_TRUE(capture_.empty());
+}
+
+TEST_F(YogaTest_Capture, replay_uses_recorded_measurements) {
+  auto root = YGNodeNew();
+  YGNodeStyleSetWidth(root, 100);
+  auto text = YGNodeNew();
+  Text content{250};
+  YGNodeSetContext(text, &content);
+  YGNodeSetMeasureFunc(text, measureText);
+  YGNodeInsertChild(root, text, 0);
+  YGNodeCalculateLayout(root, YGUndefined, YGUndefined, YGDirectionLTR);
+  ASSERT_EQ(YGNodeLayoutGetWidth(text), 100);
+  ASSERT_EQ(YGNodeLayoutGetHeight(text), 51);
+
+  // The replay must not depend on the original tree and measure function.
+  YGNodeFreeRecursive(root);
+
+  auto replay = capture::Replay::fromCapture(capture_);
+  ASSERT_NE(replay, nullptr);
+  EXPECT_EQ(replay->getNodeCount(), 2u);
+  EXPECT_GT(replay->getMeasurementCount(), 0u);
+
+  replay->layout();
+  auto replayedText = YGNodeGetChild(replay->getRoot(), 0);
+  EXPECT_EQ(YGNodeLayoutGetWidth(replayedText), 100);
+  EXPECT_EQ(YGNodeLayoutGetHeight(replayedText), 51);
+}
+
+TEST_F(YogaTest_Capture, replays_random_trees) {
+  int replayed = 0;
+  for (unsigned seed = 1; seed <= 250; seed++) {
+    SCOPED_TRACE(seed);
+    Tree tree{seed, 60};
+    try {
+      YGNodeCalculateLayout(
+          tree.getRoot(), YGUndefined, YGUndefined, YGDirectionLTR);
+    } catch (const std::logic_error&) {
+      // Some random combinations of styles trip Yoga's own assertions, there
+      // is nothing to replay then.
+      continue;
+    }
+    expectReplayMatches(tree.getRoot());
+    replayed++;
+  }
+  EXPECT_GT(replayed, 200);
+}
+
+TEST_F(YogaTest_Capture, replays_incremental_passes) {
+  Tree tree{3, 60};
+  YGNodeCalculateLayout(
+      tree.getRoot(), YGUndefined, YGUndefined, YGDirectionLTR);
+  auto fullPass = capture::Replay::fromCapture(capture_);
+  ASSERT_NE(fullPass, nullptr);
+
+  // Nodes served by the layout caches are not measured again, so the capture
+  // of an incremental pass holds fewer measurements. Its replay falls back to
+  // the closest of them and is only approximate.
+  YGNodeStyleSetWidth(tree.getRoot(), 300);
+  YGNodeCalculateLayout(
+      tree.getRoot(), YGUndefined, YGUndefined, YGDirectionLTR);
+  auto incremental = capture::Replay::fromCapture(capture_);
+  ASSERT_NE(incremental, nullptr);
+  EXPECT_EQ(incremental->getNodeCount(), fullPass->getNodeCount());
+  EXPECT_LT(
+      incremental->getMeasurementCount(), fullPass->getMeasurementCount());
+
+  incremental->layout();
+  EXPECT_EQ(
+      YGNodeLayoutGetWidth(incremental->getRoot()),
+      YGNodeLayoutGetWidth(tree.getRoot()));
+}
+
+TEST_F(YogaTest_Capture, rejects_malformed_captures) {
+  Tree tree{2, 30};
+  YGNodeCalculateLayout(
+      tree.getRoot(), YGUndefined, YGUndefined, YGDirectionLTR);
+  ASSERT_NE(capture::Replay::fromCapture(capture_), nullptr);
+
+  EXPECT_EQ(capture::Replay::fromCapture(""), nullptr);
+  EXPECT_EQ(capture::Replay::fromCapture("YGCP"), nullptr);
+
+  auto badMagic = capture_;
+  badMagic[0] = 'X';
+  EXPECT_EQ(capture::Replay::fromCapture(badMagic), nullptr);
+
+  for (size_t size = 0; size < capture_.size(); size += 7) {
+    EXPECT_EQ(capture::Replay::fromCapture(capture_.substr(0, size)), nullptr)
+        << "truncated to " << size;
+  }
+
+  // Corrupted contents must either be rejected or lay out without crashing.
+  std::mt19937 random{2};
+  for (int i = 0; i < 200; i++) {
+    auto corrupted = capture_;
+    corrupted[random() % corrupted.size()] ^= char(1 << (random() % 8));
+    auto replay = capture::Replay::fromCapture(corrupted);
+    if (replay != nullptr) {
+      try {
+        replay->layout();
+      } catch (const std::logic_error&) {
+      }
+    }
+  }
+}
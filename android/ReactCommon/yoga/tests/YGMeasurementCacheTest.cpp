@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <yoga/YGConfig.h>
+#include <yoga/YGMeasurementCache.h>
+#include <yoga/Yoga.h>
+#include <yoga/tracer/tracer.h>
+#include <cmath>
+
+using namespace facebook::yoga;
+
+namespace {
+
+YGSize measureText(
+    YGNodeRef,
+    float width,
+    YGMeasureMode,
+    float,
+    YGMeasureMode) {
+  // A text of 1000 points wrapped into lines of 17 points.
+  return {width, std::ceil(1000 / width) * 17};
+}
+
+// Lays a text out in roots of `widthCount` different widths, `rounds` times,
+// and returns the stats of the layout passes.
+tracer::Stats layOutText(YGConfigRef config, int widthCount, int rounds) {
+  auto root = YGNodeNewWithConfig(config);
+  auto text = YGNodeNewWithConfig(config);
+  YGNodeSetMeasureFunc(text, measureText);
+  YGNodeInsertChild(root, text, 0);
+
+  tracer::start();
+  for (int round = 0; round < rounds; round++) {
+    for (int i = 0; i < widthCount; i++) {
+      YGNodeStyleSetWidth(root, 100 + 10 * i);
+      YGNodeCalculateLayout(root, YGUndefined, YGUndefined, YGDirectionLTR);
+    }
+  }
+  tracer::stop();
+
+  YGNodeFreeRecursive(root);
+  return tracer::getStats();
+}
+
+YGCachedMeasurement measurementWithWidth(float width) {
+  YGCachedMeasurement measurement;
+  measurement.availableWidth = width;
+  return measurement;
+}
+
+} // namespace
+
+TEST(YogaTest, measurement_cache_spills_to_heap_up_to_max_size) {
+  YGMeasurementCache cache;
+  for (int i = 0; i < 20; i++) {
+    cache.insert(16, YGMeasurementCacheReplacement::Reset) =
+        measurementWithWidth(i);
+  }
+  // The cache was reset after 16 entries.
+  ASSERT_EQ(cache.size(), 4u);
+  EXPECT_EQ(cache[0].availableWidth, 16);
+  EXPECT_EQ(cache[3].availableWidth, 19);
+
+  YGMeasurementCache largeCache;
+  for (int i = 0; i < 100; i++) {
+    largeCache.insert(1000, YGMeasurementCacheReplacement::Reset);
+  }
+  EXPECT_EQ(largeCache.size(), 100u - YGMeasurementCache::kMaxSize);
+}
+
+TEST(YogaTest, measurement_cache_evicts_least_hit_entry) {
+  YGMeasurementCache cache;
+  for (int i = 0; i < 3; i++) {
+    cache.insert(3, YGMeasurementCacheReplacement::LeastHit) =
+        measurementWithWidth(i);
+  }
+  cache.recordHit(0);
+  cache.recordHit(2);
+
+  cache.insert(3, YGMeasurementCacheReplacement::LeastHit) =
+      measurementWithWidth(3);
+  ASSERT_EQ(cache.size(), 3u);
+  EXPECT_EQ(cache[0].availableWidth, 0);
+  EXPECT_EQ(cache[1].availableWidth, 3);
+  EXPECT_EQ(cache[2].availableWidth, 2);
+
+  // Hit counts are halved on eviction, so entries which were hit in the past
+  // age out.
+  cache.recordHit(1);
+  cache.recordHit(2);
+  cache.insert(3, YGMeasurementCacheReplacement::LeastHit) =
+      measurementWithWidth(4);
+  EXPECT_EQ(cache[0].availableWidth, 4);
+  EXPECT_EQ(cache[1].availableWidth, 3);
+  EXPECT_EQ(cache[2].availableWidth, 2);
+}
+
+TEST(YogaTest, larger_measurement_cache_saves_measure_callbacks) {
+  constexpr int kWidthCount = 12;
+  constexpr int kRounds = 4;
+
+  // The default cache of 8 entries is reset before any width comes around
+  // again, so every layout calls the measure function.
+  auto defaultConfig = YGConfigNew();
+  auto defaultStats = layOutText(defaultConfig, kWidthCount, kRounds);
+  auto firstRoundStats = layOutText(defaultConfig, kWidthCount, 1);
+  YGConfigFree(defaultConfig);
+
+  EXPECT_EQ(defaultStats.passes, uint64_t{kWidthCount * kRounds});
+  EXPECT_GT(firstRoundStats.measureCallbacks, 0u);
+  EXPECT_EQ(
+      defaultStats.measureCallbacks,
+      firstRoundStats.measureCallbacks * kRounds);
+
+  // A cache which holds every width only measures the first round.
+  auto config = YGConfigNew();
+  config->maxCachedMeasurements = 16;
+  config->measurementCacheReplacement = YGMeasurementCacheReplacement::LeastHit;
+  auto stats = layOutText(config, kWidthCount, kRounds);
+  YGConfigFree(config);
+
+  EXPECT_EQ(stats.passes, uint64_t{kWidthCount * kRounds});
+  EXPECT_EQ(stats.measureCallbacks, firstRoundStats.measureCallbacks);
+  EXPECT_LT(stats.measureCallbacks, defaultStats.measureCallbacks);
+  EXPECT_GT(stats.cachedMeasures, defaultStats.cachedMeasures);
+  EXPECT_GT(stats.measureCacheHitRate(), defaultStats.measureCacheHitRate());
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <yoga/YGConfig.h>
+#include <yoga/YGNode.h>
+#include <yoga/Yoga.h>
+
+namespace {
+
+YGNodeRef newNode(YGConfigRef config, float width, float height) {
+  auto node = YGNodeNewWithConfig(config);
+  YGNodeStyleSetWidth(node, width);
+  YGNodeStyleSetHeight(node, height);
+  return node;
+}
+
+YGConfigRef newConfig() {
+  auto config = YGConfigNew();
+  config->useRelayoutBoundaries = true;
+  return config;
+}
+
+} // namespace
+
+// <root> (row, aligned to baselines)
+//   <a> (100x100, a relayout boundary)
+//     <b> (50x50, a relayout boundary)
+//       <leaf/> (auto width)
+//     </b>
+//   </a>
+//   <sibling/> (20x20)
+// </root>
+TEST(YogaTest, relayout_boundary_nested_in_baseline_layout) {
+  auto config = newConfig();
+  auto root = newNode(config, 300, 300);
+  YGNodeStyleSetFlexDirection(root, YGFlexDirectionRow);
+  YGNodeStyleSetAlignItems(root, YGAlignBaseline);
+  auto a = newNode(config, 100, 100);
+  auto b = newNode(config, 50, 50);
+  auto leaf = YGNodeNewWithConfig(config);
+  YGNodeStyleSetHeight(leaf, 10);
+  auto sibling = newNode(config, 20, 20);
+  YGNodeInsertChild(b, leaf, 0);
+  YGNodeInsertChild(a, b, 0);
+  YGNodeInsertChild(root, a, 0);
+  YGNodeInsertChild(root, sibling, 1);
+
+  YGNodeCalculateLayout(root, YGUndefined, YGUndefined, YGDirectionLTR);
+  ASSERT_EQ(YGNodeLayoutGetTop(a), 10);
+  ASSERT_EQ(YGNodeLayoutGetTop(sibling), 0);
+
+  // The baseline of `a` is the bottom of `leaf`. `b` keeps its size and `a`
+  // stays clean, but the root is laid out again.
+  YGNodeStyleSetHeight(leaf, 40);
+  EXPECT_TRUE(YGNodeIsDirty(b));
+  EXPECT_FALSE(YGNodeIsDirty(a));
+  EXPECT_TRUE(YGNodeIsDirty(root));
+
+  YGNodeCalculateLayout(root, YGUndefined, YGUndefined, YGDirectionLTR);
+  EXPECT_EQ(YGNodeLayoutGetHeight(leaf), 40);
+  EXPECT_EQ(YGNodeLayoutGetTop(a), 0);
+  EXPECT_EQ(YGNodeLayoutGetTop(sibling), 20);
+  EXPECT_FALSE(YGNodeIsDirty(b));
+  EXPECT_FALSE(YGNodeIsDirty(leaf));
+
+  YGNodeFreeRecursive(root);
+  YGConfigFree(config);
+}
+
+// <root>
+//   <hidden> (display: none)
+//     <a> (100x100, a relayout boundary)
+//       <leaf/> (auto height)
+//     </a>
+//   </hidden>
+// </root>
+TEST(YogaTest, relayout_boundary_in_hidden_subtree_is_laid_out_when_shown) {
+  auto config = newConfig();
+  auto root = newNode(config, 300, 300);
+  auto hidden = YGNodeNewWithConfig(config);
+  auto a = newNode(config, 100, 100);
+  auto leaf = YGNodeNewWithConfig(config);
+  YGNodeStyleSetHeight(leaf, 10);
+  YGNodeInsertChild(a, leaf, 0);
+  YGNodeInsertChild(hidden, a, 0);
+  YGNodeInsertChild(root, hidden, 0);
+
+  YGNodeCalculateLayout(root, YGUndefined, YGUndefined, YGDirectionLTR);
+  YGNodeStyleSetDisplay(hidden, YGDisplayNone);
+  YGNodeCalculateLayout(root, YGUndefined, YGUndefined, YGDirectionLTR);
+  ASSERT_EQ(YGNodeLayoutGetHeight(hidden), 0);
+
+  // `a` is not a relayout boundary anymore while it is hidden.
+  YGNodeStyleSetHeight(leaf, 30);
+  YGNodeCalculateLayout(root, YGUndefined, YGUndefined, YGDirectionLTR);
+  EXPECT_EQ(YGNodeLayoutGetHeight(hidden), 0);
+
+  YGNodeStyleSetDisplay(hidden, YGDisplayFlex);
+  YGNodeCalculateLayout(root, YGUndefined, YGUndefined, YGDirectionLTR);
+  EXPECT_EQ(YGNodeLayoutGetHeight(hidden), 100);
+  EXPECT_EQ(YGNodeLayoutGetHeight(leaf), 30);
+  EXPECT_FALSE(YGNodeIsDirty(a));
+  EXPECT_FALSE(YGNodeIsDirty(leaf));
+
+  // Relayout boundaries under a hidden node which is positioned absolutely
+  // are laid out, as the node itself is.
+  YGNodeStyleSetPositionType(hidden, YGPositionTypeAbsolute);
+  YGNodeStyleSetDisplay(hidden, YGDisplayNone);
+  YGNodeCalculateLayout(root, YGUndefined, YGUndefined, YGDirectionLTR);
+  ASSERT_EQ(YGNodeLayoutGetHeight(hidden), 100);
+
+  YGNodeStyleSetHeight(leaf, 50);
+  EXPECT_FALSE(YGNodeIsDirty(root));
+  YGNodeCalculateLayout(root, YGUndefined, YGUndefined, YGDirectionLTR);
+  EXPECT_EQ(YGNodeLayoutGetHeight(leaf), 50);
+  EXPECT_FALSE(YGNodeIsDirty(a));
+  EXPECT_FALSE(YGNodeIsDirty(leaf));
+
+  YGNodeFreeRecursive(root);
+  YGConfigFree(config);
+}
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <yoga/Yoga.h>
+#include <yoga/tracer/tracer.h>
+#include <string>
+#include <thread>
+
+using namespace facebook::yoga;
+
+namespace {
+
+int measureCalls = 0;
+
+YGSize measureText(YGNodeRef, float width, YGMeasureMode, float, YGMeasureMode) {
+  measureCalls++;
+  return {width, 17};
+}
+
+size_t countOf(const std::string& string, const std::string& substring) {
+  size_t count = 0;
+  for (auto position = string.find(substring); position != std::string::npos;
+       position = string.find(substring, position + substring.size())) {
+    count++;
+  }
+  return count;
+}
+
+// A root with a view and `textCount` texts in it.
+class Tree {
+public:
+  explicit Tree(int textCount) : root_(YGNodeNew()) {
+    YGNodeStyleSetWidth(root_, 360);
+    auto view = YGNodeNew();
+    YGNodeStyleSetPadding(view, YGEdgeAll, 8);
+    YGNodeInsertChild(root_, view, 0);
+    for (int i = 0; i < textCount; i++) {
+      auto text = YGNodeNew();
+      YGNodeSetMeasureFunc(text, measureText);
+      YGNodeInsertChild(view, text, i);
+    }
+  }
+
+  ~Tree() { YGNodeFreeRecursive(root_); }
+
+  void layout() {
+    YGNodeCalculateLayout(root_, YGUndefined, YGUndefined, YGDirectionLTR);
+  }
+
+  YGNodeRef getRoot() const { return root_; }
+
+private:
+  YGNodeRef root_;
+};
+
+class YogaTest_Tracer : public ::testing::Test {
+protected:
+  void SetUp() override { measureCalls = 0; }
+  void TearDown() override { tracer::stop(); }
+};
+
+} // namespace
+
+TEST_F(YogaTest_Tracer, records_layout_pass) {
+  Tree tree{3};
+  tracer::start();
+  EXPECT_TRUE(tracer::isTracing());
+  tree.layout();
+  tracer::stop();
+  EXPECT_FALSE(tracer::isTracing());
+
+  auto stats = tracer::getStats();
+  EXPECT_EQ(stats.passes, 1u);
+  EXPECT_GT(measureCalls, 0);
+  EXPECT_EQ(stats.measureCallbacks, static_cast<uint64_t>(measureCalls));
+  EXPECT_GE(stats.visitedNodes, 5u);
+  EXPECT_EQ(stats.overwrittenRecords, 0u);
+
+  // Passes and measure function calls are spans; per-node events are left
+  // out by default.
+  auto trace = tracer::toChromeTrace();
+  EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0u);
+  EXPECT_EQ(countOf(trace, "\"name\":\"LayoutPass\""), 1u);
+  EXPECT_EQ(
+      countOf(trace, "\"name\":\"MeasureCallback\""),
+      static_cast<size_t>(measureCalls));
+  EXPECT_EQ(
+      countOf(trace, "\"ph\":\"X\""), static_cast<size_t>(measureCalls) + 1);
+  EXPECT_EQ(countOf(trace, "\"name\":\"NodeLayout\""), 0u);
+  EXPECT_NE(trace.find("\"passes\":1"), std::string::npos);
+}
+
+TEST_F(YogaTest_Tracer, records_nothing_when_stopped) {
+  Tree tree{2};
+  tracer::start();
+  tree.layout();
+  tracer::stop();
+  auto trace = tracer::toChromeTrace();
+
+  YGNodeStyleSetWidth(tree.getRoot(), 300);
+  tree.layout();
+  EXPECT_EQ(tracer::getStats().passes, 1u);
+  EXPECT_EQ(tracer::toChromeTrace(), trace);
+
+  // Starting again drops the previous records.
+  tracer::start();
+  EXPECT_EQ(tracer::getStats().passes, 0u);
+  EXPECT_EQ(countOf(tracer::toChromeTrace(), "\"name\":"), 0u);
+}
+
+TEST_F(YogaTest_Tracer, records_events_in_mask) {
+  Tree tree{2};
+  tracer::Options options;
+  options.eventMask = tracer::kDefaultEventMask |
+      tracer::eventBit(Event::NodeLayout);
+  tracer::start(options);
+  tree.layout();
+  tracer::stop();
+
+  auto trace = tracer::toChromeTrace();
+  EXPECT_GT(countOf(trace, "\"name\":\"NodeLayout\""), 0u);
+  EXPECT_EQ(
+      countOf(trace, "\"name\":\"NodeLayout\""),
+      countOf(trace, "\"layoutType\":"));
+
+  options.eventMask = tracer::eventBit(Event::LayoutPassStart) |
+      tracer::eventBit(Event::LayoutPassEnd);
+  tracer::start(options);
+  YGNodeStyleSetWidth(tree.getRoot(), 300);
+  tree.layout();
+  tracer::stop();
+  trace = tracer::toChromeTrace();
+  EXPECT_EQ(countOf(trace, "\"name\":\"LayoutPass\""), 1u);
+  EXPECT_EQ(countOf(trace, "\"name\":\"MeasureCallback\""), 0u);
+}
+
+TEST_F(YogaTest_Tracer, records_passes_of_every_thread) {
+  Tree tree{1};
+  Tree otherTree{1};
+  tracer::start();
+  tree.layout();
+  std::thread([&] { otherTree.layout(); }).join();
+  tracer::stop();
+
+  EXPECT_EQ(tracer::getStats().passes, 2u);
+  EXPECT_EQ(countOf(tracer::toChromeTrace(), "\"name\":\"LayoutPass\""), 2u);
+}
+
+TEST_F(YogaTest_Tracer, keeps_latest_records_when_buffer_is_full) {
+  Tree tree{1};
+  tracer::Options options;
+  options.bufferSize = 8;
+  tracer::start(options);
+  for (int i = 0; i < 10; i++) {
+    YGNodeStyleSetWidth(tree.getRoot(), 300 + i);
+    tree.layout();
+  }
+  tracer::stop();
+
+  auto stats = tracer::getStats();
+  EXPECT_EQ(stats.passes, 10u);
+  EXPECT_GT(stats.overwrittenRecords, 0u);
+  auto passes = countOf(tracer::toChromeTrace(), "\"name\":\"LayoutPass\"");
+  EXPECT_GT(passes, 0u);
+  EXPECT_LT(passes, 10u);
+}
@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include "YGMeasurementCache.h"
 #include "Yoga-internal.h"
 #include "Yoga.h"
 
@@ -40,6 +41,12 @@ public:
   bool useLegacyStretchBehaviour = false;
   bool shouldDiffLayoutWithoutLegacyStretchBehaviour = false;
   bool printTree = false;
+  // See `YGNode::isRelayoutBoundary`.
+  bool useRelayoutBoundaries = false;
+  // Policy of `YGMeasurementCache` of every node using the config.
+  uint32_t maxCachedMeasurements = YG_MAX_CACHED_RESULT_COUNT;
+  YGMeasurementCacheReplacement measurementCacheReplacement =
+      YGMeasurementCacheReplacement::Reset;
   float pointScaleFactor = 1.0f;
   std::array<bool, facebook::yoga::enums::count<YGExperimentalFeature>()>
       experimentalFeatures = {};
@@ -10,7 +10,7 @@
 
 using namespace facebook;
 
-bool YGLayout::operator==(YGLayout layout) const {
+bool YGLayout::operator==(const YGLayout& layout) const {
   bool isEqual = YGFloatArrayEqual(position, layout.position) &&
       YGFloatArrayEqual(dimensions, layout.dimensions) &&
       YGFloatArrayEqual(margin, layout.margin) &&
@@ -19,14 +19,10 @@ bool YGLayout::operator==(YGLayout layout) const {
       direction() == layout.direction() &&
       hadOverflow() == layout.hadOverflow() &&
       lastOwnerDirection == layout.lastOwnerDirection &&
-      nextCachedMeasurementsIndex == layout.nextCachedMeasurementsIndex &&
+      measurementCache == layout.measurementCache &&
       cachedLayout == layout.cachedLayout &&
       computedFlexBasis == layout.computedFlexBasis;
 
-  for (uint32_t i = 0; i < YG_MAX_CACHED_RESULT_COUNT && isEqual; ++i) {
-    isEqual = isEqual && cachedMeasurements[i] == layout.cachedMeasurements[i];
-  }
-
   if (!yoga::isUndefined(measuredDimensions[0]) ||
       !yoga::isUndefined(layout.measuredDimensions[0])) {
     isEqual =
@@ -8,6 +8,7 @@
 #pragma once
 #include "BitUtils.h"
 #include "YGFloatOptional.h"
+#include "YGMeasurementCache.h"
 #include "Yoga-internal.h"
 
 using namespace facebook::yoga;
@@ -38,13 +39,15 @@ public:
   uint32_t generationCount = 0;
   YGDirection lastOwnerDirection = YGDirectionInherit;
 
-  uint32_t nextCachedMeasurementsIndex = 0;
-  std::array<YGCachedMeasurement, YG_MAX_CACHED_RESULT_COUNT>
-      cachedMeasurements = {};
+  YGMeasurementCache measurementCache = {};
   std::array<float, 2> measuredDimensions = {{YGUndefined, YGUndefined}};
 
   YGCachedMeasurement cachedLayout = YGCachedMeasurement();
 
+  // Position relative to the root before rounding to the pixel grid, as of
+  // the last rounding. Relayout boundaries are rounded relative to it.
+  std::array<double, 2> unroundedAbsolutePosition = {};
+
   YGDirection direction() const {
     return facebook::yoga::detail::getEnumData<YGDirection>(
         flags, directionOffset);
@@ -82,6 +85,6 @@ public:
         flags, hadOverflowOffset, hadOverflow);
   }
 
-  bool operator==(YGLayout layout) const;
-  bool operator!=(YGLayout layout) const { return !(*this == layout); }
+  bool operator==(const YGLayout& layout) const;
+  bool operator!=(const YGLayout& layout) const { return !(*this == layout); }
 };
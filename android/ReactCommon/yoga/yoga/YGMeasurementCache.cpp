@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "YGMeasurementCache.h"
+
+constexpr uint32_t YGMeasurementCache::kMaxSize;
+
+void YGMeasurementCache::clear() {
+  size_ = 0;
+  nextEvictionIndex_ = 0;
+  overflowEntries_.clear();
+}
+
+YGCachedMeasurement& YGMeasurementCache::insert(
+    uint32_t maxSize,
+    YGMeasurementCacheReplacement replacement) {
+  maxSize = std::max(std::min(maxSize, kMaxSize), 1u);
+
+  if (size_ >= maxSize) {
+    if (replacement == YGMeasurementCacheReplacement::LeastHit) {
+      auto& victim = entry(evict());
+      victim = Entry{};
+      return victim.measurement;
+    }
+    clear();
+  }
+
+  if (size_ < inlineEntries_.size()) {
+    inlineEntries_[size_] = Entry{};
+  } else {
+    overflowEntries_.emplace_back();
+  }
+  return entry(size_++).measurement;
+}
+
+uint32_t YGMeasurementCache::evict() {
+  // Scanning from the slot after the previous victim rotates the choice
+  // between entries with the same number of hits.
+  uint32_t victim = nextEvictionIndex_ % size_;
+  for (uint32_t i = 1; i < size_; i++) {
+    uint32_t index = (nextEvictionIndex_ + i) % size_;
+    if (entry(index).hitCount < entry(victim).hitCount) {
+      victim = index;
+    }
+  }
+
+  // Halving the counts lets entries which are not used anymore age out.
+  for (uint32_t i = 0; i < size_; i++) {
+    entry(i).hitCount /= 2;
+  }
+
+  nextEvictionIndex_ = victim + 1;
+  return victim;
+}
+
+bool YGMeasurementCache::operator==(const YGMeasurementCache& cache) const {
+  if (size_ != cache.size_) {
+    return false;
+  }
+  for (uint32_t i = 0; i < size_; i++) {
+    if (!((*this)[i] == cache[i])) {
+      return false;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+#include <cstdint>
+#include "Yoga-internal.h"
+
+// Defines how a full `YGMeasurementCache` makes room for a new entry.
+enum struct YGMeasurementCacheReplacement : uint8_t {
+  // Drops all entries and starts over.
+  Reset,
+  // Evicts the entry with the fewest cache hits.
+  LeastHit,
+};
+
+// Results of measuring a node under different constraints. The first
+// `YG_MAX_CACHED_RESULT_COUNT` entries are stored inline, the rest (if the
+// config allows a larger cache) on the heap.
+// Entries are copied along with the node, so a clone keeps using them for as
+// long as it is not dirtied.
+class YOGA_EXPORT YGMeasurementCache {
+public:
+  // Upper bound of `YGConfig::maxCachedMeasurements`.
+  static constexpr uint32_t kMaxSize = 64;
+
+  uint32_t size() const { return size_; }
+
+  YGCachedMeasurement& operator[](uint32_t index) {
+    return entry(index).measurement;
+  }
+  const YGCachedMeasurement& operator[](uint32_t index) const {
+    return const_cast<YGMeasurementCache&>(*this)[index];
+  }
+
+  void recordHit(uint32_t index) {
+    auto& hitCount = entry(index).hitCount;
+    if (hitCount < UINT32_MAX) {
+      hitCount++;
+    }
+  }
+
+  void clear();
+
+  // Returns a new entry. If the cache already holds `maxSize` entries, makes
+  // room for it according to `replacement`.
+  YGCachedMeasurement& insert(
+      uint32_t maxSize,
+      YGMeasurementCacheReplacement replacement);
+
+  bool operator==(const YGMeasurementCache& cache) const;
+
+private:
+  struct Entry {
+    YGCachedMeasurement measurement;
+    uint32_t hitCount = 0;
+  };
+
+  Entry& entry(uint32_t index) {
+    return index < inlineEntries_.size()
+        ? inlineEntries_[index]
+        : overflowEntries_[index - inlineEntries_.size()];
+  }
+
+  uint32_t evict();
+
+  uint32_t size_ = 0;
+  uint32_t nextEvictionIndex_ = 0;
+  std::array<Entry, YG_MAX_CACHED_RESULT_COUNT> inlineEntries_ = {};
+  std::vector<Entry> overflowEntries_ = {};
+};
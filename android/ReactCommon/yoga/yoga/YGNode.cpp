@@ -17,6 +17,7 @@ using facebook::yoga::detail::CompactValue;
 YGNode::YGNode(YGNode&& node) {
   context_ = node.context_;
   flags = node.flags;
+  hasDirtyRelayoutBoundary_ = node.hasDirtyRelayoutBoundary_;
   measure_ = node.measure_;
   baseline_ = node.baseline_;
   print_ = node.print_;
@@ -399,11 +400,77 @@ void YGNode::markDirtyAndPropogate() {
     setDirty(true);
     setLayoutComputedFlexBasis(YGFloatOptional());
     if (owner_) {
-      owner_->markDirtyAndPropogate();
+      if (isRelayoutBoundary()) {
+        owner_->markHasDirtyRelayoutBoundaryAndPropogate();
+      } else {
+        owner_->markDirtyAndPropogate();
+      }
     }
   }
 }
 
+void YGNode::markStyleDirtyAndPropogate() {
+  markDirtyAndPropogate();
+  if (owner_) {
+    // The node might have been a relayout boundary, or it might have been
+    // dirty already without its owner being dirty.
+    owner_->markDirtyAndPropogate();
+  }
+}
+
+void YGNode::markHasDirtyRelayoutBoundaryAndPropogate() {
+  if (hasDirtyRelayoutBoundary_) {
+    return;
+  }
+  hasDirtyRelayoutBoundary_ = true;
+  if (isBaselineLayout()) {
+    // Baselines depend on the content of the subtree, not only on its size.
+    // The boundaries in the subtree are laid out before this node is.
+    markDirtyAndPropogate();
+  }
+  if (owner_) {
+    owner_->markHasDirtyRelayoutBoundaryAndPropogate();
+  }
+}
+
+bool YGNode::isRelayoutBoundary() const {
+  if (owner_ == nullptr || !config_->useRelayoutBoundaries ||
+      style_.display() == YGDisplayNone) {
+    return false;
+  }
+
+  const YGValue width = style_.dimensions()[YGDimensionWidth];
+  const YGValue height = style_.dimensions()[YGDimensionHeight];
+  if (width.unit != YGUnitPoint || height.unit != YGUnitPoint) {
+    return false;
+  }
+
+  // The node is laid out again at its previous size, so it must have one.
+  return !YGFloatIsUndefined(layout_.measuredDimensions[YGDimensionWidth]) &&
+      !YGFloatIsUndefined(layout_.measuredDimensions[YGDimensionHeight]);
+}
+
+bool YGNode::isLaidOut() const {
+  return style_.display() != YGDisplayNone ||
+      style_.positionType() == YGPositionTypeAbsolute;
+}
+
+bool YGNode::isBaselineLayout() const {
+  if (YGFlexDirectionIsColumn(style_.flexDirection())) {
+    return false;
+  }
+  if (style_.alignItems() == YGAlignBaseline) {
+    return true;
+  }
+  for (auto child : children_) {
+    if (child->getStyle().positionType() != YGPositionTypeAbsolute &&
+        child->getStyle().alignSelf() == YGAlignBaseline) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void YGNode::markDirtyAndPropogateDownwards() {
   facebook::yoga::detail::setBooleanData(flags, isDirty_, true);
   for_each(children_.begin(), children_.end(), [](YGNodeRef childNode) {
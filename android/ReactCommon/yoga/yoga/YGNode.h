@@ -40,6 +40,9 @@ private:
   void* context_ = nullptr;
   uint8_t flags = 1;
   uint8_t reserved_ = 0;
+  // A relayout boundary somewhere in the subtree was dirtied without dirtying
+  // this node; see `isRelayoutBoundary`.
+  bool hasDirtyRelayoutBoundary_ = false;
   union {
     YGMeasureFunc noContext;
     MeasureWithContextFn withContext;
@@ -185,6 +188,23 @@ public:
     return facebook::yoga::detail::getBooleanData(flags, isDirty_);
   }
 
+  bool hasDirtyRelayoutBoundary() const { return hasDirtyRelayoutBoundary_; }
+
+  // A relayout boundary is a node whose size cannot change when its content
+  // (children or measured content) changes: it has a definite width and
+  // height in points and has been laid out before. Dirtiness of such node does
+  // not propagate to its owner; the node is laid out at its previous size
+  // before the main layout pass instead. Enabled with
+  // `YGConfig::useRelayoutBoundaries`.
+  bool isRelayoutBoundary() const;
+
+  // Whether the node is laid out by its owner. Nodes with `display: none`
+  // are not, unless they are positioned absolutely.
+  bool isLaidOut() const;
+
+  // Whether the layout of the node depends on baselines of its children.
+  bool isBaselineLayout() const;
+
   std::array<YGValue, 2> getResolvedDimensions() const {
     return resolvedDimensions_;
   }
@@ -288,6 +308,9 @@ public:
   YG_DEPRECATED void setConfig(YGConfigRef config) { config_ = config; }
 
   void setDirty(bool isDirty);
+  void setHasDirtyRelayoutBoundary(bool hasDirtyRelayoutBoundary) {
+    hasDirtyRelayoutBoundary_ = hasDirtyRelayoutBoundary;
+  }
   void setLayoutLastOwnerDirection(YGDirection direction);
   void setLayoutComputedFlexBasis(const YGFloatOptional computedFlexBasis);
   void setLayoutComputedFlexBasisGeneration(
@@ -326,6 +349,11 @@ public:
 
   void cloneChildrenIfNeeded(void*);
   void markDirtyAndPropogate();
+  // Same as `markDirtyAndPropogate`, but for changes of the style of the node,
+  // which (unlike changes of its content) always affect the owner.
+  void markStyleDirtyAndPropogate();
+  // Records that a dirty relayout boundary is in the subtree of the node.
+  void markHasDirtyRelayoutBoundaryAndPropogate();
   float resolveFlexGrow() const;
   float resolveFlexShrink() const;
   bool isNodeFlexible();
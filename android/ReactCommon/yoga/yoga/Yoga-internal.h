@@ -88,6 +88,7 @@ struct YGCachedMeasurement {
 
 // This value was chosen based on empirical data:
 // 98% of analyzed layouts require less than 8 entries.
+// It is the default size and the inline capacity of `YGMeasurementCache`.
 #define YG_MAX_CACHED_RESULT_COUNT 8
 
 namespace facebook {
@@ -16,6 +16,7 @@
 #include "YGNode.h"
 #include "YGNodePrint.h"
 #include "Yoga-internal.h"
+#include "capture/capture-inl.h"
 #include "event/event.h"
 #ifdef _MSC_VER
 #include <float.h>
@@ -356,7 +357,7 @@ YOGA_EXPORT void YGNodeSetIsReferenceBaseline(
     bool isReferenceBaseline) {
   if (node->isReferenceBaseline() != isReferenceBaseline) {
     node->setIsReferenceBaseline(isReferenceBaseline);
-    node->markDirtyAndPropogate();
+    node->markStyleDirtyAndPropogate();
   }
 }
 
@@ -521,7 +522,7 @@ YOGA_EXPORT void YGNodeCopyStyle(
     const YGNodeRef srcNode) {
   if (!(dstNode->getStyle() == srcNode->getStyle())) {
     dstNode->setStyle(srcNode->getStyle());
-    dstNode->markDirtyAndPropogate();
+    dstNode->markStyleDirtyAndPropogate();
   }
 }
 
@@ -548,7 +549,7 @@ void updateStyle(
     Update&& update) {
   if (needsUpdate(node->getStyle(), value)) {
     update(node->getStyle(), value);
-    node->markDirtyAndPropogate();
+    node->markStyleDirtyAndPropogate();
   }
 }
 
@@ -1085,6 +1086,12 @@ static float YGBaseline(const YGNodeRef node, void* layoutContext) {
 
     Event::publish<Event::NodeBaselineEnd>(node);
 
+    capture::recordBaseline(
+        node,
+        {node->getLayout().measuredDimensions[YGDimensionWidth],
+         node->getLayout().measuredDimensions[YGDimensionHeight],
+         baseline});
+
     YGAssertWithNode(
         node,
         !YGFloatIsUndefined(baseline),
@@ -1122,22 +1129,7 @@ static float YGBaseline(const YGNodeRef node, void* layoutContext) {
 }
 
 static bool YGIsBaselineLayout(const YGNodeRef node) {
-  if (YGFlexDirectionIsColumn(node->getStyle().flexDirection())) {
-    return false;
-  }
-  if (node->getStyle().alignItems() == YGAlignBaseline) {
-    return true;
-  }
-  const uint32_t childCount = YGNodeGetChildCount(node);
-  for (uint32_t i = 0; i < childCount; i++) {
-    const YGNodeRef child = YGNodeGetChild(node, i);
-    if (child->getStyle().positionType() != YGPositionTypeAbsolute &&
-        child->getStyle().alignSelf() == YGAlignBaseline) {
-      return true;
-    }
-  }
-
-  return false;
+  return node->isBaselineLayout();
 }
 
 static inline float YGNodeDimWithMargin(
@@ -1733,6 +1725,15 @@ static void YGNodeWithMeasureFuncSetMeasuredDimensions(
     layoutMarkerData.measureCallbackReasonsCount[static_cast<size_t>(reason)] +=
         1;
 
+    capture::recordMeasurement(
+        node,
+        {innerWidth,
+         widthMeasureMode,
+         innerHeight,
+         heightMeasureMode,
+         measuredSize.width,
+         measuredSize.height});
+
     Event::publish<Event::MeasureCallbackEnd>(
         node,
         {layoutContext,
@@ -3810,6 +3811,7 @@ bool YGLayoutNodeInternal(
   YGLayout* layout = &node->getLayout();
 
   depth++;
+  layoutMarkerData.visitedNodes += 1;
 
   const bool needToVisitNode =
       (node->isDirty() && layout->generationCount != generationCount) ||
@@ -3817,7 +3819,7 @@ bool YGLayoutNodeInternal(
 
   if (needToVisitNode) {
     // Invalidate the cached results.
-    layout->nextCachedMeasurementsIndex = 0;
+    layout->measurementCache.clear();
     layout->cachedLayout.availableWidth = -1;
     layout->cachedLayout.availableHeight = -1;
     layout->cachedLayout.widthMeasureMode = YGMeasureModeUndefined;
@@ -3860,22 +3862,24 @@ bool YGLayoutNodeInternal(
       cachedResults = &layout->cachedLayout;
     } else {
       // Try to use the measurement cache.
-      for (uint32_t i = 0; i < layout->nextCachedMeasurementsIndex; i++) {
+      for (uint32_t i = 0; i < layout->measurementCache.size(); i++) {
+        auto& cachedMeasurement = layout->measurementCache[i];
         if (YGNodeCanUseCachedMeasurement(
                 widthMeasureMode,
                 availableWidth,
                 heightMeasureMode,
                 availableHeight,
-                layout->cachedMeasurements[i].widthMeasureMode,
-                layout->cachedMeasurements[i].availableWidth,
-                layout->cachedMeasurements[i].heightMeasureMode,
-                layout->cachedMeasurements[i].availableHeight,
-                layout->cachedMeasurements[i].computedWidth,
-                layout->cachedMeasurements[i].computedHeight,
+                cachedMeasurement.widthMeasureMode,
+                cachedMeasurement.availableWidth,
+                cachedMeasurement.heightMeasureMode,
+                cachedMeasurement.availableHeight,
+                cachedMeasurement.computedWidth,
+                cachedMeasurement.computedHeight,
                 marginAxisRow,
                 marginAxisColumn,
                 config)) {
-          cachedResults = &layout->cachedMeasurements[i];
+          layout->measurementCache.recordHit(i);
+          cachedResults = &cachedMeasurement;
           break;
         }
       }
@@ -3888,15 +3892,14 @@ bool YGLayoutNodeInternal(
       cachedResults = &layout->cachedLayout;
     }
   } else {
-    for (uint32_t i = 0; i < layout->nextCachedMeasurementsIndex; i++) {
-      if (YGFloatsEqual(
-              layout->cachedMeasurements[i].availableWidth, availableWidth) &&
-          YGFloatsEqual(
-              layout->cachedMeasurements[i].availableHeight, availableHeight) &&
-          layout->cachedMeasurements[i].widthMeasureMode == widthMeasureMode &&
-          layout->cachedMeasurements[i].heightMeasureMode ==
-              heightMeasureMode) {
-        cachedResults = &layout->cachedMeasurements[i];
+    for (uint32_t i = 0; i < layout->measurementCache.size(); i++) {
+      auto& cachedMeasurement = layout->measurementCache[i];
+      if (YGFloatsEqual(cachedMeasurement.availableWidth, availableWidth) &&
+          YGFloatsEqual(cachedMeasurement.availableHeight, availableHeight) &&
+          cachedMeasurement.widthMeasureMode == widthMeasureMode &&
+          cachedMeasurement.heightMeasureMode == heightMeasureMode) {
+        layout->measurementCache.recordHit(i);
+        cachedResults = &cachedMeasurement;
         break;
       }
     }
@@ -3997,16 +4000,18 @@ bool YGLayoutNodeInternal(
     layout->lastOwnerDirection = ownerDirection;
 
     if (cachedResults == nullptr) {
-      if (layout->nextCachedMeasurementsIndex + 1 >
+      if (layout->measurementCache.size() + 1 >
           (uint32_t) layoutMarkerData.maxMeasureCache) {
-        layoutMarkerData.maxMeasureCache =
-            layout->nextCachedMeasurementsIndex + 1;
+        layoutMarkerData.maxMeasureCache = layout->measurementCache.size() + 1;
       }
-      if (layout->nextCachedMeasurementsIndex == YG_MAX_CACHED_RESULT_COUNT) {
+      if (layout->measurementCache.size() >= config->maxCachedMeasurements) {
         if (gPrintChanges) {
           Log::log(node, YGLogLevelVerbose, nullptr, "Out of cache entries!\n");
         }
-        layout->nextCachedMeasurementsIndex = 0;
+        if (config->measurementCacheReplacement ==
+            YGMeasurementCacheReplacement::Reset) {
+          layout->measurementCache.clear();
+        }
       }
 
       YGCachedMeasurement* newCacheEntry;
@@ -4015,9 +4020,8 @@ bool YGLayoutNodeInternal(
         newCacheEntry = &layout->cachedLayout;
       } else {
         // Allocate a new measurement cache entry.
-        newCacheEntry =
-            &layout->cachedMeasurements[layout->nextCachedMeasurementsIndex];
-        layout->nextCachedMeasurementsIndex++;
+        newCacheEntry = &layout->measurementCache.insert(
+            config->maxCachedMeasurements, config->measurementCacheReplacement);
       }
 
       newCacheEntry->availableWidth = availableWidth;
@@ -4094,6 +4098,9 @@ static void YGRoundToPixelGrid(
   const double absoluteNodeLeft = absoluteLeft + nodeLeft;
   const double absoluteNodeTop = absoluteTop + nodeTop;
 
+  node->getLayout().unroundedAbsolutePosition = {
+      {absoluteNodeLeft, absoluteNodeTop}};
+
   const double absoluteNodeRight = absoluteNodeLeft + nodeWidth;
   const double absoluteNodeBottom = absoluteNodeTop + nodeHeight;
 
@@ -4149,6 +4156,110 @@ static void YGRoundToPixelGrid(
   }
 }
 
+// Lays out dirty relayout boundaries (see `YGNode::isRelayoutBoundary`) which
+// would not be reached by the main layout pass because their ancestors are
+// clean. Every boundary is laid out at the size it was given by its owner
+// before, at its current position. This happens before the main pass, and
+// boundaries nested in a boundary are laid out before it, so that layouts
+// which read the content of a boundary (baselines) see its new layout.
+// `isLaidOut` tells whether `node` is laid out again in this pass anyway, in
+// which case its dirty children are laid out with it (at their new size).
+// The outermost laid out boundaries are appended to `boundaries`, to be
+// rounded once the main pass is done. Returns whether the layout of any node
+// changed.
+static bool YGLayoutDirtyRelayoutBoundaries(
+    const YGNodeRef node,
+    const bool isDisplayed,
+    const bool isLaidOut,
+    std::vector<YGNodeRef>& boundaries,
+    LayoutData& layoutMarkerData,
+    void* const layoutContext,
+    const uint32_t generationCount) {
+  node->setHasDirtyRelayoutBoundary(false);
+
+  const YGLayout& nodeLayout = node->getLayout();
+  const bool isNodeDisplayed = isDisplayed && node->isLaidOut();
+
+  const float innerWidth = nodeLayout.measuredDimensions[YGDimensionWidth] -
+      nodeLayout.padding[YGEdgeLeft] - nodeLayout.padding[YGEdgeRight] -
+      nodeLayout.border[YGEdgeLeft] - nodeLayout.border[YGEdgeRight];
+  const float innerHeight = nodeLayout.measuredDimensions[YGDimensionHeight] -
+      nodeLayout.padding[YGEdgeTop] - nodeLayout.padding[YGEdgeBottom] -
+      nodeLayout.border[YGEdgeTop] - nodeLayout.border[YGEdgeBottom];
+
+  bool hasNewLayout = false;
+  const uint32_t childCount = YGNodeGetChildCount(node);
+  for (uint32_t i = 0; i < childCount; i++) {
+    YGNodeRef child = node->getChild(i);
+    // A clean node cannot have dirty children other than relayout boundaries
+    // (and nodes which are not displayed).
+    if (!child->isDirty() && !child->hasDirtyRelayoutBoundary()) {
+      continue;
+    }
+
+    if (isNodeDisplayed && child->getOwner() != node) {
+      child = node->getConfig()->cloneNode(child, node, i, layoutContext);
+      child->setOwner(node);
+      node->replaceChild(child, i);
+    }
+
+    // Nodes which are not displayed stay dirty until they are displayed again
+    // (as in a full layout pass), and so do nodes which stopped being
+    // boundaries, e.g. because they were not displayed.
+    const bool isChildDirty = isNodeDisplayed && child->isDirty();
+    const bool shouldLayOutChild =
+        isChildDirty && !isLaidOut && child->isRelayoutBoundary();
+
+    const size_t firstNestedBoundary = boundaries.size();
+    if (child->hasDirtyRelayoutBoundary()) {
+      hasNewLayout = YGLayoutDirtyRelayoutBoundaries(
+                         child,
+                         isNodeDisplayed,
+                         isChildDirty && (isLaidOut || shouldLayOutChild),
+                         boundaries,
+                         layoutMarkerData,
+                         layoutContext,
+                         generationCount) ||
+          hasNewLayout;
+    }
+
+    if (shouldLayOutChild) {
+      const YGLayout& childLayout = child->getLayout();
+      const float marginRow =
+          child->getMarginForAxis(YGFlexDirectionRow, innerWidth).unwrap();
+      const float marginColumn =
+          child->getMarginForAxis(YGFlexDirectionColumn, innerWidth).unwrap();
+      YGLayoutNodeInternal(
+          child,
+          childLayout.measuredDimensions[YGDimensionWidth] + marginRow,
+          childLayout.measuredDimensions[YGDimensionHeight] + marginColumn,
+          nodeLayout.direction(),
+          YGMeasureModeExactly,
+          YGMeasureModeExactly,
+          innerWidth,
+          innerHeight,
+          true,
+          LayoutPassReason::kInitial,
+          child->getConfig(),
+          layoutMarkerData,
+          layoutContext,
+          0,
+          generationCount);
+      // The boundary is rounded as a whole, with the boundaries nested in it.
+      boundaries.resize(firstNestedBoundary);
+      boundaries.push_back(child);
+      layoutMarkerData.relayoutBoundaries += 1;
+      hasNewLayout = true;
+    }
+  }
+
+  if (hasNewLayout) {
+    // Lets clients find the changed nodes by walking `hasNewLayout` nodes.
+    node->setHasNewLayout(true);
+  }
+  return hasNewLayout;
+}
+
 static void unsetUseLegacyFlagRecursively(YGNodeRef node) {
   node->getConfig()->useLegacyStretchBehaviour = false;
   for (auto child : node->getChildren()) {
@@ -4165,11 +4276,26 @@ YOGA_EXPORT void YGNodeCalculateLayoutWithContext(
 
   Event::publish<Event::LayoutPassStart>(node, {layoutContext});
   LayoutData markerData = {};
+  capture::detail::PassRecorder captureRecorder(
+      node, ownerWidth, ownerHeight, ownerDirection);
 
   // Increment the generation count. This will force the recursive routine to
   // visit all dirty nodes at least once. Subsequent visits will be skipped if
   // the input parameters don't change.
   gCurrentGenerationCount.fetch_add(1, std::memory_order_relaxed);
+
+  auto relayoutBoundaries = std::vector<YGNodeRef>{};
+  if (node->hasDirtyRelayoutBoundary()) {
+    YGLayoutDirtyRelayoutBoundaries(
+        node,
+        true,
+        node->isDirty(),
+        relayoutBoundaries,
+        markerData,
+        layoutContext,
+        gCurrentGenerationCount.load(std::memory_order_relaxed));
+  }
+
   node->resolveDimension();
   float width = YGUndefined;
   YGMeasureMode widthMeasureMode = YGMeasureModeUndefined;
@@ -4211,6 +4337,7 @@ YOGA_EXPORT void YGNodeCalculateLayoutWithContext(
     heightMeasureMode = YGFloatIsUndefined(height) ? YGMeasureModeUndefined
                                                    : YGMeasureModeExactly;
   }
+  const auto previousDimensions = node->getLayout().dimensions;
   if (YGLayoutNodeInternal(
           node,
           width,
@@ -4240,9 +4367,29 @@ YOGA_EXPORT void YGNodeCalculateLayoutWithContext(
               YGPrintOptionsStyle));
     }
 #endif
+  } else {
+    // The root was not laid out again, so it keeps the rounded dimensions of
+    // the last pass (even though its cached layout reset them to the
+    // unrounded ones). Boundaries are rounded against the unrounded absolute
+    // positions recorded by the last rounding.
+    node->setLayoutDimension(
+        previousDimensions[YGDimensionWidth], YGDimensionWidth);
+    node->setLayoutDimension(
+        previousDimensions[YGDimensionHeight], YGDimensionHeight);
+    for (const auto boundary : relayoutBoundaries) {
+      const YGLayout& boundaryLayout = boundary->getLayout();
+      YGRoundToPixelGrid(
+          boundary,
+          node->getConfig()->pointScaleFactor,
+          boundaryLayout.unroundedAbsolutePosition[0] -
+              boundaryLayout.position[YGEdgeLeft],
+          boundaryLayout.unroundedAbsolutePosition[1] -
+              boundaryLayout.position[YGEdgeTop]);
+    }
   }
 
   Event::publish<Event::LayoutPassEnd>(node, {layoutContext, &markerData});
+  captureRecorder.finish();
 
   // We want to get rid off `useLegacyStretchBehaviour` from YGConfig. But we
   // aren't sure whether client's of yoga have gotten rid off this flag or not.
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include "capture.h"
+
+#include <atomic>
+#include <utility>
+
+namespace facebook {
+namespace yoga {
+namespace capture {
+
+namespace detail {
+
+extern std::atomic<bool> isCapturing;
+
+// Records a layout pass while capturing is on. The recorder of the innermost
+// pass on the current thread receives results of measure and baseline
+// functions (measure functions can lay out other trees).
+class PassRecorder {
+public:
+  PassRecorder(
+      YGNodeRef root,
+      float ownerWidth,
+      float ownerHeight,
+      YGDirection ownerDirection)
+      : isActive_{isCapturing.load(std::memory_order_relaxed)} {
+    if (isActive_) {
+      begin(root, ownerWidth, ownerHeight, ownerDirection);
+    }
+  }
+
+  ~PassRecorder() {
+    if (isActive_) {
+      end();
+    }
+  }
+
+  PassRecorder(const PassRecorder&) = delete;
+  PassRecorder& operator=(const PassRecorder&) = delete;
+
+  // Serializes the pass and hands it to the capture callback.
+  void finish() {
+    if (isActive_) {
+      serialize();
+    }
+  }
+
+  void recordMeasurement(const YGNode* node, const Measurement& measurement) {
+    measurements_.emplace_back(node, measurement);
+  }
+
+  void recordBaseline(const YGNode* node, const Baseline& baseline) {
+    baselines_.emplace_back(node, baseline);
+  }
+
+private:
+  void begin(
+      YGNodeRef root,
+      float ownerWidth,
+      float ownerHeight,
+      YGDirection ownerDirection);
+  void end();
+  void serialize();
+
+  const bool isActive_;
+  PassRecorder* previous_ = nullptr;
+  YGNodeRef root_ = nullptr;
+  float ownerWidth_ = YGUndefined;
+  float ownerHeight_ = YGUndefined;
+  YGDirection ownerDirection_ = YGDirectionInherit;
+  std::vector<std::pair<const YGNode*, Measurement>> measurements_;
+  std::vector<std::pair<const YGNode*, Baseline>> baselines_;
+};
+
+extern thread_local PassRecorder* currentRecorder;
+
+} // namespace detail
+
+inline void recordMeasurement(
+    const YGNode* node,
+    const Measurement& measurement) {
+  if (detail::currentRecorder != nullptr) {
+    detail::currentRecorder->recordMeasurement(node, measurement);
+  }
+}
+
+inline void recordBaseline(const YGNode* node, const Baseline& baseline) {
+  if (detail::currentRecorder != nullptr) {
+    detail::currentRecorder->recordBaseline(node, baseline);
+  }
+}
+
+} // namespace capture
+} // namespace yoga
+} // namespace facebook
@@ -0,0 +1,655 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "capture.h"
+#include "capture-inl.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+#include "../YGConfig.h"
+#include "../YGNode.h"
+
+// Capture format (all numbers are little-endian, floats are IEEE 754):
+//
+//   "YGCP" u16:version
+//   config: u8:flags f32:pointScaleFactor u32:experimentalFeatures
+//           u32:maxCachedMeasurements u8:measurementCacheReplacement
+//   pass:   f32:ownerWidth f32:ownerHeight u8:ownerDirection
+//   u32:nodeCount, then nodes in pre-order:
+//     u32:childCount u8:flags u8:nodeType f32:width f32:height
+//     style: u8 x 10 (enums), f32 x 4 (flex, flexGrow, flexShrink,
+//            aspectRatio; NaN if undefined), then for each of flexBasis,
+//            margin, position, padding, border, dimensions, minDimensions and
+//            maxDimensions a u16 mask of values differing from the default
+//            followed by u8:unit f32:value for each of them
+//   u32:measurementCount, then u32:node f32:width u8:widthMode f32:height
+//     u8:heightMode f32:measuredWidth f32:measuredHeight
+//   u32:baselineCount, then u32:node f32:width f32:height f32:baseline
+//
+// `width` and `height` of a node are the size of its content box after the
+// pass; replays fall back to it for constraints which were not recorded.
+
+namespace facebook {
+namespace yoga {
+namespace capture {
+
+namespace detail {
+
+std::atomic<bool> isCapturing{false};
+thread_local PassRecorder* currentRecorder = nullptr;
+
+} // namespace detail
+
+namespace {
+
+constexpr char kMagic[] = {'Y', 'G', 'C', 'P'};
+constexpr uint16_t kVersion = 1;
+
+enum ConfigFlags : uint8_t {
+  kUseWebDefaults = 1 << 0,
+  kUseLegacyStretchBehaviour = 1 << 1,
+  kUseRelayoutBoundaries = 1 << 2,
+};
+
+enum NodeFlags : uint8_t {
+  kHasMeasureFunc = 1 << 0,
+  kHasBaselineFunc = 1 << 1,
+  kIsReferenceBaseline = 1 << 2,
+};
+
+std::mutex callbackMutex;
+std::shared_ptr<CaptureCallback> callback;
+
+class Writer {
+public:
+  void u8(uint8_t value) { data_.push_back(static_cast<char>(value)); }
+
+  void u16(uint16_t value) {
+    u8(value & 0xff);
+    u8(value >> 8);
+  }
+
+  void u32(uint32_t value) {
+    u16(value & 0xffff);
+    u16(value >> 16);
+  }
+
+  void f32(float value) {
+    uint32_t bits;
+    static_assert(sizeof(bits) == sizeof(value), "Unexpected float size");
+    std::memcpy(&bits, &value, sizeof(bits));
+    u32(bits);
+  }
+
+  void bytes(const char* data, size_t size) { data_.append(data, size); }
+
+  std::string& data() { return data_; }
+
+private:
+  std::string data_;
+};
+
+class Reader {
+public:
+  explicit Reader(const std::string& data) : data_{data} {}
+
+  bool isValid() const { return isValid_; }
+  size_t remaining() const { return data_.size() - offset_; }
+
+  uint8_t u8() {
+    if (remaining() < 1) {
+      isValid_ = false;
+      return 0;
+    }
+    return static_cast<uint8_t>(data_[offset_++]);
+  }
+
+  uint16_t u16() {
+    uint16_t low = u8();
+    return low | static_cast<uint16_t>(u8() << 8);
+  }
+
+  uint32_t u32() {
+    uint32_t low = u16();
+    return low | (static_cast<uint32_t>(u16()) << 16);
+  }
+
+  float f32() {
+    auto bits = u32();
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  bool bytes(const char* expected, size_t size) {
+    if (remaining() < size || data_.compare(offset_, size, expected, size)) {
+      isValid_ = false;
+      return false;
+    }
+    offset_ += size;
+    return true;
+  }
+
+  template <typename Enum>
+  Enum enumValue() {
+    auto value = u8();
+    if (value >= enums::count<Enum>()) {
+      isValid_ = false;
+      return Enum{};
+    }
+    return static_cast<Enum>(value);
+  }
+
+  // Reads a count of items of at least `itemSize` bytes each.
+  uint32_t count(size_t itemSize) {
+    auto value = u32();
+    if (value > remaining() / itemSize) {
+      isValid_ = false;
+      return 0;
+    }
+    return value;
+  }
+
+private:
+  const std::string& data_;
+  size_t offset_ = 0;
+  bool isValid_ = true;
+};
+
+// Smallest possible size of a serialized node.
+constexpr size_t kMinNodeSize = 4 + 1 + 1 + 4 + 4 + 10 + 4 * 4 + 8 * 2;
+
+template <size_t Size>
+void writeValues(
+    Writer& writer,
+    const yoga::detail::Values<Size>& values,
+    const yoga::detail::Values<Size>& defaults) {
+  static_assert(Size <= 16, "Mask has to fit into u16");
+  uint16_t mask = 0;
+  for (size_t i = 0; i < Size; i++) {
+    if (!(values[i] == defaults[i])) {
+      mask |= 1 << i;
+    }
+  }
+  writer.u16(mask);
+  for (size_t i = 0; i < Size; i++) {
+    if (mask & (1 << i)) {
+      YGValue value = values[i];
+      writer.u8(value.unit);
+      writer.f32(value.value);
+    }
+  }
+}
+
+void writeStyle(Writer& writer, const YGStyle& style) {
+  static const YGStyle defaults{};
+
+  writer.u8(style.direction());
+  writer.u8(style.flexDirection());
+  writer.u8(style.justifyContent());
+  writer.u8(style.alignContent());
+  writer.u8(style.alignItems());
+  writer.u8(style.alignSelf());
+  writer.u8(style.positionType());
+  writer.u8(style.flexWrap());
+  writer.u8(style.overflow());
+  writer.u8(style.display());
+
+  writer.f32(style.flex().unwrap());
+  writer.f32(style.flexGrow().unwrap());
+  writer.f32(style.flexShrink().unwrap());
+  writer.f32(style.aspectRatio().unwrap());
+
+  writeValues(
+      writer,
+      yoga::detail::Values<1>{style.flexBasis()},
+      yoga::detail::Values<1>{defaults.flexBasis()});
+  writeValues(writer, style.margin(), defaults.margin());
+  writeValues(writer, style.position(), defaults.position());
+  writeValues(writer, style.padding(), defaults.padding());
+  writeValues(writer, style.border(), defaults.border());
+  writeValues(writer, style.dimensions(), defaults.dimensions());
+  writeValues(writer, style.minDimensions(), defaults.minDimensions());
+  writeValues(writer, style.maxDimensions(), defaults.maxDimensions());
+}
+
+void writeNode(
+    Writer& writer,
+    YGNode& node,
+    std::unordered_map<const YGNode*, uint32_t>& indices) {
+  auto index = static_cast<uint32_t>(indices.size());
+  indices[&node] = index;
+
+  const auto& layout = node.getLayout();
+  auto contentWidth = layout.dimensions[YGDimensionWidth] -
+      layout.padding[YGEdgeLeft] - layout.padding[YGEdgeRight] -
+      layout.border[YGEdgeLeft] - layout.border[YGEdgeRight];
+  auto contentHeight = layout.dimensions[YGDimensionHeight] -
+      layout.padding[YGEdgeTop] - layout.padding[YGEdgeBottom] -
+      layout.border[YGEdgeTop] - layout.border[YGEdgeBottom];
+
+  uint8_t flags = 0;
+  flags |= node.hasMeasureFunc() ? kHasMeasureFunc : 0;
+  flags |= node.hasBaselineFunc() ? kHasBaselineFunc : 0;
+  flags |= node.isReferenceBaseline() ? kIsReferenceBaseline : 0;
+
+  writer.u32(static_cast<uint32_t>(node.getChildren().size()));
+  writer.u8(flags);
+  writer.u8(node.getNodeType());
+  writer.f32(contentWidth);
+  writer.f32(contentHeight);
+  writeStyle(writer, node.getStyle());
+
+  for (auto child : node.getChildren()) {
+    writeNode(writer, *child, indices);
+  }
+}
+
+uint32_t countNodes(const YGNode& node) {
+  uint32_t count = 1;
+  for (auto child : node.getChildren()) {
+    count += countNodes(*child);
+  }
+  return count;
+}
+
+template <size_t Size>
+void readValues(Reader& reader, yoga::detail::Values<Size>& values) {
+  auto mask = reader.u16();
+  for (size_t i = 0; i < Size; i++) {
+    if (mask & (1 << i)) {
+      auto unit = reader.enumValue<YGUnit>();
+      auto value = reader.f32();
+      values[i] = yoga::detail::CompactValue(YGValue{value, unit});
+    }
+  }
+}
+
+void readStyle(Reader& reader, YGStyle& style) {
+  style.direction() = reader.enumValue<YGDirection>();
+  style.flexDirection() = reader.enumValue<YGFlexDirection>();
+  style.justifyContent() = reader.enumValue<YGJustify>();
+  style.alignContent() = reader.enumValue<YGAlign>();
+  style.alignItems() = reader.enumValue<YGAlign>();
+  style.alignSelf() = reader.enumValue<YGAlign>();
+  style.positionType() = reader.enumValue<YGPositionType>();
+  style.flexWrap() = reader.enumValue<YGWrap>();
+  style.overflow() = reader.enumValue<YGOverflow>();
+  style.display() = reader.enumValue<YGDisplay>();
+
+  style.flex() = YGFloatOptional{reader.f32()};
+  style.flexGrow() = YGFloatOptional{reader.f32()};
+  style.flexShrink() = YGFloatOptional{reader.f32()};
+  style.aspectRatio() = YGFloatOptional{reader.f32()};
+
+  // Values which are not in the capture have their defaults.
+  static const YGStyle defaults{};
+
+  auto flexBasis = yoga::detail::Values<1>{defaults.flexBasis()};
+  readValues(reader, flexBasis);
+  style.flexBasis() = flexBasis[0];
+
+  auto margin = defaults.margin();
+  readValues(reader, margin);
+  style.margin() = margin;
+
+  auto position = defaults.position();
+  readValues(reader, position);
+  style.position() = position;
+
+  auto padding = defaults.padding();
+  readValues(reader, padding);
+  style.padding() = padding;
+
+  auto border = defaults.border();
+  readValues(reader, border);
+  style.border() = border;
+
+  auto dimensions = defaults.dimensions();
+  readValues(reader, dimensions);
+  style.dimensions() = dimensions;
+
+  auto minDimensions = defaults.minDimensions();
+  readValues(reader, minDimensions);
+  style.minDimensions() = minDimensions;
+
+  auto maxDimensions = defaults.maxDimensions();
+  readValues(reader, maxDimensions);
+  style.maxDimensions() = maxDimensions;
+}
+
+float distanceBetween(float a, float b) {
+  if (yoga::isUndefined(a) || yoga::isUndefined(b)) {
+    return yoga::isUndefined(a) == yoga::isUndefined(b)
+        ? 0
+        : std::numeric_limits<float>::infinity();
+  }
+  return std::fabs(a - b);
+}
+
+float constrain(float size, float constraint, YGMeasureMode mode) {
+  switch (mode) {
+    case YGMeasureModeExactly:
+      return constraint;
+    case YGMeasureModeAtMost:
+      return std::fmin(size, constraint);
+    case YGMeasureModeUndefined:
+      return size;
+  }
+  return size;
+}
+
+YGSize replayMeasure(
+    YGNodeRef node,
+    float width,
+    YGMeasureMode widthMode,
+    float height,
+    YGMeasureMode heightMode) {
+  const auto& recorded =
+      *static_cast<const Replay::RecordedNode*>(node->getContext());
+
+  const Measurement* closest = nullptr;
+  auto closestDistance = std::numeric_limits<float>::infinity();
+  for (const auto& measurement : recorded.measurements) {
+    if (measurement.widthMode != widthMode ||
+        measurement.heightMode != heightMode) {
+      continue;
+    }
+    auto distance = distanceBetween(measurement.width, width) +
+        distanceBetween(measurement.height, height);
+    if (closest == nullptr || distance < closestDistance) {
+      closest = &measurement;
+      closestDistance = distance;
+    }
+  }
+
+  if (closest != nullptr) {
+    return {closest->measuredWidth, closest->measuredHeight};
+  }
+  return {
+      constrain(recorded.width, width, widthMode),
+      constrain(recorded.height, height, heightMode)};
+}
+
+float replayBaseline(YGNodeRef node, float width, float height) {
+  const auto& recorded =
+      *static_cast<const Replay::RecordedNode*>(node->getContext());
+
+  const Baseline* closest = nullptr;
+  auto closestDistance = std::numeric_limits<float>::infinity();
+  for (const auto& baseline : recorded.baselines) {
+    auto distance = distanceBetween(baseline.width, width) +
+        distanceBetween(baseline.height, height);
+    if (closest == nullptr || distance < closestDistance) {
+      closest = &baseline;
+      closestDistance = distance;
+    }
+  }
+  return closest != nullptr ? closest->baseline : height;
+}
+
+YGNodeRef readNode(
+    Reader& reader,
+    YGConfigRef config,
+    std::vector<Replay::RecordedNode>& nodes,
+    std::vector<YGNodeRef>& yogaNodes) {
+  if (nodes.size() == nodes.capacity()) {
+    // More nodes than declared.
+    return nullptr;
+  }
+
+  auto childCount = reader.count(kMinNodeSize);
+  auto flags = reader.u8();
+  auto nodeType = reader.enumValue<YGNodeType>();
+  auto width = reader.f32();
+  auto height = reader.f32();
+
+  auto node = YGNodeNewWithConfig(config);
+  yogaNodes.push_back(node);
+  nodes.push_back({{}, {}, width, height});
+  node->setContext(&nodes.back());
+  node->setNodeType(nodeType);
+  node->setIsReferenceBaseline(flags & kIsReferenceBaseline);
+  readStyle(reader, node->getStyle());
+
+  if (!reader.isValid() || (childCount > 0 && (flags & kHasMeasureFunc))) {
+    return nullptr;
+  }
+
+  for (uint32_t i = 0; i < childCount; i++) {
+    auto child = readNode(reader, config, nodes, yogaNodes);
+    if (child == nullptr) {
+      return nullptr;
+    }
+    YGNodeInsertChild(node, child, i);
+  }
+
+  if (flags & kHasMeasureFunc) {
+    node->setMeasureFunc(replayMeasure);
+  }
+  if (flags & kHasBaselineFunc) {
+    node->setBaselineFunc(replayBaseline);
+  }
+  return node;
+}
+
+} // namespace
+
+void setCaptureCallback(CaptureCallback newCallback) {
+  std::lock_guard<std::mutex> lock(callbackMutex);
+  callback = newCallback
+      ? std::make_shared<CaptureCallback>(std::move(newCallback))
+      : nullptr;
+  detail::isCapturing.store(callback != nullptr, std::memory_order_relaxed);
+}
+
+void detail::PassRecorder::begin(
+    YGNodeRef root,
+    float ownerWidth,
+    float ownerHeight,
+    YGDirection ownerDirection) {
+  root_ = root;
+  ownerWidth_ = ownerWidth;
+  ownerHeight_ = ownerHeight;
+  ownerDirection_ = ownerDirection;
+  previous_ = currentRecorder;
+  currentRecorder = this;
+}
+
+void detail::PassRecorder::end() {
+  currentRecorder = previous_;
+}
+
+void detail::PassRecorder::serialize() {
+  std::shared_ptr<CaptureCallback> captureCallback;
+  {
+    std::lock_guard<std::mutex> lock(callbackMutex);
+    captureCallback = callback;
+  }
+  if (captureCallback == nullptr) {
+    return;
+  }
+
+  auto config = root_->getConfig();
+  auto writer = Writer{};
+
+  writer.bytes(kMagic, sizeof(kMagic));
+  writer.u16(kVersion);
+
+  uint8_t configFlags = 0;
+  configFlags |= config->useWebDefaults ? kUseWebDefaults : 0;
+  configFlags |=
+      config->useLegacyStretchBehaviour ? kUseLegacyStretchBehaviour : 0;
+  configFlags |= config->useRelayoutBoundaries ? kUseRelayoutBoundaries : 0;
+  writer.u8(configFlags);
+  writer.f32(config->pointScaleFactor);
+  uint32_t experimentalFeatures = 0;
+  for (size_t i = 0; i < config->experimentalFeatures.size(); i++) {
+    experimentalFeatures |= config->experimentalFeatures[i] ? 1 << i : 0;
+  }
+  writer.u32(experimentalFeatures);
+  writer.u32(config->maxCachedMeasurements);
+  writer.u8(static_cast<uint8_t>(config->measurementCacheReplacement));
+
+  writer.f32(ownerWidth_);
+  writer.f32(ownerHeight_);
+  writer.u8(ownerDirection_);
+
+  auto indices = std::unordered_map<const YGNode*, uint32_t>{};
+  writer.u32(countNodes(*root_));
+  writeNode(writer, *root_, indices);
+
+  // Results of nodes which were replaced during the pass are dropped.
+  auto measurementCount = uint32_t{0};
+  for (const auto& measurement : measurements_) {
+    measurementCount += indices.count(measurement.first);
+  }
+  writer.u32(measurementCount);
+  for (const auto& measurement : measurements_) {
+    auto index = indices.find(measurement.first);
+    if (index == indices.end()) {
+      continue;
+    }
+    writer.u32(index->second);
+    writer.f32(measurement.second.width);
+    writer.u8(measurement.second.widthMode);
+    writer.f32(measurement.second.height);
+    writer.u8(measurement.second.heightMode);
+    writer.f32(measurement.second.measuredWidth);
+    writer.f32(measurement.second.measuredHeight);
+  }
+
+  auto baselineCount = uint32_t{0};
+  for (const auto& baseline : baselines_) {
+    baselineCount += indices.count(baseline.first);
+  }
+  writer.u32(baselineCount);
+  for (const auto& baseline : baselines_) {
+    auto index = indices.find(baseline.first);
+    if (index == indices.end()) {
+      continue;
+    }
+    writer.u32(index->second);
+    writer.f32(baseline.second.width);
+    writer.f32(baseline.second.height);
+    writer.f32(baseline.second.baseline);
+  }
+
+  (*captureCallback)(writer.data());
+}
+
+std::unique_ptr<Replay> Replay::fromCapture(const std::string& capture) {
+  auto reader = Reader{capture};
+  if (!reader.bytes(kMagic, sizeof(kMagic)) || reader.u16() != kVersion) {
+    return nullptr;
+  }
+
+  auto replay = std::unique_ptr<Replay>{new Replay{}};
+  auto config = YGConfigNew();
+  replay->config_ = config;
+
+  auto configFlags = reader.u8();
+  config->useWebDefaults = configFlags & kUseWebDefaults;
+  config->useLegacyStretchBehaviour = configFlags & kUseLegacyStretchBehaviour;
+  config->useRelayoutBoundaries = configFlags & kUseRelayoutBoundaries;
+  config->pointScaleFactor = reader.f32();
+  auto experimentalFeatures = reader.u32();
+  for (size_t i = 0; i < config->experimentalFeatures.size(); i++) {
+    config->experimentalFeatures[i] = experimentalFeatures & (1 << i);
+  }
+  config->maxCachedMeasurements = reader.u32();
+  config->measurementCacheReplacement =
+      reader.u8() == static_cast<uint8_t>(YGMeasurementCacheReplacement::LeastHit)
+      ? YGMeasurementCacheReplacement::LeastHit
+      : YGMeasurementCacheReplacement::Reset;
+
+  replay->ownerWidth_ = reader.f32();
+  replay->ownerHeight_ = reader.f32();
+  replay->ownerDirection_ = reader.enumValue<YGDirection>();
+
+  auto nodeCount = reader.count(kMinNodeSize);
+  if (!reader.isValid() || nodeCount == 0) {
+    return nullptr;
+  }
+
+  // Nodes refer to their `RecordedNode`s, which must not be reallocated.
+  replay->nodes_.reserve(nodeCount);
+  auto yogaNodes = std::vector<YGNodeRef>{};
+  yogaNodes.reserve(nodeCount);
+  auto root = readNode(reader, config, replay->nodes_, yogaNodes);
+  if (root == nullptr || replay->nodes_.size() != nodeCount) {
+    // A partially built tree can't be freed recursively.
+    for (auto node : yogaNodes) {
+      YGNodeFree(node);
+    }
+    return nullptr;
+  }
+  replay->root_ = root;
+
+  auto measurementCount = reader.count(4 + 4 + 1 + 4 + 1 + 4 + 4);
+  for (uint32_t i = 0; i < measurementCount; i++) {
+    auto index = reader.u32();
+    auto measurement = Measurement{};
+    measurement.width = reader.f32();
+    measurement.widthMode = reader.enumValue<YGMeasureMode>();
+    measurement.height = reader.f32();
+    measurement.heightMode = reader.enumValue<YGMeasureMode>();
+    measurement.measuredWidth = reader.f32();
+    measurement.measuredHeight = reader.f32();
+    if (index >= nodeCount) {
+      return nullptr;
+    }
+    replay->nodes_[index].measurements.push_back(measurement);
+  }
+
+  auto baselineCount = reader.count(4 + 4 + 4 + 4);
+  for (uint32_t i = 0; i < baselineCount; i++) {
+    auto index = reader.u32();
+    auto baseline = Baseline{};
+    baseline.width = reader.f32();
+    baseline.height = reader.f32();
+    baseline.baseline = reader.f32();
+    if (index >= nodeCount) {
+      return nullptr;
+    }
+    replay->nodes_[index].baselines.push_back(baseline);
+  }
+
+  if (!reader.isValid()) {
+    return nullptr;
+  }
+  return replay;
+}
+
+Replay::~Replay() {
+  if (root_ != nullptr) {
+    YGNodeFreeRecursive(root_);
+  }
+  if (config_ != nullptr) {
+    YGConfigFree(config_);
+  }
+}
+
+size_t Replay::getMeasurementCount() const {
+  size_t count = 0;
+  for (const auto& node : nodes_) {
+    count += node.measurements.size();
+  }
+  return count;
+}
+
+void Replay::layout() {
+  root_->markDirtyAndPropogateDownwards();
+  YGNodeCalculateLayout(root_, ownerWidth_, ownerHeight_, ownerDirection_);
+}
+
+} // namespace capture
+} // namespace yoga
+} // namespace facebook
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <yoga/Yoga.h>
+
+namespace facebook {
+namespace yoga {
+namespace capture {
+
+// Result of a measure function call.
+struct Measurement {
+  float width;
+  YGMeasureMode widthMode;
+  float height;
+  YGMeasureMode heightMode;
+  float measuredWidth;
+  float measuredHeight;
+};
+
+// Result of a baseline function call.
+struct Baseline {
+  float width;
+  float height;
+  float baseline;
+};
+
+using CaptureCallback = std::function<void(const std::string& capture)>;
+
+// Makes every subsequent layout pass (`YGNodeCalculateLayout`) hand a capture
+// of itself to `callback`. A capture is a compact binary blob holding the
+// config and styles of the laid out tree and the results of all measure and
+// baseline functions called during the pass.
+// The callback is called on the thread which laid out the tree, after the
+// pass. Passing `nullptr` stops capturing.
+YOGA_EXPORT void setCaptureCallback(CaptureCallback callback);
+
+// A tree rebuilt from a capture, which can be laid out without the original
+// measure and baseline functions: nodes which had them return recorded
+// results. Constraints which were not recorded (because the original pass was
+// served by layout caches) get the closest recorded result, or the measured
+// size of the node if there is none.
+class YOGA_EXPORT Replay {
+public:
+  // Returns `nullptr` if `capture` is malformed or of unsupported version.
+  static std::unique_ptr<Replay> fromCapture(const std::string& capture);
+
+  ~Replay();
+
+  Replay(const Replay&) = delete;
+  Replay& operator=(const Replay&) = delete;
+
+  YGNodeRef getRoot() const { return root_; }
+  size_t getNodeCount() const { return nodes_.size(); }
+  size_t getMeasurementCount() const;
+
+  // Lays out the whole tree from scratch, with the constraints of the
+  // captured pass.
+  void layout();
+
+  struct RecordedNode {
+    std::vector<Measurement> measurements;
+    std::vector<Baseline> baselines;
+    float width;
+    float height;
+  };
+
+private:
+  Replay() = default;
+
+  YGConfigRef config_ = nullptr;
+  YGNodeRef root_ = nullptr;
+  float ownerWidth_ = YGUndefined;
+  float ownerHeight_ = YGUndefined;
+  YGDirection ownerDirection_ = YGDirectionInherit;
+  std::vector<RecordedNode> nodes_;
+};
+
+} // namespace capture
+} // namespace yoga
+} // namespace facebook
@@ -61,7 +61,10 @@ Node* push(Node* newHead) {
 
 } // namespace
 
+std::atomic<bool> Event::hasSubscribers_{false};
+
 void Event::reset() {
+  hasSubscribers_.store(false, std::memory_order_relaxed);
   auto head = push(nullptr);
   while (head != nullptr) {
     auto current = head;
@@ -72,6 +75,7 @@ void Event::reset() {
 
 void Event::subscribe(std::function<Subscriber>&& subscriber) {
   push(new Node{std::move(subscriber)});
+  hasSubscribers_.store(true, std::memory_order_relaxed);
 }
 
 void Event::publish(const YGNode& node, Type eventType, const Data& eventData) {
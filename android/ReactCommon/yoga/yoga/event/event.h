@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <vector>
 #include <array>
@@ -47,6 +48,10 @@ struct LayoutData {
   int measureCallbacks;
   std::array<int, static_cast<uint8_t>(LayoutPassReason::COUNT)>
       measureCallbackReasonsCount;
+  // Number of times nodes were visited by the pass (including cache hits).
+  int visitedNodes;
+  // Number of relayout boundaries laid out after the main pass.
+  int relayoutBoundaries;
 };
 
 const char* LayoutPassReasonToString(const LayoutPassReason value);
@@ -87,10 +92,15 @@ struct YOGA_EXPORT Event {
 
   static void subscribe(std::function<Subscriber>&& subscriber);
 
+  // Events are only published while there are subscribers; otherwise this
+  // costs a relaxed atomic load. Building with `YG_DISABLE_EVENTS` compiles
+  // publishing out.
   template <Type E>
   static void publish(const YGNode& node, const TypedData<E>& eventData = {}) {
-#ifdef YG_ENABLE_EVENTS
-    publish(node, E, Data{eventData});
+#ifndef YG_DISABLE_EVENTS
+    if (hasSubscribers_.load(std::memory_order_relaxed)) {
+      publish(node, E, Data{eventData});
+    }
 #endif
   }
 
@@ -100,6 +110,8 @@ struct YOGA_EXPORT Event {
   }
 
 private:
+  static std::atomic<bool> hasSubscribers_;
+
   static void publish(const YGNode&, Type, const Data&);
 };
 
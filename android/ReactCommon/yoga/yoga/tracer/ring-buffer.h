@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+// Per-thread ring buffers for tracers which must not take a lock while
+// recording. Used by Yoga's tracer and by React Native's `SystraceRecorder`.
+
+namespace facebook {
+namespace yoga {
+namespace tracer {
+
+// Ring buffer written by a single thread and read by any. Slots are made of
+// atomic words so that readers can copy records being overwritten; such
+// records are detected with `reserved_` and dropped (as with a seqlock).
+// `StatCount` counters can be kept along with the records.
+template <typename Record, size_t StatCount = 0>
+class RingBuffer {
+  static_assert(
+      std::is_trivially_copyable<Record>::value,
+      "Records are copied word by word");
+  static_assert(
+      sizeof(Record) % sizeof(uint64_t) == 0,
+      "Records must be made of whole words");
+
+public:
+  // `capacity` must be a power of two.
+  RingBuffer(uint64_t capacity, uint32_t generation, uint32_t threadId)
+      : generation{generation},
+        threadId{threadId},
+        capacity_{capacity},
+        slots_{new Slot[capacity]} {}
+
+  const uint32_t generation;
+  const uint32_t threadId;
+  std::atomic<bool> isRetired{false};
+
+  // Only the words holding the first `size` bytes of `record` are written;
+  // the rest of the slot is stale.
+  void push(const Record& record, size_t size = sizeof(Record)) {
+    auto index = published_.load(std::memory_order_relaxed);
+    reserved_.store(index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    auto wordCount = std::min(
+        (size + sizeof(uint64_t) - 1) / sizeof(uint64_t), kRecordWords);
+    uint64_t words[kRecordWords];
+    memcpy(words, &record, wordCount * sizeof(uint64_t));
+    auto& slot = slots_[index & (capacity_ - 1)];
+    for (size_t i = 0; i < wordCount; i++) {
+      slot[i].store(words[i], std::memory_order_relaxed);
+    }
+
+    published_.store(index + 1, std::memory_order_release);
+  }
+
+  std::vector<Record> read() const {
+    auto end = published_.load(std::memory_order_acquire);
+    auto begin = end > capacity_ ? end - capacity_ : 0;
+
+    std::vector<Record> records(end - begin);
+    for (auto index = begin; index < end; index++) {
+      uint64_t words[kRecordWords];
+      auto& slot = slots_[index & (capacity_ - 1)];
+      for (size_t i = 0; i < kRecordWords; i++) {
+        words[i] = slot[i].load(std::memory_order_relaxed);
+      }
+      memcpy(&records[index - begin], words, sizeof(Record));
+    }
+
+    // Records from `reserved - capacity` on may have been overwritten while
+    // they were copied.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    auto reserved = reserved_.load(std::memory_order_relaxed);
+    if (reserved > capacity_ && reserved - capacity_ > begin) {
+      auto overwritten = std::min<uint64_t>(
+          reserved - capacity_ - begin, records.size());
+      records.erase(records.begin(), records.begin() + overwritten);
+    }
+    return records;
+  }
+
+  uint64_t getOverwrittenCount() const {
+    auto published = published_.load(std::memory_order_relaxed);
+    return published > capacity_ ? published - capacity_ : 0;
+  }
+
+  // Stats are only changed by the owning thread, so they don't need atomic
+  // read-modify-writes.
+  void addStat(size_t stat, uint64_t value) {
+    stats_[stat].store(
+        stats_[stat].load(std::memory_order_relaxed) + value,
+        std::memory_order_relaxed);
+  }
+
+  uint64_t getStat(size_t stat) const {
+    return stats_[stat].load(std::memory_order_relaxed);
+  }
+
+private:
+  static constexpr size_t kRecordWords = sizeof(Record) / sizeof(uint64_t);
+  using Slot = std::array<std::atomic<uint64_t>, kRecordWords>;
+
+  const uint64_t capacity_;
+  std::unique_ptr<Slot[]> slots_;
+  std::atomic<uint64_t> reserved_{0};
+  std::atomic<uint64_t> published_{0};
+  std::array<std::atomic<uint64_t>, StatCount> stats_{};
+};
+
+// Number of the calling thread. It is the same for all tracers, so that
+// their traces line up.
+inline uint32_t getThreadId() {
+  static std::atomic<uint32_t> nextThreadId{1};
+  thread_local uint32_t threadId =
+      nextThreadId.fetch_add(1, std::memory_order_relaxed);
+  return threadId;
+}
+
+// The buffers threads record into, one set per `Buffer` type (a
+// `RingBuffer`). Buffers of exited threads are kept for export, up to
+// `kMaxRetiredBuffers`.
+template <typename Buffer>
+class ThreadBuffers {
+public:
+  static constexpr size_t kMaxRetiredBuffers = 16;
+
+  // Drops all buffers. Threads get a new buffer of `capacity` (a power of
+  // two) when they next record.
+  static void reset(uint64_t capacity) {
+    auto& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.capacity = capacity;
+    state.buffers.clear();
+    state.generation.fetch_add(1, std::memory_order_release);
+  }
+
+  // The buffer of the calling thread. Buffers from before the last `reset`
+  // are replaced on first use.
+  static Buffer& get() {
+    thread_local ThreadBuffer local;
+    if (local.buffer == nullptr ||
+        local.buffer->generation !=
+            getState().generation.load(std::memory_order_acquire)) {
+      local.buffer = create();
+    }
+    return *local.buffer;
+  }
+
+  static std::vector<std::shared_ptr<Buffer>> getAll() {
+    auto& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    return state.buffers;
+  }
+
+private:
+  struct State {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    uint64_t capacity = 2;
+    std::atomic<uint32_t> generation{0};
+  };
+
+  struct ThreadBuffer {
+    std::shared_ptr<Buffer> buffer;
+
+    ~ThreadBuffer() {
+      if (buffer != nullptr) {
+        buffer->isRetired = true;
+      }
+    }
+  };
+
+  static State& getState() {
+    static State state;
+    return state;
+  }
+
+  static std::shared_ptr<Buffer> create() {
+    auto& state = getState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    auto& buffers = state.buffers;
+    auto retiredCount = static_cast<size_t>(std::count_if(
+        buffers.begin(), buffers.end(), [](const std::shared_ptr<Buffer>& b) {
+          return b->isRetired.load();
+        }));
+    for (auto it = buffers.begin();
+         retiredCount >= kMaxRetiredBuffers && it != buffers.end();) {
+      if ((*it)->isRetired) {
+        it = buffers.erase(it);
+        retiredCount--;
+      } else {
+        ++it;
+      }
+    }
+
+    auto buffer = std::make_shared<Buffer>(
+        state.capacity,
+        state.generation.load(std::memory_order_relaxed),
+        getThreadId());
+    buffers.push_back(buffer);
+    return buffer;
+  }
+};
+
+template <typename Record, size_t StatCount>
+constexpr size_t RingBuffer<Record, StatCount>::kRecordWords;
+
+template <typename Buffer>
+constexpr size_t ThreadBuffers<Buffer>::kMaxRetiredBuffers;
+
+} // namespace tracer
+} // namespace yoga
+} // namespace facebook
@@ -0,0 +1,395 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "tracer.h"
+#include "ring-buffer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace facebook {
+namespace yoga {
+namespace tracer {
+
+namespace {
+
+// What a record holds in `detail`, `modes` and `a`/`b`/`c` depends on its
+// type:
+// - LayoutPassEnd: a = measure callbacks, b = cache hits, c = visited nodes.
+// - MeasureCallbackEnd: detail = reason, modes = width and height measure
+//   modes (4 bits each), a and b = bits of the measured width and height.
+// - NodeLayout: detail = layout type.
+struct Record {
+  uint64_t timestamp;
+  uint64_t node;
+  uint8_t type;
+  uint8_t detail;
+  uint16_t modes;
+  uint32_t a;
+  uint32_t b;
+  uint32_t c;
+};
+
+static_assert(sizeof(Record) == 32, "Records are expected to be 32 bytes");
+
+enum Stat : size_t {
+  kPasses,
+  kLayouts,
+  kMeasures,
+  kCachedLayouts,
+  kCachedMeasures,
+  kMeasureCallbacks,
+  kVisitedNodes,
+  kRelayoutBoundaries,
+  kMeasureCallbackReasons,
+  kStatCount =
+      kMeasureCallbackReasons + static_cast<size_t>(LayoutPassReason::COUNT),
+};
+
+using Buffer = RingBuffer<Record, kStatCount>;
+using Buffers = ThreadBuffers<Buffer>;
+
+std::atomic<bool> isRecording{false};
+std::atomic<uint32_t> eventMask{kDefaultEventMask};
+
+std::once_flag subscribeOnce;
+
+uint64_t now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+uint32_t floatBits(float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+float bitsFloat(uint32_t bits) {
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+void recordLayoutData(Buffer& buffer, const LayoutData& data) {
+  buffer.addStat(kPasses, 1);
+  buffer.addStat(kLayouts, data.layouts);
+  buffer.addStat(kMeasures, data.measures);
+  buffer.addStat(kCachedLayouts, data.cachedLayouts);
+  buffer.addStat(kCachedMeasures, data.cachedMeasures);
+  buffer.addStat(kMeasureCallbacks, data.measureCallbacks);
+  buffer.addStat(kVisitedNodes, data.visitedNodes);
+  buffer.addStat(kRelayoutBoundaries, data.relayoutBoundaries);
+  for (size_t i = 0; i < data.measureCallbackReasonsCount.size(); i++) {
+    buffer.addStat(
+        kMeasureCallbackReasons + i, data.measureCallbackReasonsCount[i]);
+  }
+}
+
+void recordEvent(const YGNode& node, Event::Type type, Event::Data data) {
+  if (!isRecording.load(std::memory_order_relaxed)) {
+    return;
+  }
+
+  auto isMasked = (eventMask.load(std::memory_order_relaxed) &
+                   eventBit(type)) == 0;
+  if (isMasked && type != Event::LayoutPassEnd) {
+    return;
+  }
+
+  auto& buffer = Buffers::get();
+  Record record = {
+      now(), reinterpret_cast<uintptr_t>(&node), static_cast<uint8_t>(type)};
+
+  switch (type) {
+    case Event::LayoutPassEnd: {
+      const auto* layoutData = data.get<Event::LayoutPassEnd>().layoutData;
+      if (layoutData == nullptr) {
+        break;
+      }
+      recordLayoutData(buffer, *layoutData);
+      record.a = layoutData->measureCallbacks;
+      record.b = layoutData->cachedLayouts + layoutData->cachedMeasures;
+      record.c = layoutData->visitedNodes;
+      break;
+    }
+    case Event::MeasureCallbackEnd: {
+      const auto& measureData = data.get<Event::MeasureCallbackEnd>();
+      record.detail = static_cast<uint8_t>(measureData.reason);
+      record.modes = measureData.widthMeasureMode |
+          (measureData.heightMeasureMode << 4);
+      record.a = floatBits(measureData.measuredWidth);
+      record.b = floatBits(measureData.measuredHeight);
+      break;
+    }
+    case Event::NodeLayout:
+      record.detail =
+          static_cast<uint8_t>(data.get<Event::NodeLayout>().layoutType);
+      break;
+    default:
+      break;
+  }
+
+  if (!isMasked) {
+    buffer.push(record);
+  }
+}
+
+const char* eventName(Event::Type type) {
+  switch (type) {
+    case Event::NodeAllocation:
+      return "NodeAllocation";
+    case Event::NodeDeallocation:
+      return "NodeDeallocation";
+    case Event::NodeLayout:
+      return "NodeLayout";
+    case Event::LayoutPassStart:
+    case Event::LayoutPassEnd:
+      return "LayoutPass";
+    case Event::MeasureCallbackStart:
+    case Event::MeasureCallbackEnd:
+      return "MeasureCallback";
+    case Event::NodeBaselineStart:
+    case Event::NodeBaselineEnd:
+      return "NodeBaseline";
+  }
+  return "Unknown";
+}
+
+const char* layoutTypeName(uint8_t layoutType) {
+  switch (static_cast<LayoutType>(layoutType)) {
+    case LayoutType::kLayout:
+      return "layout";
+    case LayoutType::kMeasure:
+      return "measure";
+    case LayoutType::kCachedLayout:
+      return "cached_layout";
+    case LayoutType::kCachedMeasure:
+      return "cached_measure";
+  }
+  return "unknown";
+}
+
+const char* measureModeName(uint16_t mode) {
+  return mode <= YGMeasureModeAtMost ? YGMeasureModeToString(
+                                         static_cast<YGMeasureMode>(mode))
+                                   : "unknown";
+}
+
+// Trace event timestamps are in microseconds.
+void writeTime(std::ostream& stream, uint64_t nanoseconds) {
+  char buffer[32];
+  snprintf(
+      buffer,
+      sizeof(buffer),
+      "%llu.%03u",
+      static_cast<unsigned long long>(nanoseconds / 1000),
+      static_cast<unsigned>(nanoseconds % 1000));
+  stream << buffer;
+}
+
+void writeFloat(std::ostream& stream, float value) {
+  if (std::isnan(value)) {
+    stream << "null";
+    return;
+  }
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "%g", value);
+  stream << buffer;
+}
+
+void writeArgs(std::ostream& stream, const Record& record) {
+  char node[32];
+  snprintf(
+      node,
+      sizeof(node),
+      "0x%llx",
+      static_cast<unsigned long long>(record.node));
+  stream << "\"args\":{\"node\":\"" << node << "\"";
+
+  switch (record.type) {
+    case Event::LayoutPassEnd:
+      stream << ",\"measureCallbacks\":" << record.a
+             << ",\"cacheHits\":" << record.b
+             << ",\"visitedNodes\":" << record.c;
+      break;
+    case Event::MeasureCallbackEnd:
+      stream << ",\"reason\":\""
+             << LayoutPassReasonToString(
+                    static_cast<LayoutPassReason>(record.detail))
+             << "\",\"widthMode\":\"" << measureModeName(record.modes & 0xf)
+             << "\",\"heightMode\":\"" << measureModeName(record.modes >> 4)
+             << "\",\"measuredWidth\":";
+      writeFloat(stream, bitsFloat(record.a));
+      stream << ",\"measuredHeight\":";
+      writeFloat(stream, bitsFloat(record.b));
+      break;
+    case Event::NodeLayout:
+      stream << ",\"layoutType\":\"" << layoutTypeName(record.detail) << "\"";
+      break;
+    default:
+      break;
+  }
+  stream << "}";
+}
+
+bool isStart(uint8_t type) {
+  return type == Event::LayoutPassStart ||
+      type == Event::MeasureCallbackStart || type == Event::NodeBaselineStart;
+}
+
+bool isEnd(uint8_t type) {
+  return type == Event::LayoutPassEnd || type == Event::MeasureCallbackEnd ||
+      type == Event::NodeBaselineEnd;
+}
+
+// Writes start and end records as complete events. Ends whose start was
+// overwritten, and starts of events still in progress, are left out.
+bool writeRecords(
+    std::ostream& stream,
+    const std::vector<Record>& records,
+    uint32_t threadId,
+    bool isFirst) {
+  std::vector<const Record*> starts;
+  for (const auto& record : records) {
+    if (isStart(record.type)) {
+      starts.push_back(&record);
+      continue;
+    }
+
+    const Record* start = nullptr;
+    if (isEnd(record.type)) {
+      if (starts.empty() || starts.back()->type + 1 != record.type ||
+          starts.back()->node != record.node) {
+        continue;
+      }
+      start = starts.back();
+      starts.pop_back();
+    }
+
+    stream << (isFirst ? "\n" : ",\n") << "{\"name\":\""
+           << eventName(static_cast<Event::Type>(record.type))
+           << "\",\"cat\":\"yoga\",\"pid\":1,\"tid\":" << threadId;
+    isFirst = false;
+    if (start != nullptr) {
+      stream << ",\"ph\":\"X\",\"ts\":";
+      writeTime(stream, start->timestamp);
+      stream << ",\"dur\":";
+      writeTime(stream, record.timestamp - start->timestamp);
+    } else {
+      stream << ",\"ph\":\"i\",\"s\":\"t\",\"ts\":";
+      writeTime(stream, record.timestamp);
+    }
+    stream << ",";
+    writeArgs(stream, record);
+    stream << "}";
+  }
+  return isFirst;
+}
+
+double hitRate(uint64_t hits, uint64_t misses) {
+  return hits + misses == 0 ? 0 : static_cast<double>(hits) / (hits + misses);
+}
+
+} // namespace
+
+double Stats::layoutCacheHitRate() const {
+  return hitRate(cachedLayouts, layouts);
+}
+
+double Stats::measureCacheHitRate() const {
+  return hitRate(cachedMeasures, measures);
+}
+
+void start(const Options& options) {
+  std::call_once(subscribeOnce, [] { Event::subscribe(recordEvent); });
+
+  uint32_t size = 1;
+  while (size < std::max(options.bufferSize, 2u) && size < (1u << 31)) {
+    size <<= 1;
+  }
+  eventMask = options.eventMask;
+  Buffers::reset(size);
+  isRecording = true;
+}
+
+void stop() {
+  isRecording = false;
+}
+
+bool isTracing() {
+  return isRecording.load(std::memory_order_relaxed);
+}
+
+Stats getStats() {
+  Stats stats = {};
+  for (const auto& buffer : Buffers::getAll()) {
+    stats.passes += buffer->getStat(kPasses);
+    stats.layouts += buffer->getStat(kLayouts);
+    stats.measures += buffer->getStat(kMeasures);
+    stats.cachedLayouts += buffer->getStat(kCachedLayouts);
+    stats.cachedMeasures += buffer->getStat(kCachedMeasures);
+    stats.measureCallbacks += buffer->getStat(kMeasureCallbacks);
+    stats.visitedNodes += buffer->getStat(kVisitedNodes);
+    stats.relayoutBoundaries += buffer->getStat(kRelayoutBoundaries);
+    for (size_t i = 0; i < stats.measureCallbackReasonsCount.size(); i++) {
+      stats.measureCallbackReasonsCount[i] +=
+          buffer->getStat(kMeasureCallbackReasons + i);
+    }
+    stats.overwrittenRecords += buffer->getOverwrittenCount();
+  }
+  return stats;
+}
+
+void writeChromeTrace(std::ostream& stream) {
+  stream << "{\"traceEvents\":[";
+  bool isFirst = true;
+  for (const auto& buffer : Buffers::getAll()) {
+    isFirst = writeRecords(stream, buffer->read(), buffer->threadId, isFirst);
+  }
+
+  auto stats = getStats();
+  char rate[32];
+  stream << "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{"
+         << "\"passes\":" << stats.passes << ",\"layouts\":" << stats.layouts
+         << ",\"measures\":" << stats.measures
+         << ",\"cachedLayouts\":" << stats.cachedLayouts
+         << ",\"cachedMeasures\":" << stats.cachedMeasures;
+  snprintf(rate, sizeof(rate), "%.4f", stats.layoutCacheHitRate());
+  stream << ",\"layoutCacheHitRate\":" << rate;
+  snprintf(rate, sizeof(rate), "%.4f", stats.measureCacheHitRate());
+  stream << ",\"measureCacheHitRate\":" << rate
+         << ",\"measureCallbacks\":" << stats.measureCallbacks
+         << ",\"measureCallbackReasons\":{";
+  for (size_t i = 0; i < stats.measureCallbackReasonsCount.size(); i++) {
+    stream << (i == 0 ? "" : ",") << "\""
+           << LayoutPassReasonToString(static_cast<LayoutPassReason>(i))
+           << "\":" << stats.measureCallbackReasonsCount[i];
+  }
+  stream << "},\"visitedNodes\":" << stats.visitedNodes
+         << ",\"relayoutBoundaries\":" << stats.relayoutBoundaries
+         << ",\"overwrittenRecords\":" << stats.overwrittenRecords << "}}\n";
+}
+
+std::string toChromeTrace() {
+  std::ostringstream stream;
+  writeChromeTrace(stream);
+  return stream.str();
+}
+
+} // namespace tracer
+} // namespace yoga
+} // namespace facebook
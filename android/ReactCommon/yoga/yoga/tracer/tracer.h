@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <yoga/event/event.h>
+
+namespace facebook {
+namespace yoga {
+namespace tracer {
+
+// Nothing is recorded if Yoga is built with `YG_DISABLE_EVENTS`.
+
+constexpr uint32_t eventBit(Event::Type type) {
+  return 1u << static_cast<uint32_t>(type);
+}
+
+// Per-node events (`NodeLayout`, allocations) are left out by default: they
+// are by far the most frequent ones and passes are usually enough to find
+// slow layouts.
+constexpr uint32_t kDefaultEventMask = eventBit(Event::LayoutPassStart) |
+    eventBit(Event::LayoutPassEnd) | eventBit(Event::MeasureCallbackStart) |
+    eventBit(Event::MeasureCallbackEnd) | eventBit(Event::NodeBaselineStart) |
+    eventBit(Event::NodeBaselineEnd);
+
+struct Options {
+  // Number of records each thread keeps, rounded up to a power of two. A
+  // record takes 32 bytes; older records are overwritten.
+  uint32_t bufferSize = 4096;
+  // Events which are not in the mask are not recorded.
+  uint32_t eventMask = kDefaultEventMask;
+};
+
+// Totals of the `LayoutData` of every traced layout pass.
+struct Stats {
+  uint64_t passes;
+  uint64_t layouts;
+  uint64_t measures;
+  uint64_t cachedLayouts;
+  uint64_t cachedMeasures;
+  uint64_t measureCallbacks;
+  std::array<uint64_t, static_cast<uint8_t>(LayoutPassReason::COUNT)>
+      measureCallbackReasonsCount;
+  uint64_t visitedNodes;
+  uint64_t relayoutBoundaries;
+  // Records overwritten because a buffer was full.
+  uint64_t overwrittenRecords;
+
+  double layoutCacheHitRate() const;
+  double measureCacheHitRate() const;
+};
+
+// Starts recording events, dropping records and stats of previous traces.
+// Recording an event takes a few relaxed atomic operations on a buffer owned
+// by the publishing thread, so it never blocks layout.
+YOGA_EXPORT void start(const Options& options = {});
+
+// Stops recording. Records stay available for export until the next `start`.
+YOGA_EXPORT void stop();
+
+YOGA_EXPORT bool isTracing();
+
+// Can be called while tracing, from any thread.
+YOGA_EXPORT Stats getStats();
+
+// Writes the records in the Chrome trace event format (the JSON object
+// format, loadable in chrome://tracing and Perfetto). Passes, measure and
+// baseline calls become complete ("X") events, and other events instant ones.
+// Stats are written as `otherData`. Can be called while tracing, from any
+// thread.
+YOGA_EXPORT void writeChromeTrace(std::ostream& stream);
+YOGA_EXPORT std::string toChromeTrace();
+
+} // namespace tracer
+} // namespace yoga
+} // namespace facebook
@@ -67,10 +67,12 @@ NativeReanimatedModule::NativeReanimatedModule(
     PlatformDepMethodsHolder platformDepMethodsHolder)
     : NativeReanimatedModuleSpec(jsInvoker),
       RuntimeManager(rt, errorHandler, scheduler, RuntimeType::UI),
+      propsBatch(std::make_shared<PropsBatch>()),
       mapperRegistry(std::make_shared<MapperRegistry>()),
       eventHandlerRegistry(std::make_shared<EventHandlerRegistry>()),
       requestRender(platformDepMethodsHolder.requestRender),
-      propObtainer(propObtainer) {
+      propObtainer(propObtainer),
+      batchedUpdaterFunction(platformDepMethodsHolder.batchedUpdaterFunction) {
   auto requestAnimationFrame = [=](FrameCallback callback) {
     frameCallbacks.push_back(callback);
     maybeRequestRender();
@@ -78,9 +80,28 @@ NativeReanimatedModule::NativeReanimatedModule(
 
   this->layoutAnimationsProxy = layoutAnimationsProxy;
 
+  updaterFunction = platformDepMethodsHolder.updaterFunction;
+  if (batchedUpdaterFunction) {
+    auto batch = propsBatch;
+    auto platformUpdater = platformDepMethodsHolder.updaterFunction;
+    // Updates made outside of a frame or an event (e.g. from runOnUI) are
+    // still applied immediately.
+    updaterFunction = [batch, platformUpdater](
+                          jsi::Runtime &rt,
+                          int viewTag,
+                          const jsi::Value &viewName,
+                          const jsi::Object &props) {
+      if (batch->isOpen()) {
+        batch->record(rt, viewTag, props);
+      } else {
+        platformUpdater(rt, viewTag, viewName, props);
+      }
+    };
+  }
+
   RuntimeDecorator::decorateUIRuntime(
       *runtime,
-      platformDepMethodsHolder.updaterFunction,
+      updaterFunction,
       requestAnimationFrame,
       platformDepMethodsHolder.scrollToFunction,
       platformDepMethodsHolder.measuringFunction,
@@ -91,7 +112,6 @@ NativeReanimatedModule::NativeReanimatedModule(
     this->renderRequested = false;
     this->onRender(timestampMs);
   };
-  updaterFunction = platformDepMethodsHolder.updaterFunction;
 }
 
 void NativeReanimatedModule::installCoreFunctions(
@@ -246,17 +266,27 @@ jsi::Value NativeReanimatedModule::enableLayoutAnimations(
 void NativeReanimatedModule::onEvent(
     std::string eventName,
     std::string eventAsString) {
+  onEvent(eventName, JSONEventPayload(std::move(eventAsString)));
+}
+
+void NativeReanimatedModule::onEvent(
+    const std::string &eventName,
+    const EventPayload &eventPayload) {
   try {
-    eventHandlerRegistry->processEvent(*runtime, eventName, eventAsString);
+    beginPropsBatch();
+    eventHandlerRegistry->processEvent(*runtime, eventName, eventPayload);
     mapperRegistry->execute(*runtime);
+    commitPropsBatch();
     if (mapperRegistry->needRunOnRender()) {
       maybeRequestRender();
     }
   } catch (std::exception &e) {
+    propsBatch->discard();
     std::string str = e.what();
     this->errorHandler->setError(str);
     this->errorHandler->raise();
   } catch (...) {
+    propsBatch->discard();
     std::string str = "OnEvent error";
     this->errorHandler->setError(str);
     this->errorHandler->raise();
@@ -277,25 +307,41 @@ void NativeReanimatedModule::maybeRequestRender() {
 
 void NativeReanimatedModule::onRender(double timestampMs) {
   try {
+    beginPropsBatch();
     std::vector<FrameCallback> callbacks = frameCallbacks;
     frameCallbacks.clear();
     for (auto &callback : callbacks) {
       callback(timestampMs);
     }
     mapperRegistry->execute(*runtime);
+    commitPropsBatch();
 
     if (mapperRegistry->needRunOnRender()) {
       maybeRequestRender();
     }
   } catch (std::exception &e) {
+    propsBatch->discard();
     std::string str = e.what();
     this->errorHandler->setError(str);
     this->errorHandler->raise();
   } catch (...) {
+    propsBatch->discard();
     std::string str = "OnRender error";
     this->errorHandler->setError(str);
     this->errorHandler->raise();
   }
 }
 
+void NativeReanimatedModule::beginPropsBatch() {
+  if (batchedUpdaterFunction) {
+    propsBatch->begin();
+  }
+}
+
+void NativeReanimatedModule::commitPropsBatch() {
+  if (batchedUpdaterFunction) {
+    propsBatch->commit(*runtime, batchedUpdaterFunction);
+  }
+}
+
 } // namespace reanimated
@@ -8,6 +8,7 @@ void EventHandlerRegistry::registerEventHandler(
   const std::lock_guard<std::mutex> lock(instanceMutex);
   eventMappings[eventHandler->eventName][eventHandler->id] = eventHandler;
   eventHandlers[eventHandler->id] = eventHandler;
+  updateHandlersSnapshot();
 }
 
 void EventHandlerRegistry::unregisterEventHandler(unsigned long id) {
@@ -19,50 +20,67 @@ void EventHandlerRegistry::unregisterEventHandler(unsigned long id) {
       eventMappings.erase(handlerIt->second->eventName);
     }
     eventHandlers.erase(handlerIt);
+    updateHandlersSnapshot();
   }
 }
 
-void EventHandlerRegistry::processEvent(
-    jsi::Runtime &rt,
-    std::string eventName,
-    std::string eventPayload) {
-  std::vector<std::shared_ptr<WorkletEventHandler>> handlersForEvent;
-  {
-    const std::lock_guard<std::mutex> lock(instanceMutex);
-    auto handlersIt = eventMappings.find(eventName);
-    if (handlersIt != eventMappings.end()) {
-      for (auto handler : handlersIt->second) {
-        handlersForEvent.push_back(handler.second);
-      }
+void EventHandlerRegistry::updateHandlersSnapshot() {
+  // Must be called with `instanceMutex` held.
+  auto snapshot = std::make_shared<HandlersByEventName>();
+  snapshot->reserve(eventMappings.size());
+  for (auto &mapping : eventMappings) {
+    auto &handlers = (*snapshot)[mapping.first];
+    handlers.reserve(mapping.second.size());
+    for (auto &handler : mapping.second) {
+      handlers.push_back(handler.second);
     }
   }
-  // We receive here a JS Map with JSON as a value of NativeMap key
-  // { NativeMap: { "jsonProp": "json value" } }
-  // So we need to extract only JSON part
-  std::string delimimter = "NativeMap:";
-  auto positionToSplit = eventPayload.find(delimimter) + delimimter.size();
-  auto lastBracketCharactedPosition = eventPayload.size() - positionToSplit - 1;
-  auto eventJSON =
-      eventPayload.substr(positionToSplit, lastBracketCharactedPosition);
+  std::atomic_store(
+      &handlersSnapshot,
+      std::shared_ptr<const HandlersByEventName>(std::move(snapshot)));
+}
 
-  if (eventJSON.compare(std::string("null")) == 0) {
+std::shared_ptr<const EventHandlerRegistry::HandlersByEventName>
+EventHandlerRegistry::getHandlersSnapshot() const {
+  return std::atomic_load(&handlersSnapshot);
+}
+
+void EventHandlerRegistry::processEvent(
+    jsi::Runtime &rt,
+    const std::string &eventName,
+    const EventPayload &eventPayload) {
+  auto snapshot = getHandlersSnapshot();
+  auto handlersIt = snapshot->find(eventName);
+  if (handlersIt == snapshot->end() || handlersIt->second.empty()) {
     return;
   }
 
-  auto eventObject = jsi::Value::createFromJsonUtf8(
-      rt, reinterpret_cast<uint8_t *>(&eventJSON[0]), eventJSON.size());
+  auto eventObject = eventPayload.toJSIValue(rt, propNameIDCache);
+  if (eventObject.isUndefined()) {
+    return;
+  }
 
   eventObject.asObject(rt).setProperty(
-      rt, "eventName", jsi::String::createFromUtf8(rt, eventName));
-  for (auto handler : handlersForEvent) {
+      rt,
+      propNameIDCache.get(rt, "eventName"),
+      jsi::String::createFromUtf8(rt, eventName));
+  for (auto &handler : handlersIt->second) {
     handler->process(rt, eventObject);
   }
 }
 
-bool EventHandlerRegistry::isAnyHandlerWaitingForEvent(std::string eventName) {
-  const std::lock_guard<std::mutex> lock(instanceMutex);
-  auto it = eventMappings.find(eventName);
-  return (it != eventMappings.end()) && (!(it->second).empty());
+void EventHandlerRegistry::processEvent(
+    jsi::Runtime &rt,
+    std::string eventName,
+    std::string eventPayload) {
+  processEvent(rt, eventName, JSONEventPayload(std::move(eventPayload)));
+}
+
+bool EventHandlerRegistry::isAnyHandlerWaitingForEvent(
+    const std::string &eventName) {
+  auto snapshot = getHandlersSnapshot();
+  auto it = snapshot->find(eventName);
+  return (it != snapshot->end()) && (!(it->second).empty());
 }
 
 } // namespace reanimated
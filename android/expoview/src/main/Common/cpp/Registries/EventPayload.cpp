@@ -0,0 +1,44 @@
+#include "EventPayload.h"
+
+namespace reanimated {
+
+const jsi::PropNameID &PropNameIDCache::get(
+    jsi::Runtime &rt,
+    const std::string &name) {
+  auto it = propNames.find(name);
+  if (it != propNames.end()) {
+    return it->second;
+  }
+  if (propNames.size() >= kMaxSize) {
+    propNames.clear();
+  }
+  return propNames.emplace(name, jsi::PropNameID::forUtf8(rt, name))
+      .first->second;
+}
+
+void PropNameIDCache::clear() {
+  propNames.clear();
+}
+
+jsi::Value JSONEventPayload::toJSIValue(
+    jsi::Runtime &rt,
+    PropNameIDCache &propNames) const {
+  // We receive here a JS Map with JSON as a value of NativeMap key
+  // { NativeMap: { "jsonProp": "json value" } }
+  // So we need to extract only JSON part
+  std::string delimimter = "NativeMap:";
+  auto positionToSplit = eventAsString.find(delimimter) + delimimter.size();
+  auto lastBracketCharactedPosition =
+      eventAsString.size() - positionToSplit - 1;
+  auto eventJSON =
+      eventAsString.substr(positionToSplit, lastBracketCharactedPosition);
+
+  if (eventJSON.compare(std::string("null")) == 0) {
+    return jsi::Value::undefined();
+  }
+
+  return jsi::Value::createFromJsonUtf8(
+      rt, reinterpret_cast<uint8_t *>(&eventJSON[0]), eventJSON.size());
+}
+
+} // namespace reanimated
@@ -31,6 +31,19 @@ void Mapper::execute(jsi::Runtime &rt) {
                                      .getProperty(rt, "value")
                                      .asObject(rt)
                                      .getArray(rt);
+    if (module->propsBatch->isOpen()) {
+      // All views get the same style, read it only once.
+      viewTags.clear();
+      for (size_t i = 0, size = jsViewDescriptorArray.size(rt); i < size;
+           ++i) {
+        auto jsViewDescriptor =
+            jsViewDescriptorArray.getValueAtIndex(rt, i).getObject(rt);
+        viewTags.push_back(static_cast<int>(
+            jsViewDescriptor.getProperty(rt, "tag").asNumber()));
+      }
+      module->propsBatch->record(rt, viewTags, newStyle);
+      return;
+    }
     for (int i = 0; i < jsViewDescriptorArray.length(rt); ++i) {
       auto jsViewDescriptor =
           jsViewDescriptorArray.getValueAtIndex(rt, i).getObject(rt);
@@ -0,0 +1,115 @@
+#include "PropsBatch.h"
+#include <algorithm>
+
+namespace reanimated {
+
+static uint64_t entryKey(int tag, int propId) {
+  return (static_cast<uint64_t>(static_cast<uint32_t>(tag)) << 32) |
+      static_cast<uint32_t>(propId);
+}
+
+void PropsBatch::begin() {
+  if (depth++ == 0 && propNames.size() > kMaxPropNames) {
+    propIds.clear();
+    propNames.clear();
+  }
+}
+
+void PropsBatch::commit(
+    jsi::Runtime &rt,
+    const BatchedUpdaterFunction &updater) {
+  if (depth == 0 || --depth > 0) {
+    return;
+  }
+  if (!entries.empty()) {
+    // Entries are already in insertion order; a stable sort keeps it within
+    // a view while grouping entries of the same view together.
+    std::stable_sort(
+        entries.begin(), entries.end(), [](const Entry &a, const Entry &b) {
+          return a.tag < b.tag;
+        });
+    updater(rt, *this);
+  }
+  clear();
+}
+
+void PropsBatch::discard() {
+  depth = 0;
+  clear();
+}
+
+void PropsBatch::clear() {
+  entries.clear();
+  values.clear();
+  entryIndexByKey.clear();
+}
+
+void PropsBatch::record(jsi::Runtime &rt, int tag, const jsi::Object &props) {
+  readProps(rt, props);
+  for (const auto &prop : pendingProps) {
+    write(tag, prop.first, prop.second);
+  }
+}
+
+void PropsBatch::record(
+    jsi::Runtime &rt,
+    const std::vector<int> &tags,
+    const jsi::Object &props) {
+  readProps(rt, props);
+  for (int tag : tags) {
+    for (const auto &prop : pendingProps) {
+      write(tag, prop.first, prop.second);
+    }
+  }
+}
+
+void PropsBatch::readProps(jsi::Runtime &rt, const jsi::Object &props) {
+  pendingProps.clear();
+  auto names = props.getPropertyNames(rt);
+  for (size_t i = 0, size = names.size(rt); i < size; i++) {
+    auto name = names.getValueAtIndex(rt, i).asString(rt);
+    values.push_back(props.getProperty(rt, name));
+    pendingProps.emplace_back(
+        internPropName(name.utf8(rt)), values.size() - 1);
+  }
+}
+
+void PropsBatch::write(int tag, int propId, size_t valueIndex) {
+  auto result =
+      entryIndexByKey.emplace(entryKey(tag, propId), entries.size());
+  if (result.second) {
+    entries.push_back({tag, propId, valueIndex});
+  } else {
+    entries[result.first->second].valueIndex = valueIndex;
+  }
+}
+
+int PropsBatch::internPropName(std::string &&name) {
+  auto it = propIds.find(name);
+  if (it != propIds.end()) {
+    return it->second;
+  }
+  int propId = static_cast<int>(propNames.size());
+  propNames.push_back(name);
+  propIds.emplace(std::move(name), propId);
+  return propId;
+}
+
+void CountingPropsBatchSink::operator()(
+    jsi::Runtime &rt,
+    const PropsBatch &batch) {
+  const auto &entries = batch.getEntries();
+  size_t views = 0;
+  for (size_t i = 0; i < entries.size(); i++) {
+    if (i == 0 || entries[i].tag != entries[i - 1].tag) {
+      views++;
+    }
+  }
+  flushCount++;
+  viewCount += views;
+  propCount += entries.size();
+  lastFlushViewCount = views;
+  lastFlushPropCount = entries.size();
+}
+
+} // namespace reanimated
@@ -6,9 +6,11 @@
 #include <vector>
 
 #include "ErrorHandler.h"
+#include "EventPayload.h"
 #include "LayoutAnimationsProxy.h"
 #include "NativeReanimatedModuleSpec.h"
 #include "PlatformDepMethodsHolder.h"
+#include "PropsBatch.h"
 #include "RuntimeDecorator.h"
 #include "RuntimeManager.h"
 #include "Scheduler.h"
@@ -73,10 +75,12 @@ class NativeReanimatedModule : public NativeReanimatedModuleSpec,
 
   void onRender(double timestampMs);
   void onEvent(std::string eventName, std::string eventAsString);
+  void onEvent(const std::string &eventName, const EventPayload &eventPayload);
   bool isAnyHandlerWaitingForEvent(std::string eventName);
 
   void maybeRequestRender();
   UpdaterFunction updaterFunction;
+  std::shared_ptr<PropsBatch> propsBatch;
 
  private:
   std::shared_ptr<MapperRegistry> mapperRegistry;
@@ -89,6 +93,10 @@ class NativeReanimatedModule : public NativeReanimatedModuleSpec,
       propObtainer;
   std::function<void(double)> onRenderCallback;
   std::shared_ptr<LayoutAnimationsProxy> layoutAnimationsProxy;
+  BatchedUpdaterFunction batchedUpdaterFunction;
+
+  void beginPropsBatch();
+  void commitPropsBatch();
 };
 
 } // namespace reanimated
@@ -9,6 +9,8 @@
 #include <unordered_map>
 #include <vector>
 
+#include "EventPayload.h"
+
 using namespace facebook;
 
 namespace reanimated {
@@ -16,6 +18,10 @@ namespace reanimated {
 class WorkletEventHandler;
 
 class EventHandlerRegistry {
+  using HandlersByEventName = std::unordered_map<
+      std::string,
+      std::vector<std::shared_ptr<WorkletEventHandler>>>;
+
   std::map<
       std::string,
       std::unordered_map<unsigned long, std::shared_ptr<WorkletEventHandler>>>
@@ -23,15 +29,36 @@ class EventHandlerRegistry {
   std::map<unsigned long, std::shared_ptr<WorkletEventHandler>> eventHandlers;
   std::mutex instanceMutex;
 
+  /**
+   Immutable copy of `eventMappings` which is replaced (under
+   `instanceMutex`) whenever handlers change. Events are routed through it
+   without taking `instanceMutex`, so the frame path never waits for JS
+   registering or unregistering handlers.
+   */
+  std::shared_ptr<const HandlersByEventName> handlersSnapshot =
+      std::make_shared<const HandlersByEventName>();
+
+  /**
+   Only accessed on the UI runtime thread.
+   */
+  PropNameIDCache propNameIDCache;
+
+  void updateHandlersSnapshot();
+  std::shared_ptr<const HandlersByEventName> getHandlersSnapshot() const;
+
  public:
   void registerEventHandler(std::shared_ptr<WorkletEventHandler> eventHandler);
   void unregisterEventHandler(unsigned long id);
 
+  void processEvent(
+      jsi::Runtime &rt,
+      const std::string &eventName,
+      const EventPayload &eventPayload);
   void processEvent(
       jsi::Runtime &rt,
       std::string eventName,
       std::string eventPayload);
-  bool isAnyHandlerWaitingForEvent(std::string eventName);
+  bool isAnyHandlerWaitingForEvent(const std::string &eventName);
 };
 
 } // namespace reanimated
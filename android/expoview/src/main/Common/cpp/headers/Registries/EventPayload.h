@@ -0,0 +1,64 @@
+#pragma once
+
+#include <jsi/jsi.h>
+#include <string>
+#include <unordered_map>
+
+using namespace facebook;
+
+namespace reanimated {
+
+/**
+ Caches jsi::PropNameIDs of event payload keys for a single runtime, so the
+ same keys (`contentOffset`, `x`, `translationY`, ...) are not re-created for
+ every event.
+ */
+class PropNameIDCache {
+ public:
+  /**
+   The returned reference is only valid until the next call to `get` or
+   `clear`: the cache is emptied when it's full.
+   */
+  const jsi::PropNameID &get(jsi::Runtime &rt, const std::string &name);
+  void clear();
+
+ private:
+  // Payloads with dynamic keys should not grow the cache without bounds.
+  static constexpr size_t kMaxSize = 512;
+
+  std::unordered_map<std::string, jsi::PropNameID> propNames;
+};
+
+/**
+ A native event payload which builds its JS representation directly, instead
+ of being serialized to JSON by the platform and parsed again on the UI
+ runtime.
+ */
+class EventPayload {
+ public:
+  virtual ~EventPayload() = default;
+
+  /**
+   Returns the payload as a JS value, or `undefined` if there is no payload.
+   */
+  virtual jsi::Value toJSIValue(jsi::Runtime &rt, PropNameIDCache &propNames)
+      const = 0;
+};
+
+/**
+ Payload received as a string in the `{ NativeMap: <json> }` form.
+ Kept for platforms which don't provide a structured payload.
+ */
+class JSONEventPayload : public EventPayload {
+ public:
+  explicit JSONEventPayload(std::string eventAsString)
+      : eventAsString(std::move(eventAsString)) {}
+
+  jsi::Value toJSIValue(jsi::Runtime &rt, PropNameIDCache &propNames)
+      const override;
+
+ private:
+  std::string eventAsString;
+};
+
+} // namespace reanimated
@@ -32,6 +32,7 @@ class Mapper : public std::enable_shared_from_this<Mapper> {
   UpdaterFunction *updateProps;
   int optimalizationLvl = 0;
   std::shared_ptr<ShareableValue> viewDescriptors;
+  std::vector<int> viewTags;
 
  public:
   Mapper(
@@ -5,6 +5,7 @@
 #include <string>
 #include <utility>
 #include <vector>
+#include "PropsBatch.h"
 
 using namespace facebook;
 
@@ -30,6 +31,8 @@ struct PlatformDepMethodsHolder {
   MeasuringFunction measuringFunction;
   TimeProviderFunction getCurrentTime;
   SetGestureStateFunction setGestureStateFunction;
+  // Optional; when set, props updated during a frame are sent in one batch.
+  BatchedUpdaterFunction batchedUpdaterFunction;
 };
 
 } // namespace reanimated
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <jsi/jsi.h>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace facebook;
+
+namespace reanimated {
+
+class PropsBatch;
+
+using BatchedUpdaterFunction =
+    std::function<void(jsi::Runtime &rt, const PropsBatch &batch)>;
+
+/**
+ Collects prop updates made during a single frame (or event) and hands them
+ to the platform at once, instead of calling the platform for every view.
+
+ Writes are stored as (view tag, interned prop name, value) records in flat
+ buffers which keep their capacity between frames. A repeated write of the
+ same prop of the same view replaces the previous value, so every prop is sent
+ at most once per flush. `viewName` is not recorded, so a platform which needs
+ it must not provide a batched updater.
+ */
+class PropsBatch {
+ public:
+  struct Entry {
+    int tag;
+    int propId;
+    size_t valueIndex;
+  };
+
+  /**
+   Opens the batch. Calls may be nested, only the outermost `commit` flushes.
+   */
+  void begin();
+
+  /**
+   Closes the batch opened by the matching `begin`. The outermost call sorts
+   the entries by view tag, passes them to `updater` (if there are any) and
+   clears the buffers.
+   */
+  void commit(jsi::Runtime &rt, const BatchedUpdaterFunction &updater);
+
+  /**
+   Drops all recorded updates and closes the batch, e.g. after an error.
+   */
+  void discard();
+
+  bool isOpen() const {
+    return depth > 0;
+  }
+
+  void record(jsi::Runtime &rt, int tag, const jsi::Object &props);
+
+  /**
+   Records the same props for multiple views. Values are read from `props`
+   only once and shared by all entries.
+   */
+  void record(
+      jsi::Runtime &rt,
+      const std::vector<int> &tags,
+      const jsi::Object &props);
+
+  /**
+   Entries of the batch; during `commit` they are ordered by view tag and
+   entries of one view are adjacent.
+   */
+  const std::vector<Entry> &getEntries() const {
+    return entries;
+  }
+
+  const std::string &getPropName(const Entry &entry) const {
+    return propNames[entry.propId];
+  }
+
+  const jsi::Value &getValue(const Entry &entry) const {
+    return values[entry.valueIndex];
+  }
+
+ private:
+  // Prop ids are only referenced by entries of the current batch, so the
+  // table can be reset between batches if dynamic keys make it grow.
+  static constexpr size_t kMaxPropNames = 1024;
+
+  void readProps(jsi::Runtime &rt, const jsi::Object &props);
+  void write(int tag, int propId, size_t valueIndex);
+  int internPropName(std::string &&name);
+  void clear();
+
+  int depth = 0;
+  std::vector<Entry> entries;
+  std::vector<jsi::Value> values;
+  std::unordered_map<uint64_t, size_t> entryIndexByKey;
+  std::unordered_map<std::string, int> propIds;
+  std::vector<std::string> propNames;
+  // (propId, valueIndex) pairs of the props object being recorded.
+  std::vector<std::pair<int, size_t>> pendingProps;
+};
+
+/**
+ Batched updater which doesn't talk to any platform but only counts what
+ it receives. Allows to run mappers headless, e.g. to benchmark a frame with
+ hundreds of animated views without a device. Pass it wrapped in `std::ref`
+ to keep reading the counters.
+ */
+class CountingPropsBatchSink {
+ public:
+  void operator()(jsi::Runtime &rt, const PropsBatch &batch);
+
+  size_t flushCount = 0;
+  size_t viewCount = 0;
+  size_t propCount = 0;
+  size_t lastFlushViewCount = 0;
+  size_t lastFlushPropCount = 0;
+};
+
+} // namespace reanimated
@@ -0,0 +1,56 @@
+#include "DynamicEventPayload.h"
+
+namespace reanimated {
+
+static jsi::Value valueFromDynamic(
+    jsi::Runtime &rt,
+    const folly::dynamic &value,
+    PropNameIDCache &propNames) {
+  switch (value.type()) {
+    case folly::dynamic::NULLT:
+      return jsi::Value::null();
+    case folly::dynamic::BOOL:
+      return jsi::Value(value.getBool());
+    case folly::dynamic::INT64:
+      return jsi::Value(static_cast<double>(value.getInt()));
+    case folly::dynamic::DOUBLE:
+      return jsi::Value(value.getDouble());
+    case folly::dynamic::STRING:
+      return jsi::String::createFromUtf8(rt, value.getString());
+    case folly::dynamic::ARRAY: {
+      jsi::Array array(rt, value.size());
+      size_t index = 0;
+      for (const auto &item : value) {
+        array.setValueAtIndex(
+            rt, index++, valueFromDynamic(rt, item, propNames));
+      }
+      return std::move(array);
+    }
+    case folly::dynamic::OBJECT: {
+      jsi::Object object(rt);
+      for (const auto &item : value.items()) {
+        if (!item.first.isString()) {
+          continue;
+        }
+        // The nested value has to be built first: building it can clear
+        // `propNames`, which invalidates the reference returned by `get`.
+        auto propValue = valueFromDynamic(rt, item.second, propNames);
+        object.setProperty(
+            rt, propNames.get(rt, item.first.getString()), propValue);
+      }
+      return std::move(object);
+    }
+  }
+  return jsi::Value::undefined();
+}
+
+jsi::Value DynamicEventPayload::toJSIValue(
+    jsi::Runtime &rt,
+    PropNameIDCache &propNames) const {
+  if (payload.isNull()) {
+    return jsi::Value::undefined();
+  }
+  return valueFromDynamic(rt, payload, propNames);
+}
+
+} // namespace reanimated
@@ -30,30 +30,48 @@ jni::local_ref<JNIHelper::PropsMap> JNIHelper::ConvertToPropsMap(
     auto jsiKey = propNames.getValueAtIndex(rt, i).asString(rt);
     auto value = props.getProperty(rt, jsiKey);
     auto key = jsiKey.utf8(rt);
-    if (value.isUndefined() || value.isNull()) {
-      map->put(key, nullptr);
-    } else if (value.isBool()) {
-      map->put(key, JBoolean::valueOf(value.getBool()));
-    } else if (value.isNumber()) {
-      map->put(key, jni::autobox(value.asNumber()));
-    } else if (value.isString()) {
-      map->put(key, jni::make_jstring(value.asString(rt).utf8(rt)));
-    } else if (value.isObject()) {
-      if (value.asObject(rt).isArray(rt)) {
-        map->put(
-            key,
-            ReadableNativeArray::newObjectCxxArgs(
-                jsi::dynamicFromValue(rt, value)));
-      } else {
-        map->put(
-            key,
-            ReadableNativeMap::newObjectCxxArgs(
-                jsi::dynamicFromValue(rt, value)));
-      }
+    if (!value.isSymbol()) {
+      map->put(key, ConvertToPropValue(rt, value));
     }
   }
 
   return map;
 }
 
+jni::local_ref<JObject> JNIHelper::ConvertToPropValue(
+    jsi::Runtime &rt,
+    const jsi::Value &value) {
+  if (value.isBool()) {
+    return JBoolean::valueOf(value.getBool());
+  } else if (value.isNumber()) {
+    return jni::autobox(value.asNumber());
+  } else if (value.isString()) {
+    return jni::make_jstring(value.asString(rt).utf8(rt));
+  } else if (value.isObject()) {
+    if (value.asObject(rt).isArray(rt)) {
+      return ReadableNativeArray::newObjectCxxArgs(
+          jsi::dynamicFromValue(rt, value));
+    }
+    return ReadableNativeMap::newObjectCxxArgs(
+        jsi::dynamicFromValue(rt, value));
+  }
+  return nullptr;
+}
+
+jni::local_ref<JNIHelper::PropsMap> JNIHelper::ConvertToPropsMap(
+    jsi::Runtime &rt,
+    const PropsBatch &batch,
+    size_t begin,
+    size_t end) {
+  auto map = PropsMap::create();
+  const auto &entries = batch.getEntries();
+  for (size_t i = begin; i < end; i++) {
+    const auto &value = batch.getValue(entries[i]);
+    if (!value.isSymbol()) {
+      map->put(batch.getPropName(entries[i]), ConvertToPropValue(rt, value));
+    }
+  }
+  return map;
+}
+
 }; // namespace reanimated
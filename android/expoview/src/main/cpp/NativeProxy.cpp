@@ -65,6 +65,11 @@ void NativeProxy::installJSIBindings() {
     this->updateProps(rt, viewTag, props);
   };
 
+  auto batchedPropUpdater = [this](
+                                jsi::Runtime &rt, const PropsBatch &batch) {
+    this->updatePropsBatch(rt, batch);
+  };
+
   auto getCurrentTime = [this]() {
     auto method =
         javaPart_->getClass()->getMethod<local_ref<JString>()>("getUpTime");
@@ -162,6 +167,7 @@ void NativeProxy::installJSIBindings() {
       measuringFunction,
       getCurrentTime,
       setGestureStateFunction,
+      batchedPropUpdater,
   };
 
   auto module = std::make_shared<NativeReanimatedModule>(
@@ -176,13 +182,13 @@ void NativeProxy::installJSIBindings() {
   _nativeReanimatedModule = module;
 
   this->registerEventHandler([module, getCurrentTime](
-                                 std::string eventName,
-                                 std::string eventAsString) {
+                                 const std::string &eventName,
+                                 const EventPayload &eventPayload) {
     jsi::Object global = module->runtime->global();
     jsi::String eventTimestampName =
         jsi::String::createFromAscii(*module->runtime, "_eventTimestamp");
     global.setProperty(*module->runtime, eventTimestampName, getCurrentTime());
-    module->onEvent(eventName, eventAsString);
+    module->onEvent(eventName, eventPayload);
     global.setProperty(
         *module->runtime, eventTimestampName, jsi::Value::undefined());
   });
@@ -217,7 +223,7 @@ void NativeProxy::requestRender(std::function<void(double)> onRender) {
 }
 
 void NativeProxy::registerEventHandler(
-    std::function<void(std::string, std::string)> handler) {
+    std::function<void(const std::string &, const EventPayload &)> handler) {
   static auto method =
       javaPart_->getClass()->getMethod<void(EventHandler::javaobject)>(
           "registerEventHandler");
@@ -237,6 +243,39 @@ void NativeProxy::updateProps(
       javaPart_.get(), viewTag, JNIHelper::ConvertToPropsMap(rt, props).get());
 }
 
+void NativeProxy::updatePropsBatch(
+    jsi::Runtime &rt,
+    const PropsBatch &batch) {
+  static auto method =
+      javaPart_->getClass()
+          ->getMethod<void(
+              JArrayInt::javaobject, JArrayClass<jobject>::javaobject)>(
+              "updatePropsBatch");
+  const auto &entries = batch.getEntries();
+
+  std::vector<jint> viewTags;
+  std::vector<size_t> viewBegins;
+  for (size_t i = 0; i < entries.size(); i++) {
+    if (i == 0 || entries[i].tag != entries[i - 1].tag) {
+      viewTags.push_back(entries[i].tag);
+      viewBegins.push_back(i);
+    }
+  }
+  viewBegins.push_back(entries.size());
+
+  auto jViewTags = JArrayInt::newArray(viewTags.size());
+  jViewTags->setRegion(0, viewTags.size(), viewTags.data());
+  auto jProps = JArrayClass<jobject>::newArray(viewTags.size());
+  for (size_t i = 0; i < viewTags.size(); i++) {
+    // Every map is released right away, so the number of local references
+    // doesn't grow with the number of views.
+    auto props = JNIHelper::ConvertToPropsMap(
+        rt, batch, viewBegins[i], viewBegins[i + 1]);
+    jProps->setElement(i, props.get());
+  }
+  method(javaPart_.get(), jViewTags.get(), jProps.get());
+}
+
 void NativeProxy::scrollTo(int viewTag, double x, double y, bool animated) {
   auto method =
       javaPart_->getClass()->getMethod<void(int, double, double, bool)>(
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <folly/dynamic.h>
+#include <jsi/jsi.h>
+
+#include "EventPayload.h"
+
+namespace reanimated {
+
+using namespace facebook;
+
+/**
+ Event payload taken straight from a WritableNativeMap. Builds the JS object
+ from folly::dynamic with cached PropNameIDs, skipping the JSON round trip.
+ */
+class DynamicEventPayload : public EventPayload {
+ public:
+  explicit DynamicEventPayload(folly::dynamic payload)
+      : payload(std::move(payload)) {}
+
+  jsi::Value toJSIValue(jsi::Runtime &rt, PropNameIDCache &propNames)
+      const override;
+
+ private:
+  folly::dynamic payload;
+};
+
+} // namespace reanimated
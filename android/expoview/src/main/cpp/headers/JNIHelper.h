@@ -8,6 +8,8 @@
 #include <react/jni/WritableNativeMap.h>
 #include <string>
 
+#include "PropsBatch.h"
+
 namespace reanimated {
 
 using namespace facebook::jni;
@@ -25,6 +27,17 @@ struct JNIHelper {
   static jni::local_ref<PropsMap> ConvertToPropsMap(
       jsi::Runtime &rt,
       const jsi::Object &props);
+
+  // Converts entries [begin, end) of the batch, which belong to one view.
+  static jni::local_ref<PropsMap> ConvertToPropsMap(
+      jsi::Runtime &rt,
+      const PropsBatch &batch,
+      size_t begin,
+      size_t end);
+
+  static jni::local_ref<JObject> ConvertToPropValue(
+      jsi::Runtime &rt,
+      const jsi::Value &value);
 };
 
 }; // namespace reanimated
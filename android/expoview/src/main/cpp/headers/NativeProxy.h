@@ -15,6 +15,7 @@
 #include <vector>
 
 #include "AndroidScheduler.h"
+#include "DynamicEventPayload.h"
 #include "JNIHelper.h"
 #include "LayoutAnimations.h"
 #include "NativeReanimatedModule.h"
@@ -50,6 +51,19 @@ class AnimationFrameCallback : public HybridClass<AnimationFrameCallback> {
   std::function<void(double)> callback_;
 };
 
+/**
+ Reads the contents of a NativeMap without consuming it. The map of an event
+ is still dispatched to JS and to EventNodes after reanimated's handler got
+ it, so it must be left intact. NativeMap only exposes its contents through
+ `consume()`, hence the pointer to its protected member.
+ */
+struct NativeMapContents : react::NativeMap {
+  static const folly::dynamic &of(react::NativeMap &nativeMap) {
+    nativeMap.throwIfConsumed();
+    return nativeMap.*(&NativeMapContents::map_);
+  }
+};
+
 class EventHandler : public HybridClass<EventHandler> {
  public:
   static auto constexpr kJavaDescriptor =
@@ -58,11 +72,21 @@ class EventHandler : public HybridClass<EventHandler> {
   void receiveEvent(
       jni::alias_ref<JString> eventKey,
       jni::alias_ref<react::WritableMap> event) {
-    std::string eventAsString = "{NativeMap:null}";
-    if (event != nullptr) {
-      eventAsString = event->toString();
+    if (event == nullptr) {
+      handler_(eventKey->toStdString(), DynamicEventPayload(nullptr));
+      return;
+    }
+    if (event->isInstanceOf(react::WritableNativeMap::javaClassStatic())) {
+      // The contents are copied instead of being serialized to JSON. The map
+      // itself is not consumed, since it is still used after this call.
+      auto nativeMap =
+          jni::static_ref_cast<react::WritableNativeMap::javaobject>(event);
+      handler_(
+          eventKey->toStdString(),
+          DynamicEventPayload(NativeMapContents::of(*nativeMap->cthis())));
+      return;
     }
-    handler_(eventKey->toString(), eventAsString);
+    handler_(eventKey->toStdString(), JSONEventPayload(event->toString()));
   }
 
   static void registerNatives() {
@@ -74,10 +98,11 @@ class EventHandler : public HybridClass<EventHandler> {
  private:
   friend HybridBase;
 
-  explicit EventHandler(std::function<void(std::string, std::string)> handler)
+  explicit EventHandler(
+      std::function<void(const std::string &, const EventPayload &)> handler)
       : handler_(std::move(handler)) {}
 
-  std::function<void(std::string, std::string)> handler_;
+  std::function<void(const std::string &, const EventPayload &)> handler_;
 };
 
 class NativeProxy : public jni::HybridClass<NativeProxy> {
@@ -106,8 +131,9 @@ class NativeProxy : public jni::HybridClass<NativeProxy> {
   bool isAnyHandlerWaitingForEvent(std::string);
   void requestRender(std::function<void(double)> onRender);
   void registerEventHandler(
-      std::function<void(std::string, std::string)> handler);
+      std::function<void(const std::string &, const EventPayload &)> handler);
   void updateProps(jsi::Runtime &rt, int viewTag, const jsi::Object &props);
+  void updatePropsBatch(jsi::Runtime &rt, const PropsBatch &batch);
   void scrollTo(int viewTag, double x, double y, bool animated);
   void setGestureState(int handlerTag, int newState);
   std::vector<std::pair<std::string, double>> measure(int viewTag);
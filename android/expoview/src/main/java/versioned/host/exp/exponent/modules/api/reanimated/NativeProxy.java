@@ -122,6 +122,14 @@ public class NativeProxy {
     mNodesManager.updateProps(viewTag, props);
   }
 
+  @DoNotStrip
+  @SuppressWarnings("unchecked")
+  private void updatePropsBatch(int[] viewTags, Object[] props) {
+    for (int i = 0; i < viewTags.length; i++) {
+      mNodesManager.updateProps(viewTags[i], (Map<String, Object>) props[i]);
+    }
+  }
+
   @DoNotStrip
   private String obtainProp(int viewTag, String propName) {
     return mNodesManager.obtainProp(viewTag, propName);
@@ -0,0 +1,86 @@
+#include <folly/dynamic.h>
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <memory>
+#include <string>
+
+#include "DynamicEventPayload.h"
+
+using namespace facebook;
+
+namespace reanimated {
+
+class DynamicEventPayloadTest : public ::testing::Test {
+ protected:
+  DynamicEventPayloadTest() : runtime(hermes::makeHermesRuntime()) {}
+
+  jsi::Object toObject(const folly::dynamic &payload) {
+    return DynamicEventPayload(payload)
+        .toJSIValue(*runtime, propNames)
+        .asObject(*runtime);
+  }
+
+  std::unique_ptr<jsi::Runtime> runtime;
+  PropNameIDCache propNames;
+};
+
+TEST_F(DynamicEventPayloadTest, convertsValues) {
+  auto object = toObject(folly::dynamic::object("int", 3)("double", 0.5)(
+      "bool", true)("string", "text")("null", nullptr)(
+      "array", folly::dynamic::array(1, "two")));
+
+  auto &rt = *runtime;
+  EXPECT_EQ(object.getProperty(rt, "int").asNumber(), 3);
+  EXPECT_EQ(object.getProperty(rt, "double").asNumber(), 0.5);
+  EXPECT_TRUE(object.getProperty(rt, "bool").getBool());
+  EXPECT_EQ(object.getProperty(rt, "string").asString(rt).utf8(rt), "text");
+  EXPECT_TRUE(object.getProperty(rt, "null").isNull());
+  auto array = object.getProperty(rt, "array").asObject(rt).asArray(rt);
+  ASSERT_EQ(array.size(rt), 2);
+  EXPECT_EQ(array.getValueAtIndex(rt, 0).asNumber(), 1);
+  EXPECT_EQ(array.getValueAtIndex(rt, 1).asString(rt).utf8(rt), "two");
+}
+
+TEST_F(DynamicEventPayloadTest, isUndefinedWithoutPayload) {
+  EXPECT_TRUE(DynamicEventPayload(nullptr)
+                  .toJSIValue(*runtime, propNames)
+                  .isUndefined());
+}
+
+// More distinct keys than the cache holds make it clear itself in the middle
+// of building the object, including while a nested object is being built
+// for a key of its parent.
+TEST_F(DynamicEventPayloadTest, keepsKeysWhenCacheIsCleared) {
+  constexpr int kKeyCount = 1500;
+  auto payload = folly::dynamic::object();
+  for (int i = 0; i < kKeyCount; i++) {
+    auto nested = folly::dynamic::object();
+    for (int j = 0; j < 3; j++) {
+      nested["nested" + std::to_string(i) + "_" + std::to_string(j)] = j;
+    }
+    payload["key" + std::to_string(i)] = std::move(nested);
+  }
+
+  // The same cache is used for two events, as it is for events in a row.
+  for (int event = 0; event < 2; event++) {
+    auto object = toObject(payload);
+    auto &rt = *runtime;
+    EXPECT_EQ(object.getPropertyNames(rt).size(rt), kKeyCount);
+    for (int i = 0; i < kKeyCount; i++) {
+      auto key = "key" + std::to_string(i);
+      auto nested = object.getProperty(rt, key.c_str());
+      ASSERT_TRUE(nested.isObject()) << key;
+      for (int j = 0; j < 3; j++) {
+        auto nestedKey =
+            "nested" + std::to_string(i) + "_" + std::to_string(j);
+        EXPECT_EQ(
+            nested.asObject(rt).getProperty(rt, nestedKey.c_str()).asNumber(),
+            j)
+            << nestedKey;
+      }
+    }
+  }
+}
+
+} // namespace reanimated
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "PropsBatch.h"
+
+using namespace facebook;
+
+namespace reanimated {
+
+class PropsBatchTest : public ::testing::Test {
+ protected:
+  PropsBatchTest() : runtime(hermes::makeHermesRuntime()) {}
+
+  jsi::Object evaluate(const std::string &source) {
+    return runtime
+        ->evaluateJavaScript(
+            std::make_shared<jsi::StringBuffer>("(" + source + ")"),
+            "test.js")
+        .asObject(*runtime);
+  }
+
+  void commit() {
+    batch.commit(*runtime, std::ref(sink));
+  }
+
+  std::unique_ptr<jsi::Runtime> runtime;
+  PropsBatch batch;
+  CountingPropsBatchSink sink;
+};
+
+TEST_F(PropsBatchTest, sendsEveryPropOncePerFlush) {
+  std::vector<PropsBatch::Entry> entries;
+  std::vector<std::string> names;
+  std::vector<double> numbers;
+  auto updater = [&](jsi::Runtime &rt, const PropsBatch &flushedBatch) {
+    entries = flushedBatch.getEntries();
+    for (const auto &entry : entries) {
+      names.push_back(flushedBatch.getPropName(entry));
+      numbers.push_back(flushedBatch.getValue(entry).asNumber());
+    }
+  };
+
+  batch.begin();
+  batch.record(*runtime, 3, evaluate("{opacity: 0, width: 10}"));
+  batch.record(*runtime, 1, evaluate("{opacity: 1}"));
+  batch.record(*runtime, 3, evaluate("{opacity: 0.5}"));
+  batch.commit(*runtime, updater);
+
+  // Entries are grouped by view, in the order props were first written.
+  ASSERT_EQ(entries.size(), 3);
+  EXPECT_EQ(entries[0].tag, 1);
+  EXPECT_EQ(entries[1].tag, 3);
+  EXPECT_EQ(entries[2].tag, 3);
+  EXPECT_EQ(names, (std::vector<std::string>{"opacity", "opacity", "width"}));
+  EXPECT_EQ(numbers, (std::vector<double>{1, 0.5, 10}));
+}
+
+TEST_F(PropsBatchTest, flushesOnlyOutermostCommit) {
+  batch.begin();
+  batch.record(*runtime, 1, evaluate("{opacity: 0}"));
+  batch.begin();
+  batch.record(*runtime, 2, evaluate("{opacity: 0}"));
+  commit();
+  EXPECT_TRUE(batch.isOpen());
+  EXPECT_EQ(sink.flushCount, 0);
+
+  commit();
+  EXPECT_FALSE(batch.isOpen());
+  EXPECT_EQ(sink.flushCount, 1);
+  EXPECT_EQ(sink.lastFlushViewCount, 2);
+  EXPECT_TRUE(batch.getEntries().empty());
+
+  // Empty batches and unbalanced commits don't flush.
+  batch.begin();
+  commit();
+  commit();
+  EXPECT_EQ(sink.flushCount, 1);
+}
+
+TEST_F(PropsBatchTest, discardDropsUpdates) {
+  batch.begin();
+  batch.begin();
+  batch.record(*runtime, 1, evaluate("{opacity: 0}"));
+  batch.discard();
+  EXPECT_FALSE(batch.isOpen());
+
+  batch.begin();
+  batch.record(*runtime, 2, evaluate("{width: 1}"));
+  commit();
+  EXPECT_EQ(sink.flushCount, 1);
+  EXPECT_EQ(sink.propCount, 1);
+  EXPECT_TRUE(batch.getEntries().empty());
+}
+
+TEST_F(PropsBatchTest, sharesPropsOfManyViews) {
+  auto values = std::vector<double>{};
+  batch.begin();
+  batch.record(*runtime, {4, 2, 6}, evaluate("{opacity: 0.25, width: 8}"));
+  batch.commit(*runtime, [&](jsi::Runtime &rt, const PropsBatch &flushed) {
+    for (const auto &entry : flushed.getEntries()) {
+      values.push_back(flushed.getValue(entry).asNumber());
+    }
+    sink(rt, flushed);
+  });
+
+  EXPECT_EQ(sink.lastFlushViewCount, 3);
+  EXPECT_EQ(sink.lastFlushPropCount, 6);
+  EXPECT_EQ(values, (std::vector<double>{0.25, 8, 0.25, 8, 0.25, 8}));
+}
+
+// Headless benchmark of the frames of a screen with 500 animated views: each
+// view gets its own transform and opacity and a mapper sets a shared style
+// for all of them. Prints the time spent recording and flushing a frame.
+TEST_F(PropsBatchTest, benchmarkFramesOf500Views) {
+  constexpr int kViewCount = 500;
+  constexpr int kFrameCount = 120;
+
+  auto tags = std::vector<int>{};
+  auto styles = std::vector<jsi::Object>{};
+  for (int tag = 0; tag < kViewCount; tag++) {
+    tags.push_back(tag);
+    styles.push_back(evaluate(
+        "{opacity: 0.5, transform: [{translateX: " + std::to_string(tag) +
+        "}]}"));
+  }
+  auto sharedStyle = evaluate("{backgroundColor: 0xff0000ff, width: 100}");
+
+  auto start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < kFrameCount; frame++) {
+    batch.begin();
+    for (int tag = 0; tag < kViewCount; tag++) {
+      batch.record(*runtime, tag, styles[tag]);
+    }
+    batch.record(*runtime, tags, sharedStyle);
+    // A second write to a prop in the same frame replaces the first one.
+    batch.record(*runtime, tags, sharedStyle);
+    commit();
+  }
+  auto duration = std::chrono::steady_clock::now() - start;
+
+  EXPECT_EQ(sink.flushCount, kFrameCount);
+  EXPECT_EQ(sink.lastFlushViewCount, kViewCount);
+  EXPECT_EQ(sink.lastFlushPropCount, kViewCount * 4);
+  EXPECT_EQ(sink.viewCount, kViewCount * kFrameCount);
+  EXPECT_EQ(sink.propCount, kViewCount * 4 * kFrameCount);
+
+  auto microsecondsPerFrame =
+      std::chrono::duration_cast<std::chrono::microseconds>(duration).count() /
+      kFrameCount;
+  RecordProperty(
+      "microsecondsPerFrame", static_cast<int>(microsecondsPerFrame));
+  std::cout << kViewCount << " views: " << microsecondsPerFrame
+            << " us per frame" << std::endl;
+}
+
+} // namespace reanimated
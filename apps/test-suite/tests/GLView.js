@@ -92,6 +92,21 @@ export async function test(
         gl.clear(gl.COLOR_BUFFER_BIT | gl.DEPTH_BUFFER_BIT);
         gl.endFrameEXP();
       });
+      it('benchmarks no-op calls', async () => {
+        const gl = await getContextAsync();
+        // Enabling a capability that is already enabled doesn't queue any GL work,
+        // so this measures the overhead of calling a GL method from JS.
+        gl.enable(gl.BLEND);
+        const calls = 50000;
+        const start = Date.now();
+        for (let i = 0; i < calls; i++) {
+          gl.enable(gl.BLEND);
+        }
+        const duration = Math.max(Date.now() - start, 1);
+        console.log(`GLView: ${Math.round((calls * 1000) / duration)} no-op calls per second`);
+        expect(gl.isEnabled(gl.BLEND)).toBe(true);
+        gl.endFrameEXP();
+      });
 
       it(`draws a texture`, async () => {
         const gl = await getContextAsync();
@@ -186,6 +201,268 @@ export async function test(
       });
     });
 
+    if (Platform.OS !== 'web') {
+      describe('readback', () => {
+        it('reads pixels asynchronously', async () => {
+          const gl = await getContextAsync();
+          gl.clearColor(1, 0, 0, 1);
+          gl.clear(gl.COLOR_BUFFER_BIT);
+
+          const pixels = new Uint8Array(2 * 2 * 4);
+          await gl.readPixelsAsyncEXP(0, 0, 2, 2, gl.RGBA, gl.UNSIGNED_BYTE, pixels);
+          expect(Array.from(pixels)).toEqual([].concat(...Array(4).fill([255, 0, 0, 255])));
+          gl.endFrameEXP();
+        });
+
+        it('pads pixel rows to PACK_ALIGNMENT', async () => {
+          const gl = await getContextAsync();
+          gl.clearColor(0, 1, 0, 1);
+          gl.clear(gl.COLOR_BUFFER_BIT);
+          gl.pixelStorei(gl.PACK_ALIGNMENT, 8);
+
+          // Rows of 1 RGBA pixel take 8 bytes, except for the last one.
+          let error = null;
+          try {
+            gl.readPixelsAsyncEXP(0, 0, 1, 2, gl.RGBA, gl.UNSIGNED_BYTE, new Uint8Array(11));
+          } catch (e) {
+            error = e;
+          }
+          expect(error).toBeTruthy();
+
+          const pixels = new Uint8Array(12);
+          await gl.readPixelsAsyncEXP(0, 0, 1, 2, gl.RGBA, gl.UNSIGNED_BYTE, pixels);
+          expect(Array.from(pixels.subarray(0, 4))).toEqual([0, 255, 0, 255]);
+          expect(Array.from(pixels.subarray(8, 12))).toEqual([0, 255, 0, 255]);
+          gl.pixelStorei(gl.PACK_ALIGNMENT, 4);
+          gl.endFrameEXP();
+        });
+
+        it('reads buffer data asynchronously', async () => {
+          const gl = await getContextAsync();
+          const buffer = gl.createBuffer();
+          gl.bindBuffer(gl.ARRAY_BUFFER, buffer);
+          gl.bufferData(gl.ARRAY_BUFFER, new Uint8Array([1, 2, 3, 4, 5, 6, 7, 8]), gl.STATIC_DRAW);
+
+          const data = new Uint8Array(6);
+          const readback = gl.getBufferSubDataAsyncEXP(gl.ARRAY_BUFFER, 2, data, 1, 4);
+          // The data is the buffer's content at the time of the call.
+          gl.bufferSubData(gl.ARRAY_BUFFER, 0, new Uint8Array(8));
+          await readback;
+          expect(Array.from(data)).toEqual([0, 3, 4, 5, 6, 0]);
+          gl.deleteBuffer(buffer);
+        });
+
+        it('rejects reads pending when the context is destroyed', async () => {
+          const gl = await getContextAsync();
+          const pixels = new Uint8Array(style.width * style.height * 4);
+          const readback = gl.readPixelsAsyncEXP(
+            0,
+            0,
+            style.width,
+            style.height,
+            gl.RGBA,
+            gl.UNSIGNED_BYTE,
+            pixels
+          );
+          await GLView.destroyContextAsync(gl);
+
+          // The read may have finished before the context got destroyed; otherwise it's rejected
+          // instead of writing to `pixels` later.
+          let error = null;
+          try {
+            await readback;
+          } catch (e) {
+            error = e;
+          }
+          if (error) {
+            expect(error.message).toMatch(/context was destroyed/);
+          }
+          expect(gl.readPixelsAsyncEXP(0, 0, 1, 1, gl.RGBA, gl.UNSIGNED_BYTE, pixels)).toBe(
+            undefined
+          );
+        });
+      });
+
+      describe('state', () => {
+        // Id of the object returned by getParameter, as each call returns a new one.
+        function getBindingId(gl, pname) {
+          const object = gl.getParameter(pname);
+          return object === null ? null : object.id;
+        }
+
+        it('returns values set by setters', async () => {
+          const gl = await getContextAsync();
+          gl.clearColor(0.25, 0.5, 0.75, 1);
+          expect(Array.from(gl.getParameter(gl.COLOR_CLEAR_VALUE))).toEqual([0.25, 0.5, 0.75, 1]);
+          gl.blendFunc(gl.SRC_ALPHA, gl.ONE_MINUS_SRC_ALPHA);
+          expect(gl.getParameter(gl.BLEND_SRC_RGB)).toBe(gl.SRC_ALPHA);
+          expect(gl.getParameter(gl.BLEND_DST_ALPHA)).toBe(gl.ONE_MINUS_SRC_ALPHA);
+          gl.depthFunc(gl.LEQUAL);
+          expect(gl.getParameter(gl.DEPTH_FUNC)).toBe(gl.LEQUAL);
+          gl.viewport(1, 2, 30, 40);
+          expect(Array.from(gl.getParameter(gl.VIEWPORT))).toEqual([1, 2, 30, 40]);
+          gl.endFrameEXP();
+        });
+
+        it('clamps values to [0, 1]', async () => {
+          const gl = await getContextAsync();
+          gl.clearColor(2, -1, 0.5, 1);
+          expect(Array.from(gl.getParameter(gl.COLOR_CLEAR_VALUE))).toEqual([1, 0, 0.5, 1]);
+          gl.blendColor(-0.5, 0.25, 3, 1);
+          expect(Array.from(gl.getParameter(gl.BLEND_COLOR))).toEqual([0, 0.25, 1, 1]);
+          gl.depthRange(-1, 2);
+          expect(Array.from(gl.getParameter(gl.DEPTH_RANGE))).toEqual([0, 1]);
+          gl.sampleCoverage(1.5, false);
+          expect(gl.getParameter(gl.SAMPLE_COVERAGE_VALUE)).toBe(1);
+
+          // Setting the clamped value again is skipped, and still returns it.
+          gl.clearColor(1, 0, 0.5, 1);
+          expect(Array.from(gl.getParameter(gl.COLOR_CLEAR_VALUE))).toEqual([1, 0, 0.5, 1]);
+          gl.endFrameEXP();
+        });
+
+        it('ignores values that GL rejects', async () => {
+          const gl = await getContextAsync();
+          gl.getError();
+
+          gl.blendFunc(gl.SRC_ALPHA, gl.ONE_MINUS_SRC_ALPHA);
+          gl.blendFunc(gl.ONE, 0x1234);
+          expect(gl.getError()).toBe(gl.INVALID_ENUM);
+          expect(gl.getParameter(gl.BLEND_SRC_RGB)).toBe(gl.SRC_ALPHA);
+          expect(gl.getParameter(gl.BLEND_DST_RGB)).toBe(gl.ONE_MINUS_SRC_ALPHA);
+
+          gl.depthFunc(0x1234);
+          expect(gl.getError()).toBe(gl.INVALID_ENUM);
+          expect(gl.getParameter(gl.DEPTH_FUNC)).toBe(gl.LESS);
+
+          gl.pixelStorei(gl.PACK_ALIGNMENT, 3);
+          expect(gl.getError()).toBe(gl.INVALID_VALUE);
+          expect(gl.getParameter(gl.PACK_ALIGNMENT)).toBe(4);
+
+          const texture = gl.createTexture();
+          gl.bindTexture(gl.TEXTURE_2D, texture);
+          gl.bindTexture(gl.TEXTURE_CUBE_MAP, texture);
+          expect(gl.getError()).toBe(gl.INVALID_OPERATION);
+          expect(getBindingId(gl, gl.TEXTURE_BINDING_2D)).toBe(texture.id);
+          expect(getBindingId(gl, gl.TEXTURE_BINDING_CUBE_MAP)).toBe(null);
+          gl.deleteTexture(texture);
+        });
+
+        it('keeps the current program if another one failed to link', async () => {
+          const gl = await getContextAsync();
+          const vert = gl.createShader(gl.VERTEX_SHADER);
+          gl.shaderSource(vert, vertexShader);
+          gl.compileShader(vert);
+          const frag = gl.createShader(gl.FRAGMENT_SHADER);
+          gl.shaderSource(frag, fragShader);
+          gl.compileShader(frag);
+          const program = gl.createProgram();
+          gl.attachShader(program, vert);
+          gl.attachShader(program, frag);
+          gl.linkProgram(program);
+          gl.useProgram(program);
+
+          // Without shaders
+          const brokenProgram = gl.createProgram();
+          gl.linkProgram(brokenProgram);
+          gl.getError();
+          gl.useProgram(brokenProgram);
+          expect(gl.getError()).toBe(gl.INVALID_OPERATION);
+          expect(getBindingId(gl, gl.CURRENT_PROGRAM)).toBe(program.id);
+          expect(gl.getProgramParameter(brokenProgram, gl.LINK_STATUS)).toBe(false);
+          expect(getBindingId(gl, gl.CURRENT_PROGRAM)).toBe(program.id);
+
+          gl.useProgram(null);
+          gl.deleteProgram(program);
+          gl.deleteProgram(brokenProgram);
+          gl.deleteShader(vert);
+          gl.deleteShader(frag);
+        });
+
+        it('unbinds deleted objects', async () => {
+          const gl = await getContextAsync();
+          const buffer = gl.createBuffer();
+          gl.bindBuffer(gl.ARRAY_BUFFER, buffer);
+          expect(getBindingId(gl, gl.ARRAY_BUFFER_BINDING)).toBe(buffer.id);
+          gl.deleteBuffer(buffer);
+          expect(getBindingId(gl, gl.ARRAY_BUFFER_BINDING)).toBe(null);
+
+          const texture = gl.createTexture();
+          gl.bindTexture(gl.TEXTURE_2D, texture);
+          gl.deleteTexture(texture);
+          expect(getBindingId(gl, gl.TEXTURE_BINDING_2D)).toBe(null);
+
+          const renderbuffer = gl.createRenderbuffer();
+          gl.bindRenderbuffer(gl.RENDERBUFFER, renderbuffer);
+          gl.deleteRenderbuffer(renderbuffer);
+          expect(getBindingId(gl, gl.RENDERBUFFER_BINDING)).toBe(null);
+        });
+
+        it('falls back to the default framebuffer when the bound one is deleted', async () => {
+          const gl = await getContextAsync();
+          gl.clearColor(0, 0, 1, 1);
+          const framebuffer = gl.createFramebuffer();
+          gl.bindFramebuffer(gl.FRAMEBUFFER, framebuffer);
+          expect(getBindingId(gl, gl.FRAMEBUFFER_BINDING)).toBe(framebuffer.id);
+          gl.deleteFramebuffer(framebuffer);
+          expect(getBindingId(gl, gl.FRAMEBUFFER_BINDING)).toBe(null);
+          expect(getBindingId(gl, gl.READ_FRAMEBUFFER_BINDING)).toBe(null);
+
+          // Draws to the default framebuffer.
+          gl.clear(gl.COLOR_BUFFER_BIT);
+          const pixel = new Uint8Array(4);
+          gl.readPixels(0, 0, 1, 1, gl.RGBA, gl.UNSIGNED_BYTE, pixel);
+          expect(Array.from(pixel)).toEqual([0, 0, 255, 255]);
+          gl.endFrameEXP();
+        });
+
+        it('switches the element array binding with the vertex array', async () => {
+          const gl = await getContextAsync();
+          const vertexArray = gl.createVertexArray();
+          const buffer = gl.createBuffer();
+          gl.bindVertexArray(vertexArray);
+          gl.bindBuffer(gl.ELEMENT_ARRAY_BUFFER, buffer);
+          expect(getBindingId(gl, gl.ELEMENT_ARRAY_BUFFER_BINDING)).toBe(buffer.id);
+
+          gl.bindVertexArray(null);
+          expect(getBindingId(gl, gl.ELEMENT_ARRAY_BUFFER_BINDING)).toBe(null);
+          gl.bindVertexArray(vertexArray);
+          expect(getBindingId(gl, gl.ELEMENT_ARRAY_BUFFER_BINDING)).toBe(buffer.id);
+
+          // Deleting the bound vertex array binds the default one.
+          gl.deleteVertexArray(vertexArray);
+          expect(getBindingId(gl, gl.VERTEX_ARRAY_BINDING)).toBe(null);
+          expect(getBindingId(gl, gl.ELEMENT_ARRAY_BUFFER_BINDING)).toBe(null);
+          gl.deleteBuffer(buffer);
+        });
+
+        it('looks up locations again after linking', async () => {
+          const gl = await getContextAsync();
+          const vert = gl.createShader(gl.VERTEX_SHADER);
+          gl.shaderSource(vert, vertexShader);
+          gl.compileShader(vert);
+          const frag = gl.createShader(gl.FRAGMENT_SHADER);
+          gl.shaderSource(frag, fragShader);
+          gl.compileShader(frag);
+          const program = gl.createProgram();
+          gl.attachShader(program, vert);
+          gl.attachShader(program, frag);
+          gl.bindAttribLocation(program, 3, 'position');
+          gl.linkProgram(program);
+          expect(gl.getAttribLocation(program, 'position')).toBe(3);
+
+          gl.bindAttribLocation(program, 5, 'position');
+          gl.linkProgram(program);
+          expect(gl.getAttribLocation(program, 'position')).toBe(5);
+          expect(gl.getUniformLocation(program, 'texture')).not.toBe(null);
+
+          gl.deleteProgram(program);
+          gl.deleteShader(vert);
+          gl.deleteShader(frag);
+        });
+      });
+    }
+
     describe('static', () => {
       it('creates a static context', async () => {
         const context = await GLView.createContextAsync();
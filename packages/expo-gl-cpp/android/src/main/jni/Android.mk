@@ -11,6 +11,8 @@ LOCAL_SRC_FILES := \
   ../../../../cpp/EXGLImageUtils.cpp \
   ../../../../cpp/EXGLContext.cpp \
   ../../../../cpp/EXGLContextManager.cpp \
+  ../../../../cpp/EXGLReadbackQueue.cpp \
+  ../../../../cpp/EXGLStateShadow.cpp \
   ../../../../cpp/EXWebGLMethods.cpp \
   ../../../../cpp/EXWebGLRenderer.cpp \
   ../../../../cpp/TypedArrayApi.cpp \
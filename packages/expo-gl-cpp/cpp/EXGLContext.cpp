@@ -10,6 +10,7 @@ void EXGLContext::prepareContext(jsi::Runtime &runtime, std::function<void(void)
   this->flushOnGLThread = flushMethod;
   try {
     auto viewport = prepareOpenGLESContext();
+    shadow.reset(viewport.viewportWidth, viewport.viewportHeight);
     createWebGLRenderer(runtime, this, viewport, runtime.global());
     tryRegisterOnJSRuntimeDestroy(runtime);
 
@@ -76,6 +77,7 @@ void EXGLContext::flush(void) {
       op();
     }
   }
+  readbacks.poll();
 }
 
 UEXGLObjectId EXGLContext::createObject(void) noexcept {
@@ -95,6 +97,22 @@ GLuint EXGLContext::lookupObject(UEXGLObjectId exglObjId) noexcept {
   return iter == objects.end() ? 0 : iter->second;
 }
 
+GLsync EXGLContext::lookupSync(UEXGLObjectId exglObjId) noexcept {
+  auto iter = syncs.find(exglObjId);
+  return iter == syncs.end() ? nullptr : iter->second;
+}
+
+EXGLStateShadow &EXGLContext::stateShadow() noexcept {
+  if (shadowInvalidated.exchange(false)) {
+    shadow.clear();
+  }
+  return shadow;
+}
+
+void EXGLContext::invalidateStateShadow() noexcept {
+  shadowInvalidated = true;
+}
+
 void EXGLContext::tryRegisterOnJSRuntimeDestroy(jsi::Runtime &runtime) {
   auto global = runtime.global();
 
@@ -23,6 +23,8 @@
 
 #include <jsi/jsi.h>
 
+#include "EXGLReadbackQueue.h"
+#include "EXGLStateShadow.h"
 #include "EXJsiUtils.h"
 #include "EXPlatformUtils.h"
 #include "EXWebGLRenderer.h"
@@ -104,6 +106,15 @@ class EXGLContext {
   void destroyObject(UEXGLObjectId exglObjId) noexcept;
   void mapObject(UEXGLObjectId exglObjId, GLuint glObj) noexcept;
   GLuint lookupObject(UEXGLObjectId exglObjId) noexcept;
+  GLsync lookupSync(UEXGLObjectId exglObjId) noexcept;
+
+  // --- State shadow ----------------------------------------------------------
+
+  // [JS thread] GL state as set by the queued methods, see EXGLStateShadow.
+  EXGLStateShadow &stateShadow() noexcept;
+  // [Any thread] Forget the shadowed state, e.g. after the platform changed the GL
+  // state that JS can observe. Takes effect on the next use of the shadow.
+  void invalidateStateShadow() noexcept;
 
   void tryRegisterOnJSRuntimeDestroy(jsi::Runtime &runtime);
   initGlesContext prepareOpenGLESContext();
@@ -115,12 +126,21 @@ class EXGLContext {
   std::vector<Batch> backlog;
   std::mutex backlogMutex;
 
+  // State shadow
+  EXGLStateShadow shadow;
+  std::atomic_bool shadowInvalidated = false;
+
  public:
   UEXGLContextId ctxId;
 
   // Object mapping
   std::unordered_map<UEXGLObjectId, GLuint> objects;
   std::atomic_uint nextObjectId = 1;
+  // [GL thread] WebGLSync objects, which are not GLuint names
+  std::unordered_map<UEXGLObjectId, GLsync> syncs;
+
+  // [GL thread] Readbacks waiting for the GPU, polled at the end of each flush
+  EXGLReadbackQueue readbacks;
 
   bool supportsWebGL2 = false;
   std::set<const std::string> supportedExtensions;
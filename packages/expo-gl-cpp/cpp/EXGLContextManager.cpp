@@ -1,29 +1,84 @@
 #include "EXGLContextManager.h"
 
+#include <condition_variable>
+
 namespace expo {
 namespace gl_cpp {
 
-struct ContextState {
-  EXGLContext *ctx;
-  std::shared_mutex mutex;
+struct EXGLContextState {
+  // null once destroy is in progress
+  std::atomic<EXGLContext *> ctx = nullptr;
+  // Number of held EXGLContextUses
+  std::atomic_uint uses = 0;
+  // Notified when the last use is released during destroy
+  std::mutex releasedMutex;
+  std::condition_variable released;
 };
 
 struct ContextManager {
-  std::unordered_map<UEXGLContextId, ContextState> contextMap;
+  std::unordered_map<UEXGLContextId, EXGLContextRef> contextMap;
   std::mutex contextLookupMutex;
   UEXGLContextId nextId = 1;
 };
 
 ContextManager manager;
 
+static void releaseUse(EXGLContextState &state) {
+  // Same as in EXGLContextGet: either this sees that destroy is in progress, or destroy sees
+  // that there are no uses left before it starts waiting.
+  if (--state.uses == 0 && state.ctx == nullptr) {
+    // Notifying under the lock makes sure that destroy is either waiting already, or checks
+    // `uses` after this.
+    std::lock_guard lock(state.releasedMutex);
+    state.released.notify_all();
+  }
+}
+
+EXGLContextUse &EXGLContextUse::operator=(EXGLContextUse &&other) noexcept {
+  if (this != &other) {
+    if (state) {
+      releaseUse(*state);
+    }
+    state = std::move(other.state);
+  }
+  return *this;
+}
+
+EXGLContextUse::~EXGLContextUse() {
+  if (state) {
+    releaseUse(*state);
+  }
+}
+
 EXGLContextWithLock EXGLContextGet(UEXGLContextId id) {
   std::lock_guard lock(manager.contextLookupMutex);
   auto iter = manager.contextMap.find(id);
-  // if ctx is null then destroy is in progress
-  if (iter == manager.contextMap.end() || iter->second.ctx == nullptr) {
-    return {nullptr, std::shared_lock<std::shared_mutex>()};
+  if (iter == manager.contextMap.end()) {
+    return {nullptr, EXGLContextUse()};
+  }
+  return EXGLContextGet(iter->second);
+}
+
+EXGLContextRef EXGLContextGetRef(UEXGLContextId id) {
+  std::lock_guard lock(manager.contextLookupMutex);
+  auto iter = manager.contextMap.find(id);
+  return iter == manager.contextMap.end() ? nullptr : iter->second;
+}
+
+EXGLContextWithLock EXGLContextGet(const EXGLContextRef &ref) {
+  // Both this and EXGLContextDestroy write one of `uses` and `ctx`, and then read the other
+  // one (sequentially consistent), so either destroy sees this use, or this sees that the
+  // context is being destroyed.
+  if (!ref) {
+    return {nullptr, EXGLContextUse()};
   }
-  return {iter->second.ctx, std::shared_lock(iter->second.mutex)};
+  ref->uses++;
+  EXGLContext *ctx = ref->ctx;
+  if (ctx == nullptr) {
+    releaseUse(*ref);
+    return {nullptr, EXGLContextUse()};
+  }
+  return {ctx, EXGLContextUse(ref)};
 }
 
 UEXGLContextId EXGLContextCreate() {
@@ -39,21 +94,32 @@ UEXGLContextId EXGLContextCreate() {
     EXGLSysLog("Tried to reuse an EXGLContext id. This shouldn't really happen...");
     return 0;
   }
-  manager.contextMap[ctxId].ctx = new EXGLContext(ctxId);
+  auto state = std::make_shared<EXGLContextState>();
+  state->ctx = new EXGLContext(ctxId);
+  manager.contextMap[ctxId] = std::move(state);
   return ctxId;
 }
 
 void EXGLContextDestroy(UEXGLContextId id) {
-  std::lock_guard lock(manager.contextLookupMutex);
-
-  auto iter = manager.contextMap.find(id);
-  if (iter != manager.contextMap.end()) {
-    {
-      std::unique_lock lock(iter->second.mutex);
-      delete iter->second.ctx;
+  EXGLContextRef state;
+  {
+    std::lock_guard lock(manager.contextLookupMutex);
+    auto iter = manager.contextMap.find(id);
+    if (iter == manager.contextMap.end()) {
+      return;
     }
+    state = std::move(iter->second);
     manager.contextMap.erase(iter);
   }
+
+  EXGLContext *ctx = state->ctx.exchange(nullptr);
+  // Uses can take a while (e.g. methods waiting for the GL thread), so block until the last
+  // one is released instead of spinning.
+  {
+    std::unique_lock lock(state->releasedMutex);
+    state->released.wait(lock, [&] { return state->uses == 0; });
+  }
+  delete ctx;
 }
 
 } // namespace gl_cpp
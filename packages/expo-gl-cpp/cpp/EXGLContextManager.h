@@ -1,16 +1,58 @@
 #pragma once
 
-#include <shared_mutex>
+#include <atomic>
+#include <memory>
 #include "EXGLContext.h"
 
 namespace expo {
 namespace gl_cpp {
 
-using EXGLContextWithLock = std::pair<EXGLContext *, std::shared_lock<std::shared_mutex>>;
+struct EXGLContextState;
+
+// Refcounted reference to a context's entry in the manager. It can be resolved to the context
+// without the global lookup, so it's resolved once and cached where contexts are used often
+// (e.g. on JS WebGL context objects, see EXGLContextHandle).
+using EXGLContextRef = std::shared_ptr<EXGLContextState>;
+
+// Keeps the context from being destroyed while it's held, like a shared lock. Taking and
+// releasing it doesn't lock anything, unless it's the last use released while
+// EXGLContextDestroy is waiting for it.
+class EXGLContextUse {
+ public:
+  EXGLContextUse() = default;
+  explicit EXGLContextUse(EXGLContextRef state) : state(std::move(state)) {}
+  EXGLContextUse(EXGLContextUse &&other) noexcept = default;
+  EXGLContextUse &operator=(EXGLContextUse &&other) noexcept;
+  EXGLContextUse(const EXGLContextUse &) = delete;
+  EXGLContextUse &operator=(const EXGLContextUse &) = delete;
+  ~EXGLContextUse();
+
+ private:
+  // EXGLContextDestroy can return (and drop the manager's ref) as soon as the last use is
+  // released, so the use keeps the state alive itself until it's done releasing.
+  EXGLContextRef state;
+};
+
+using EXGLContextWithLock = std::pair<EXGLContext *, EXGLContextUse>;
 
 UEXGLContextId EXGLContextCreate();
 EXGLContextWithLock EXGLContextGet(UEXGLContextId id);
+// Returns null if there is no such context.
+EXGLContextRef EXGLContextGetRef(UEXGLContextId id);
+// Lock-free; the context is null if it's destroyed (or if the ref is null).
+EXGLContextWithLock EXGLContextGet(const EXGLContextRef &ref);
 void EXGLContextDestroy(UEXGLContextId id);
 
+// Caches a context's ref on a JS WebGL context object (in the property below), so methods
+// called on it don't need to look the context up by id.
+constexpr const char *EXGLContextHandlePropertyName = "__EXGLContextHandle";
+
+class EXGLContextHandle : public jsi::HostObject {
+ public:
+  EXGLContextHandle(EXGLContextRef ref) : ref(std::move(ref)) {}
+
+  const EXGLContextRef ref;
+};
+
 } // namespace gl_cpp
 } // namespace expo
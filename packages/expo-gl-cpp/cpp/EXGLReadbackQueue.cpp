@@ -0,0 +1,93 @@
+#include "EXGLReadbackQueue.h"
+
+#include <utility>
+
+namespace expo {
+namespace gl_cpp {
+
+GLuint EXGLReadbackQueue::acquireBuffer(GLsizeiptr size) {
+  GLuint buffer = 0;
+  if (!freeBuffers.empty()) {
+    // Prefer a buffer that is already big enough, otherwise grow the most recently freed one.
+    auto it = freeBuffers.end() - 1;
+    for (auto candidate = freeBuffers.begin(); candidate != freeBuffers.end(); candidate++) {
+      if (bufferSizes[*candidate] >= size) {
+        it = candidate;
+        break;
+      }
+    }
+    buffer = *it;
+    freeBuffers.erase(it);
+  } else {
+    glGenBuffers(1, &buffer);
+    bufferSizes[buffer] = 0;
+  }
+  glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer);
+  if (bufferSizes[buffer] < size) {
+    glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+    bufferSizes[buffer] = size;
+  }
+  return buffer;
+}
+
+void EXGLReadbackQueue::add(
+    GLuint buffer,
+    GLsizeiptr length,
+    ResultRef result) {
+  GLsync sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  if (sync == nullptr) {
+    result->status = EXGLReadbackStatus::Failed;
+    releaseBuffer(buffer);
+    return;
+  }
+  pending.push_back({sync, buffer, length, std::move(result)});
+}
+
+void EXGLReadbackQueue::poll() {
+  // Fences signal in order, so there is no point in checking the ones after an unsignaled one.
+  size_t finished = 0;
+  for (; finished < pending.size(); finished++) {
+    auto &readback = pending[finished];
+    GLenum result = glClientWaitSync(readback.sync, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    if (result == GL_TIMEOUT_EXPIRED) {
+      break;
+    }
+    glDeleteSync(readback.sync);
+    bool succeeded = result != GL_WAIT_FAILED && copy(readback);
+    // The data is only read by the JS thread after it sees this store.
+    readback.result->status = succeeded ? EXGLReadbackStatus::Done : EXGLReadbackStatus::Failed;
+    releaseBuffer(readback.buffer);
+  }
+  pending.erase(pending.begin(), pending.begin() + finished);
+}
+
+bool EXGLReadbackQueue::copy(const Readback &readback) {
+  if (readback.length == 0) {
+    return true;
+  }
+  // GL_COPY_READ_BUFFER can be bound by JS, so restore it.
+  GLint previousBuffer = 0;
+  glGetIntegerv(GL_COPY_READ_BUFFER_BINDING, &previousBuffer);
+  glBindBuffer(GL_COPY_READ_BUFFER, readback.buffer);
+  void *data =
+      glMapBufferRange(GL_COPY_READ_BUFFER, 0, readback.length, GL_MAP_READ_BIT);
+  if (data != nullptr) {
+    readback.result->data.assign(
+        static_cast<uint8_t *>(data), static_cast<uint8_t *>(data) + readback.length);
+    glUnmapBuffer(GL_COPY_READ_BUFFER);
+  }
+  glBindBuffer(GL_COPY_READ_BUFFER, previousBuffer);
+  return data != nullptr;
+}
+
+void EXGLReadbackQueue::releaseBuffer(GLuint buffer) {
+  if (freeBuffers.size() >= kMaxPooledBuffers) {
+    glDeleteBuffers(1, &buffer);
+    bufferSizes.erase(buffer);
+    return;
+  }
+  freeBuffers.push_back(buffer);
+}
+
+} // namespace gl_cpp
+} // namespace expo
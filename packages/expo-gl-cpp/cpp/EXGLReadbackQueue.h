@@ -0,0 +1,76 @@
+#pragma once
+
+#ifdef __ANDROID__
+#include <GLES3/gl3.h>
+#include <GLES3/gl3ext.h>
+#endif
+#ifdef __APPLE__
+#include <OpenGLES/ES3/gl.h>
+#endif
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace expo {
+namespace gl_cpp {
+
+enum class EXGLReadbackStatus {
+  Pending,
+  Done,
+  Failed,
+};
+
+// [GL thread] Copies data written by the GPU to buffers (e.g. by glReadPixels to a pixel pack
+// buffer) to native memory, once fences inserted after the writes signal.
+//
+// Nothing waits for the GPU: pending readbacks are checked at the end of each flush. The data
+// isn't copied to memory owned by JS here, since the runtime can be torn down while readbacks
+// are pending; the JS thread copies it from the result once the status is Done.
+//
+// The buffers come from a small pool, so they are reused across frames instead of being
+// allocated for each read. Reads of buffers owned by JS copy the data to a pooled buffer
+// first, so later changes to them don't affect pending reads.
+class EXGLReadbackQueue {
+ public:
+  struct Result {
+    std::atomic<EXGLReadbackStatus> status{EXGLReadbackStatus::Pending};
+    // Only valid once the status is Done.
+    std::vector<uint8_t> data;
+  };
+  using ResultRef = std::shared_ptr<Result>;
+
+  // Returns a pooled buffer of at least `size` bytes, bound to GL_PIXEL_PACK_BUFFER.
+  GLuint acquireBuffer(GLsizeiptr size);
+
+  // Inserts a fence after the commands writing to `buffer` (acquired with acquireBuffer).
+  // Once it signals, the first `length` bytes of the buffer are copied to the data of `result`,
+  // its status is updated and the buffer is returned to the pool.
+  void add(GLuint buffer, GLsizeiptr length, ResultRef result);
+
+  // Finishes readbacks whose fences have signaled.
+  void poll();
+
+ private:
+  struct Readback {
+    GLsync sync;
+    GLuint buffer;
+    GLsizeiptr length;
+    ResultRef result;
+  };
+
+  static constexpr size_t kMaxPooledBuffers = 4;
+
+  bool copy(const Readback &readback);
+  void releaseBuffer(GLuint buffer);
+
+  std::vector<Readback> pending;
+  std::vector<GLuint> freeBuffers;
+  // Sizes of all pooled buffers, free or not.
+  std::unordered_map<GLuint, GLsizeiptr> bufferSizes;
+};
+
+} // namespace gl_cpp
+} // namespace expo
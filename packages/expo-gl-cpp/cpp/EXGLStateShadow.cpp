@@ -0,0 +1,677 @@
+#include "EXGLStateShadow.h"
+
+#include <algorithm>
+
+namespace expo {
+namespace gl_cpp {
+
+GLenum EXGLStateShadow::bufferBindingPname(GLenum target) {
+  switch (target) {
+    case GL_ARRAY_BUFFER:
+      return GL_ARRAY_BUFFER_BINDING;
+    case GL_ELEMENT_ARRAY_BUFFER:
+      return GL_ELEMENT_ARRAY_BUFFER_BINDING;
+    case GL_COPY_READ_BUFFER:
+      return GL_COPY_READ_BUFFER_BINDING;
+    case GL_COPY_WRITE_BUFFER:
+      return GL_COPY_WRITE_BUFFER_BINDING;
+    case GL_PIXEL_PACK_BUFFER:
+      return GL_PIXEL_PACK_BUFFER_BINDING;
+    case GL_PIXEL_UNPACK_BUFFER:
+      return GL_PIXEL_UNPACK_BUFFER_BINDING;
+    case GL_TRANSFORM_FEEDBACK_BUFFER:
+      return GL_TRANSFORM_FEEDBACK_BUFFER_BINDING;
+    case GL_UNIFORM_BUFFER:
+      return GL_UNIFORM_BUFFER_BINDING;
+    default:
+      return 0;
+  }
+}
+
+static GLenum textureBindingTarget(GLenum pname) {
+  switch (pname) {
+    case GL_TEXTURE_BINDING_2D:
+      return GL_TEXTURE_2D;
+    case GL_TEXTURE_BINDING_3D:
+      return GL_TEXTURE_3D;
+    case GL_TEXTURE_BINDING_2D_ARRAY:
+      return GL_TEXTURE_2D_ARRAY;
+    case GL_TEXTURE_BINDING_CUBE_MAP:
+      return GL_TEXTURE_CUBE_MAP;
+    default:
+      return 0;
+  }
+}
+
+static bool isTextureTarget(GLenum target) {
+  switch (target) {
+    case GL_TEXTURE_2D:
+    case GL_TEXTURE_3D:
+    case GL_TEXTURE_2D_ARRAY:
+    case GL_TEXTURE_CUBE_MAP:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static bool isBlendEquation(GLenum mode) {
+  switch (mode) {
+    case GL_FUNC_ADD:
+    case GL_FUNC_SUBTRACT:
+    case GL_FUNC_REVERSE_SUBTRACT:
+    case GL_MIN:
+    case GL_MAX:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static bool isBlendFactor(GLenum factor) {
+  switch (factor) {
+    case GL_ZERO:
+    case GL_ONE:
+    case GL_SRC_COLOR:
+    case GL_ONE_MINUS_SRC_COLOR:
+    case GL_DST_COLOR:
+    case GL_ONE_MINUS_DST_COLOR:
+    case GL_SRC_ALPHA:
+    case GL_ONE_MINUS_SRC_ALPHA:
+    case GL_DST_ALPHA:
+    case GL_ONE_MINUS_DST_ALPHA:
+    case GL_CONSTANT_COLOR:
+    case GL_ONE_MINUS_CONSTANT_COLOR:
+    case GL_CONSTANT_ALPHA:
+    case GL_ONE_MINUS_CONSTANT_ALPHA:
+    case GL_SRC_ALPHA_SATURATE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static bool isCompareFunc(GLenum func) {
+  switch (func) {
+    case GL_NEVER:
+    case GL_LESS:
+    case GL_EQUAL:
+    case GL_LEQUAL:
+    case GL_GREATER:
+    case GL_NOTEQUAL:
+    case GL_GEQUAL:
+    case GL_ALWAYS:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static bool isStencilOp(GLenum op) {
+  switch (op) {
+    case GL_KEEP:
+    case GL_ZERO:
+    case GL_REPLACE:
+    case GL_INCR:
+    case GL_INCR_WRAP:
+    case GL_DECR:
+    case GL_DECR_WRAP:
+    case GL_INVERT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static const GLenum bufferBindingPnames[] = {
+    GL_ARRAY_BUFFER_BINDING,
+    GL_ELEMENT_ARRAY_BUFFER_BINDING,
+    GL_COPY_READ_BUFFER_BINDING,
+    GL_COPY_WRITE_BUFFER_BINDING,
+    GL_PIXEL_PACK_BUFFER_BINDING,
+    GL_PIXEL_UNPACK_BUFFER_BINDING,
+    GL_TRANSFORM_FEEDBACK_BUFFER_BINDING,
+    GL_UNIFORM_BUFFER_BINDING,
+};
+
+void EXGLStateShadow::reset(GLint viewportWidth, GLint viewportHeight) {
+  clear();
+
+  // Initial values from the OpenGL ES 3.0 spec, tables 6.x
+  for (GLenum cap :
+       {GL_BLEND,
+        GL_CULL_FACE,
+        GL_DEPTH_TEST,
+        GL_POLYGON_OFFSET_FILL,
+        GL_PRIMITIVE_RESTART_FIXED_INDEX,
+        GL_RASTERIZER_DISCARD,
+        GL_SAMPLE_ALPHA_TO_COVERAGE,
+        GL_SAMPLE_COVERAGE,
+        GL_SCISSOR_TEST,
+        GL_STENCIL_TEST}) {
+    setEnabled(cap, false);
+  }
+  setEnabled(GL_DITHER, true);
+
+  setParameter(GL_BLEND_COLOR, {0, 0, 0, 0});
+  setParameter(GL_BLEND_EQUATION_RGB, {GL_FUNC_ADD});
+  setParameter(GL_BLEND_EQUATION_ALPHA, {GL_FUNC_ADD});
+  setParameter(GL_BLEND_SRC_RGB, {GL_ONE});
+  setParameter(GL_BLEND_SRC_ALPHA, {GL_ONE});
+  setParameter(GL_BLEND_DST_RGB, {GL_ZERO});
+  setParameter(GL_BLEND_DST_ALPHA, {GL_ZERO});
+  setParameter(GL_COLOR_WRITEMASK, {1, 1, 1, 1});
+  setParameter(GL_CULL_FACE_MODE, {GL_BACK});
+  setParameter(GL_DEPTH_FUNC, {GL_LESS});
+  setParameter(GL_DEPTH_RANGE, {0, 1});
+  setParameter(GL_DEPTH_WRITEMASK, {1});
+  setParameter(GL_FRONT_FACE, {GL_CCW});
+  setParameter(GL_LINE_WIDTH, {1});
+  setParameter(GL_POLYGON_OFFSET_FACTOR, {0});
+  setParameter(GL_POLYGON_OFFSET_UNITS, {0});
+  setParameter(GL_SAMPLE_COVERAGE_VALUE, {1});
+  setParameter(GL_SAMPLE_COVERAGE_INVERT, {0});
+  setParameter(GL_STENCIL_FUNC, {GL_ALWAYS});
+  setParameter(GL_STENCIL_REF, {0});
+  setParameter(GL_STENCIL_FAIL, {GL_KEEP});
+  setParameter(GL_STENCIL_PASS_DEPTH_FAIL, {GL_KEEP});
+  setParameter(GL_STENCIL_PASS_DEPTH_PASS, {GL_KEEP});
+  setParameter(GL_STENCIL_BACK_FUNC, {GL_ALWAYS});
+  setParameter(GL_STENCIL_BACK_REF, {0});
+  setParameter(GL_STENCIL_BACK_FAIL, {GL_KEEP});
+  setParameter(GL_STENCIL_BACK_PASS_DEPTH_FAIL, {GL_KEEP});
+  setParameter(GL_STENCIL_BACK_PASS_DEPTH_PASS, {GL_KEEP});
+  setParameter(GL_ACTIVE_TEXTURE, {GL_TEXTURE0});
+  setParameter(GL_PACK_ALIGNMENT, {4});
+  setParameter(GL_UNPACK_ALIGNMENT, {4});
+  setParameter(GL_GENERATE_MIPMAP_HINT, {GL_DONT_CARE});
+  // Stencil masks are all ones in the bit depth of the stencil buffer and the scissor
+  // box is the size of the surface when it was first made current, so these are left
+  // to be queried.
+
+  // Set by prepareOpenGLESContext
+  setParameter(GL_COLOR_CLEAR_VALUE, {0, 0, 0, 0});
+  setParameter(GL_DEPTH_CLEAR_VALUE, {1});
+  setParameter(GL_STENCIL_CLEAR_VALUE, {0});
+  setParameter(
+      GL_VIEWPORT,
+      {0, 0, static_cast<double>(viewportWidth), static_cast<double>(viewportHeight)});
+
+  for (GLenum pname : bufferBindingPnames) {
+    bindings[pname] = 0;
+  }
+  bindings[GL_DRAW_FRAMEBUFFER_BINDING] = 0;
+  bindings[GL_READ_FRAMEBUFFER_BINDING] = 0;
+  bindings[GL_RENDERBUFFER_BINDING] = 0;
+  bindings[GL_VERTEX_ARRAY_BINDING] = 0;
+  bindings[GL_CURRENT_PROGRAM] = 0;
+  allTexturesUnbound = true;
+}
+
+void EXGLStateShadow::clear() {
+  parameters.clear();
+  bindings.clear();
+  textureBindings.clear();
+  uniformLocations.clear();
+  attribLocations.clear();
+  textureTargets.clear();
+  linkedPrograms.clear();
+  allTexturesUnbound = false;
+  isCurrentProgramUnverified = false;
+}
+
+bool EXGLStateShadow::setParameter(GLenum pname, std::initializer_list<double> values) {
+  if (!isValid(pname, values)) {
+    return true;
+  }
+  Parameter value = {};
+  value.count = values.size();
+  std::copy(values.begin(), values.end(), value.values.begin());
+  if (isClampedToUnitRange(pname)) {
+    for (size_t i = 0; i < value.count; i++) {
+      value.values[i] = std::min(std::max(value.values[i], 0.0), 1.0);
+    }
+  }
+
+  auto &parameter = parameters[pname];
+  bool changed = parameter.count != value.count ||
+      !std::equal(
+          value.values.begin(), value.values.begin() + value.count, parameter.values.begin());
+  if (changed) {
+    parameter = value;
+  }
+  return changed;
+}
+
+bool EXGLStateShadow::isValid(GLenum pname, std::initializer_list<double> values) const {
+  // Through int64_t, as converting negative values to unsigned ones directly is undefined.
+  auto value = static_cast<GLenum>(static_cast<int64_t>(*values.begin()));
+  switch (pname) {
+    case GL_ACTIVE_TEXTURE: {
+      // The minimum of OpenGL ES 3.0, if the actual limit hasn't been queried.
+      GLint maxUnits = 32;
+      getParameter(GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, &maxUnits, 1);
+      return value >= GL_TEXTURE0 && value < GL_TEXTURE0 + static_cast<GLenum>(maxUnits);
+    }
+    case GL_BLEND_EQUATION_RGB:
+    case GL_BLEND_EQUATION_ALPHA:
+      return isBlendEquation(value);
+    case GL_BLEND_SRC_RGB:
+    case GL_BLEND_SRC_ALPHA:
+    case GL_BLEND_DST_RGB:
+    case GL_BLEND_DST_ALPHA:
+      return isBlendFactor(value);
+    case GL_CULL_FACE_MODE:
+      return value == GL_FRONT || value == GL_BACK || value == GL_FRONT_AND_BACK;
+    case GL_DEPTH_FUNC:
+    case GL_STENCIL_FUNC:
+    case GL_STENCIL_BACK_FUNC:
+      return isCompareFunc(value);
+    case GL_FRONT_FACE:
+      return value == GL_CW || value == GL_CCW;
+    case GL_GENERATE_MIPMAP_HINT:
+      return value == GL_FASTEST || value == GL_NICEST || value == GL_DONT_CARE;
+    case GL_PACK_ALIGNMENT:
+    case GL_UNPACK_ALIGNMENT:
+      return value == 1 || value == 2 || value == 4 || value == 8;
+    case GL_STENCIL_FAIL:
+    case GL_STENCIL_PASS_DEPTH_FAIL:
+    case GL_STENCIL_PASS_DEPTH_PASS:
+    case GL_STENCIL_BACK_FAIL:
+    case GL_STENCIL_BACK_PASS_DEPTH_FAIL:
+    case GL_STENCIL_BACK_PASS_DEPTH_PASS:
+      return isStencilOp(value);
+    case GL_LINE_WIDTH:
+      return *values.begin() > 0;
+    case GL_SCISSOR_BOX:
+    case GL_VIEWPORT:
+      // Width and height
+      return values.size() == 4 && values.begin()[2] >= 0 && values.begin()[3] >= 0;
+    default:
+      return true;
+  }
+}
+
+bool EXGLStateShadow::setEnabled(GLenum cap, bool enabled) {
+  if (!isTrackedCapability(cap)) {
+    return true;
+  }
+  return setParameter(cap, {enabled ? 1.0 : 0.0});
+}
+
+bool EXGLStateShadow::bindBuffer(GLenum target, UEXGLObjectId buffer) {
+  auto pname = bufferBindingPname(target);
+  return pname == 0 || setBinding(pname, buffer);
+}
+
+bool EXGLStateShadow::bindFramebuffer(GLenum target, UEXGLObjectId framebuffer) {
+  switch (target) {
+    case GL_FRAMEBUFFER: {
+      bool drawChanged = setBinding(GL_DRAW_FRAMEBUFFER_BINDING, framebuffer);
+      bool readChanged = setBinding(GL_READ_FRAMEBUFFER_BINDING, framebuffer);
+      return drawChanged || readChanged;
+    }
+    case GL_DRAW_FRAMEBUFFER:
+      return setBinding(GL_DRAW_FRAMEBUFFER_BINDING, framebuffer);
+    case GL_READ_FRAMEBUFFER:
+      return setBinding(GL_READ_FRAMEBUFFER_BINDING, framebuffer);
+    default:
+      return true;
+  }
+}
+
+bool EXGLStateShadow::bindRenderbuffer(GLenum target, UEXGLObjectId renderbuffer) {
+  return target != GL_RENDERBUFFER || setBinding(GL_RENDERBUFFER_BINDING, renderbuffer);
+}
+
+bool EXGLStateShadow::bindTexture(GLenum target, UEXGLObjectId texture) {
+  auto key = textureBindingKey(target);
+  if (key == 0 || !isTextureTarget(target)) {
+    return true;
+  }
+  if (texture != 0 && textureTargets.emplace(texture, target).first->second != target) {
+    return true;
+  }
+  UEXGLObjectId boundTexture;
+  if (getTextureBinding(key, boundTexture) && boundTexture == texture) {
+    return false;
+  }
+  textureBindings[key] = texture;
+  return true;
+}
+
+bool EXGLStateShadow::bindVertexArray(UEXGLObjectId vertexArray) {
+  if (!setBinding(GL_VERTEX_ARRAY_BINDING, vertexArray)) {
+    return false;
+  }
+  // The element array buffer binding is a part of the vertex array state.
+  bindings.erase(GL_ELEMENT_ARRAY_BUFFER_BINDING);
+  return true;
+}
+
+bool EXGLStateShadow::useProgram(UEXGLObjectId program) {
+  if (!setBinding(GL_CURRENT_PROGRAM, program)) {
+    return false;
+  }
+  isCurrentProgramUnverified = program != 0 && linkedPrograms.count(program) == 0;
+  return true;
+}
+
+bool EXGLStateShadow::getBinding(GLenum pname, UEXGLObjectId &object) const {
+  if (auto target = textureBindingTarget(pname)) {
+    auto key = textureBindingKey(target);
+    return key != 0 && getTextureBinding(key, object);
+  }
+  if (pname == GL_CURRENT_PROGRAM && isCurrentProgramUnverified) {
+    return false;
+  }
+  auto it = bindings.find(pname);
+  if (it == bindings.end()) {
+    return false;
+  }
+  object = it->second;
+  return true;
+}
+
+void EXGLStateShadow::didDeleteBuffer(UEXGLObjectId buffer) {
+  if (buffer == 0) {
+    return;
+  }
+  for (GLenum pname : bufferBindingPnames) {
+    auto it = bindings.find(pname);
+    if (it != bindings.end() && it->second == buffer) {
+      it->second = 0;
+    }
+  }
+}
+
+bool EXGLStateShadow::didDeleteFramebuffer(UEXGLObjectId framebuffer) {
+  if (framebuffer == 0) {
+    return false;
+  }
+  bool mightBeBound = false;
+  for (GLenum pname : {GL_DRAW_FRAMEBUFFER_BINDING, GL_READ_FRAMEBUFFER_BINDING}) {
+    auto it = bindings.find(pname);
+    if (it == bindings.end()) {
+      mightBeBound = true;
+    } else if (it->second == framebuffer) {
+      it->second = 0;
+      mightBeBound = true;
+    }
+  }
+  return mightBeBound;
+}
+
+void EXGLStateShadow::didDeleteRenderbuffer(UEXGLObjectId renderbuffer) {
+  auto it = bindings.find(GL_RENDERBUFFER_BINDING);
+  if (renderbuffer != 0 && it != bindings.end() && it->second == renderbuffer) {
+    it->second = 0;
+  }
+}
+
+void EXGLStateShadow::didDeleteTexture(UEXGLObjectId texture) {
+  if (texture == 0) {
+    return;
+  }
+  for (auto &binding : textureBindings) {
+    if (binding.second == texture) {
+      binding.second = 0;
+    }
+  }
+  textureTargets.erase(texture);
+}
+
+void EXGLStateShadow::didDeleteVertexArray(UEXGLObjectId vertexArray) {
+  auto it = bindings.find(GL_VERTEX_ARRAY_BINDING);
+  if (vertexArray != 0 && it != bindings.end() && it->second == vertexArray) {
+    bindVertexArray(0);
+  }
+}
+
+void EXGLStateShadow::didDeleteProgram(UEXGLObjectId program) {
+  // A deleted program stays current until another one is used, so only its locations
+  // are forgotten.
+  didLinkProgram(program);
+}
+
+void EXGLStateShadow::didLinkProgram(UEXGLObjectId program) {
+  uniformLocations.erase(program);
+  attribLocations.erase(program);
+  linkedPrograms.erase(program);
+  // If the program wasn't used because it failed to link, using it again after this link
+  // can't be skipped.
+  auto it = bindings.find(GL_CURRENT_PROGRAM);
+  if (isCurrentProgramUnverified && it != bindings.end() && it->second == program) {
+    bindings.erase(it);
+    isCurrentProgramUnverified = false;
+  }
+}
+
+void EXGLStateShadow::didQueryLinkStatus(UEXGLObjectId program, bool linked) {
+  if (linked) {
+    linkedPrograms.insert(program);
+  } else {
+    linkedPrograms.erase(program);
+  }
+  auto it = bindings.find(GL_CURRENT_PROGRAM);
+  if (isCurrentProgramUnverified && it != bindings.end() && it->second == program) {
+    // The program was linked when it was used, as it hasn't been linked again since then.
+    if (!linked) {
+      bindings.erase(it);
+    }
+    isCurrentProgramUnverified = false;
+  }
+}
+
+bool EXGLStateShadow::getUniformLocation(
+    UEXGLObjectId program,
+    const std::string &name,
+    GLint &location) const {
+  auto programIt = uniformLocations.find(program);
+  if (programIt == uniformLocations.end()) {
+    return false;
+  }
+  auto it = programIt->second.find(name);
+  if (it == programIt->second.end()) {
+    return false;
+  }
+  location = it->second;
+  return true;
+}
+
+void EXGLStateShadow::setUniformLocation(
+    UEXGLObjectId program,
+    const std::string &name,
+    GLint location) {
+  uniformLocations[program][name] = location;
+}
+
+bool EXGLStateShadow::getAttribLocation(
+    UEXGLObjectId program,
+    const std::string &name,
+    GLint &location) const {
+  auto programIt = attribLocations.find(program);
+  if (programIt == attribLocations.end()) {
+    return false;
+  }
+  auto it = programIt->second.find(name);
+  if (it == programIt->second.end()) {
+    return false;
+  }
+  location = it->second;
+  return true;
+}
+
+void EXGLStateShadow::setAttribLocation(
+    UEXGLObjectId program,
+    const std::string &name,
+    GLint location) {
+  attribLocations[program][name] = location;
+}
+
+bool EXGLStateShadow::isTracked(GLenum pname) {
+  switch (pname) {
+    case GL_ACTIVE_TEXTURE:
+    case GL_BLEND_COLOR:
+    case GL_BLEND_DST_ALPHA:
+    case GL_BLEND_DST_RGB:
+    case GL_BLEND_EQUATION_ALPHA:
+    case GL_BLEND_EQUATION_RGB:
+    case GL_BLEND_SRC_ALPHA:
+    case GL_BLEND_SRC_RGB:
+    case GL_COLOR_CLEAR_VALUE:
+    case GL_COLOR_WRITEMASK:
+    case GL_CULL_FACE_MODE:
+    case GL_DEPTH_CLEAR_VALUE:
+    case GL_DEPTH_FUNC:
+    case GL_DEPTH_RANGE:
+    case GL_DEPTH_WRITEMASK:
+    case GL_FRONT_FACE:
+    case GL_GENERATE_MIPMAP_HINT:
+    case GL_LINE_WIDTH:
+    case GL_PACK_ALIGNMENT:
+    case GL_POLYGON_OFFSET_FACTOR:
+    case GL_POLYGON_OFFSET_UNITS:
+    case GL_SAMPLE_COVERAGE_INVERT:
+    case GL_SAMPLE_COVERAGE_VALUE:
+    case GL_SCISSOR_BOX:
+    case GL_STENCIL_BACK_FAIL:
+    case GL_STENCIL_BACK_FUNC:
+    case GL_STENCIL_BACK_PASS_DEPTH_FAIL:
+    case GL_STENCIL_BACK_PASS_DEPTH_PASS:
+    case GL_STENCIL_BACK_REF:
+    case GL_STENCIL_BACK_VALUE_MASK:
+    case GL_STENCIL_BACK_WRITEMASK:
+    case GL_STENCIL_CLEAR_VALUE:
+    case GL_STENCIL_FAIL:
+    case GL_STENCIL_FUNC:
+    case GL_STENCIL_PASS_DEPTH_FAIL:
+    case GL_STENCIL_PASS_DEPTH_PASS:
+    case GL_STENCIL_REF:
+    case GL_STENCIL_VALUE_MASK:
+    case GL_STENCIL_WRITEMASK:
+    case GL_UNPACK_ALIGNMENT:
+    case GL_VIEWPORT:
+      return true;
+    default:
+      return isTrackedCapability(pname);
+  }
+}
+
+bool EXGLStateShadow::isImplementationLimit(GLenum pname) {
+  switch (pname) {
+    case GL_ALIASED_LINE_WIDTH_RANGE:
+    case GL_ALIASED_POINT_SIZE_RANGE:
+    case GL_MAX_3D_TEXTURE_SIZE:
+    case GL_MAX_ARRAY_TEXTURE_LAYERS:
+    case GL_MAX_COLOR_ATTACHMENTS:
+    case GL_MAX_COMBINED_FRAGMENT_UNIFORM_COMPONENTS:
+    case GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS:
+    case GL_MAX_COMBINED_UNIFORM_BLOCKS:
+    case GL_MAX_COMBINED_VERTEX_UNIFORM_COMPONENTS:
+    case GL_MAX_CUBE_MAP_TEXTURE_SIZE:
+    case GL_MAX_DRAW_BUFFERS:
+    case GL_MAX_ELEMENT_INDEX:
+    case GL_MAX_ELEMENTS_INDICES:
+    case GL_MAX_ELEMENTS_VERTICES:
+    case GL_MAX_FRAGMENT_INPUT_COMPONENTS:
+    case GL_MAX_FRAGMENT_UNIFORM_BLOCKS:
+    case GL_MAX_FRAGMENT_UNIFORM_COMPONENTS:
+    case GL_MAX_FRAGMENT_UNIFORM_VECTORS:
+    case GL_MAX_PROGRAM_TEXEL_OFFSET:
+    case GL_MAX_RENDERBUFFER_SIZE:
+    case GL_MAX_SAMPLES:
+    case GL_MAX_TEXTURE_IMAGE_UNITS:
+    case GL_MAX_TEXTURE_LOD_BIAS:
+    case GL_MAX_TEXTURE_SIZE:
+    case GL_MAX_TRANSFORM_FEEDBACK_INTERLEAVED_COMPONENTS:
+    case GL_MAX_TRANSFORM_FEEDBACK_SEPARATE_ATTRIBS:
+    case GL_MAX_TRANSFORM_FEEDBACK_SEPARATE_COMPONENTS:
+    case GL_MAX_UNIFORM_BLOCK_SIZE:
+    case GL_MAX_UNIFORM_BUFFER_BINDINGS:
+    case GL_MAX_VARYING_COMPONENTS:
+    case GL_MAX_VARYING_VECTORS:
+    case GL_MAX_VERTEX_ATTRIBS:
+    case GL_MAX_VERTEX_OUTPUT_COMPONENTS:
+    case GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS:
+    case GL_MAX_VERTEX_UNIFORM_BLOCKS:
+    case GL_MAX_VERTEX_UNIFORM_COMPONENTS:
+    case GL_MAX_VERTEX_UNIFORM_VECTORS:
+    case GL_MAX_VIEWPORT_DIMS:
+    case GL_MIN_PROGRAM_TEXEL_OFFSET:
+    case GL_NUM_COMPRESSED_TEXTURE_FORMATS:
+    case GL_NUM_EXTENSIONS:
+    case GL_NUM_PROGRAM_BINARY_FORMATS:
+    case GL_NUM_SHADER_BINARY_FORMATS:
+    case GL_SUBPIXEL_BITS:
+    case GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool EXGLStateShadow::isTrackedCapability(GLenum cap) {
+  switch (cap) {
+    case GL_BLEND:
+    case GL_CULL_FACE:
+    case GL_DEPTH_TEST:
+    case GL_DITHER:
+    case GL_POLYGON_OFFSET_FILL:
+    case GL_PRIMITIVE_RESTART_FIXED_INDEX:
+    case GL_RASTERIZER_DISCARD:
+    case GL_SAMPLE_ALPHA_TO_COVERAGE:
+    case GL_SAMPLE_COVERAGE:
+    case GL_SCISSOR_TEST:
+    case GL_STENCIL_TEST:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool EXGLStateShadow::isClampedToUnitRange(GLenum pname) {
+  switch (pname) {
+    case GL_BLEND_COLOR:
+    case GL_COLOR_CLEAR_VALUE:
+    case GL_DEPTH_CLEAR_VALUE:
+    case GL_DEPTH_RANGE:
+    case GL_SAMPLE_COVERAGE_VALUE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool EXGLStateShadow::setBinding(GLenum pname, UEXGLObjectId object) {
+  auto it = bindings.find(pname);
+  if (it != bindings.end() && it->second == object) {
+    return false;
+  }
+  bindings[pname] = object;
+  return true;
+}
+
+bool EXGLStateShadow::getTextureBinding(uint64_t key, UEXGLObjectId &texture) const {
+  auto it = textureBindings.find(key);
+  if (it != textureBindings.end()) {
+    texture = it->second;
+    return true;
+  }
+  if (allTexturesUnbound) {
+    texture = 0;
+    return true;
+  }
+  return false;
+}
+
+uint64_t EXGLStateShadow::textureBindingKey(GLenum target) const {
+  GLint activeTexture;
+  if (!getParameter(GL_ACTIVE_TEXTURE, &activeTexture, 1)) {
+    return 0;
+  }
+  return (static_cast<uint64_t>(activeTexture) << 32) | target;
+}
+
+} // namespace gl_cpp
+} // namespace expo
@@ -0,0 +1,166 @@
+#pragma once
+
+#ifdef __ANDROID__
+#include <GLES3/gl3.h>
+#include <GLES3/gl3ext.h>
+#endif
+#ifdef __APPLE__
+#include <OpenGLES/ES3/gl.h>
+#endif
+
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "UEXGL.h"
+
+namespace expo {
+namespace gl_cpp {
+
+// [JS thread] A copy of the GL state that JS sets (capabilities, blend/depth/stencil
+// state, clear values, viewport, pixel-store params and bindings), updated as the
+// methods setting it are enqueued.
+//
+// It lets getParameter-like methods answer without waiting for the GL thread, and
+// lets methods skip enqueueing calls that wouldn't change anything (e.g. binding the
+// texture that is already bound). Values which are not known (e.g. because they were
+// never set, or after clear()) are queried from GL as before.
+//
+// Bindings are stored as EXGL object ids, so they don't need to wait for objects to
+// be created on the GL thread.
+//
+// GL ignores calls with arguments it rejects, so those don't change the shadow either (the
+// calls are still made, so that GL reports the errors).
+class EXGLStateShadow {
+ public:
+  // Sets values of a newly prepared context (GL defaults, plus the viewport and
+  // clear values set by EXGLContext::prepareOpenGLESContext).
+  void reset(GLint viewportWidth, GLint viewportHeight);
+
+  // Forgets all values; to be used after the state was changed behind JS's back.
+  void clear();
+
+  // Records a value of a parameter (as returned by getParameter, with booleans and
+  // enums converted to numbers). Values that GL clamps to [0, 1] are clamped. Returns
+  // false if the parameter already has this value, i.e. if setting it can be skipped.
+  bool setParameter(GLenum pname, std::initializer_list<double> values);
+
+  // Whether GL accepts the value of a parameter. Methods setting a few parameters at once
+  // check all of them first, as GL rejects the whole call if any of them is invalid.
+  bool isValid(GLenum pname, std::initializer_list<double> values) const;
+
+  // enable/disable; capabilities can be queried with getParameter.
+  bool setEnabled(GLenum cap, bool enabled);
+
+  // Copies the value of the parameter to `values`. Returns false if it's not known.
+  template <typename T>
+  bool getParameter(GLenum pname, T *values, size_t count) const {
+    auto it = parameters.find(pname);
+    if (it == parameters.end() || it->second.count != count) {
+      return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+      values[i] = static_cast<T>(it->second.values[i]);
+    }
+    return true;
+  }
+
+  // Stores a value queried from GL, if it can't change without going through the
+  // shadow (state set by JS, implementation limits).
+  template <typename T>
+  void didQueryParameter(GLenum pname, const T *values, size_t count) {
+    if (count > 4 || !(isTracked(pname) || isImplementationLimit(pname))) {
+      return;
+    }
+    auto &parameter = parameters[pname];
+    parameter.count = count;
+    for (size_t i = 0; i < count; i++) {
+      parameter.values[i] = static_cast<double>(values[i]);
+    }
+  }
+
+  // Bindings. Each returns false if the object is already bound, i.e. if binding it
+  // can be skipped.
+  bool bindBuffer(GLenum target, UEXGLObjectId buffer);
+  bool bindFramebuffer(GLenum target, UEXGLObjectId framebuffer);
+  bool bindRenderbuffer(GLenum target, UEXGLObjectId renderbuffer);
+  bool bindTexture(GLenum target, UEXGLObjectId texture);
+  bool bindVertexArray(UEXGLObjectId vertexArray);
+  bool useProgram(UEXGLObjectId program);
+
+  // Returns the object bound to one of binding points that can be queried with
+  // getParameter (e.g. GL_TEXTURE_BINDING_2D for the active texture unit), or false
+  // if it's not known.
+  bool getBinding(GLenum pname, UEXGLObjectId &object) const;
+
+  // The getParameter pname of a buffer binding point (e.g. GL_ARRAY_BUFFER_BINDING for
+  // GL_ARRAY_BUFFER), or 0 if the target is not a buffer target.
+  static GLenum bufferBindingPname(GLenum target);
+
+  // GL unbinds deleted objects from the current bindings.
+  void didDeleteBuffer(UEXGLObjectId buffer);
+  // Returns false if the framebuffer is known not to be bound. Otherwise, the default
+  // framebuffer has to be bound in its place, as GL binds the framebuffer zero instead
+  // (see EXGLContext::defaultFramebuffer).
+  bool didDeleteFramebuffer(UEXGLObjectId framebuffer);
+  void didDeleteRenderbuffer(UEXGLObjectId renderbuffer);
+  void didDeleteTexture(UEXGLObjectId texture);
+  void didDeleteVertexArray(UEXGLObjectId vertexArray);
+  void didDeleteProgram(UEXGLObjectId program);
+
+  // Locations of uniforms and attributes are cached until the program is linked
+  // again (or deleted). A location of -1 means that there is no such variable.
+  void didLinkProgram(UEXGLObjectId program);
+  // GL doesn't use programs which failed to link, so the current program is only known
+  // once the link status of the one passed to useProgram is.
+  void didQueryLinkStatus(UEXGLObjectId program, bool linked);
+  bool getUniformLocation(UEXGLObjectId program, const std::string &name, GLint &location)
+      const;
+  void setUniformLocation(UEXGLObjectId program, const std::string &name, GLint location);
+  bool getAttribLocation(UEXGLObjectId program, const std::string &name, GLint &location)
+      const;
+  void setAttribLocation(UEXGLObjectId program, const std::string &name, GLint location);
+
+ private:
+  struct Parameter {
+    std::array<double, 4> values;
+    size_t count;
+  };
+
+  using Locations = std::unordered_map<std::string, GLint>;
+
+  static bool isTracked(GLenum pname);
+  static bool isImplementationLimit(GLenum pname);
+  static bool isTrackedCapability(GLenum cap);
+  static bool isClampedToUnitRange(GLenum pname);
+
+  bool setBinding(GLenum pname, UEXGLObjectId object);
+  // Key of the texture binding point for the active texture unit, or 0 if the
+  // active unit is not known.
+  uint64_t textureBindingKey(GLenum target) const;
+  bool getTextureBinding(uint64_t key, UEXGLObjectId &texture) const;
+
+  std::unordered_map<GLenum, Parameter> parameters;
+  // Keyed by the binding's getParameter pname, e.g. GL_ARRAY_BUFFER_BINDING.
+  std::unordered_map<GLenum, UEXGLObjectId> bindings;
+  // Keyed by the active texture unit and the target.
+  std::unordered_map<uint64_t, UEXGLObjectId> textureBindings;
+  // Targets that textures were first bound to, GL doesn't bind them to other ones.
+  std::unordered_map<UEXGLObjectId, GLenum> textureTargets;
+  // Programs whose last link is known to have succeeded.
+  std::unordered_set<UEXGLObjectId> linkedPrograms;
+  // Set when the link status of the program last passed to useProgram is not known. The
+  // program is recorded in `bindings` anyway, so that using it again can be skipped: until
+  // it's linked again, GL would reject it again.
+  bool isCurrentProgramUnverified = false;
+  std::unordered_map<UEXGLObjectId, Locations> uniformLocations;
+  std::unordered_map<UEXGLObjectId, Locations> attribLocations;
+  // Set after reset(), when texture units missing from textureBindings have nothing bound.
+  bool allTexturesUnbound = false;
+};
+
+} // namespace gl_cpp
+} // namespace expo
@@ -6,6 +6,7 @@
 #include "EXWebGLRenderer.h"
 
 #include <algorithm>
+#include <cstring>
 
 #define ARG(index, type)                                   \
   (argc > index ? unpackArg<type>(runtime, jsArgv + index) \
@@ -39,8 +40,11 @@ namespace gl_cpp {
 namespace method {
 
 EXGLContextWithLock getContext(jsi::Runtime &runtime, const jsi::Value &jsThis) {
-  double exglCtxId = jsThis.asObject(runtime).getProperty(runtime, "contextId").asNumber();
-  return EXGLContextGet(static_cast<UEXGLContextId>(exglCtxId));
+  auto handle = jsThis.asObject(runtime)
+                    .getProperty(runtime, getPropNameID(runtime, Prop::EXGLContextHandle))
+                    .asObject(runtime)
+                    .getHostObject<EXGLContextHandle>(runtime);
+  return EXGLContextGet(handle->ref);
 }
 
 // This listing follows the order in
@@ -67,46 +71,298 @@ NATIVE_METHOD(isContextLost) {
 // Viewing and clipping
 // --------------------
 
-SIMPLE_NATIVE_METHOD(scissor, glScissor); // x, y, width, height
+NATIVE_METHOD(scissor) {
+  CTX();
+  auto x = ARG(0, GLint);
+  auto y = ARG(1, GLint);
+  auto width = ARG(2, GLsizei);
+  auto height = ARG(3, GLsizei);
+  if (ctx->stateShadow().setParameter(
+          GL_SCISSOR_BOX,
+          {static_cast<double>(x),
+           static_cast<double>(y),
+           static_cast<double>(width),
+           static_cast<double>(height)})) {
+    ctx->addToNextBatch([=] { glScissor(x, y, width, height); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(viewport, glViewport); // x, y, width, height
+NATIVE_METHOD(viewport) {
+  CTX();
+  auto x = ARG(0, GLint);
+  auto y = ARG(1, GLint);
+  auto width = ARG(2, GLsizei);
+  auto height = ARG(3, GLsizei);
+  if (ctx->stateShadow().setParameter(
+          GL_VIEWPORT,
+          {static_cast<double>(x),
+           static_cast<double>(y),
+           static_cast<double>(width),
+           static_cast<double>(height)})) {
+    ctx->addToNextBatch([=] { glViewport(x, y, width, height); });
+  }
+  return nullptr;
+}
 
 // State information
 // -----------------
 
-SIMPLE_NATIVE_METHOD(activeTexture, glActiveTexture); // texture
+// Sets a parameter of front and/or back facing polygons in the state shadow.
+static bool setStencilParameter(
+    EXGLStateShadow &shadow,
+    GLenum face,
+    GLenum frontPname,
+    GLenum backPname,
+    double value) {
+  switch (face) {
+    case GL_FRONT:
+      return shadow.setParameter(frontPname, {value});
+    case GL_BACK:
+      return shadow.setParameter(backPname, {value});
+    case GL_FRONT_AND_BACK: {
+      bool frontChanged = shadow.setParameter(frontPname, {value});
+      bool backChanged = shadow.setParameter(backPname, {value});
+      return frontChanged || backChanged;
+    }
+    default:
+      return true;
+  }
+}
 
-SIMPLE_NATIVE_METHOD(blendColor, glBlendColor); // red, green, blue, alpha
+NATIVE_METHOD(activeTexture) {
+  CTX();
+  auto texture = ARG(0, GLenum);
+  if (texture >= GL_TEXTURE0 + 32) {
+    // Past the minimum number of units, the shadow needs the limit to know if it's valid.
+    GLint maxUnits;
+    exglGetParameter(ctx, GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS, &maxUnits, 1, glGetIntegerv);
+  }
+  if (ctx->stateShadow().setParameter(GL_ACTIVE_TEXTURE, {static_cast<double>(texture)})) {
+    ctx->addToNextBatch([=] { glActiveTexture(texture); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(blendEquation, glBlendEquation); // mode
+NATIVE_METHOD(blendColor) {
+  CTX();
+  auto red = ARG(0, GLclampf);
+  auto green = ARG(1, GLclampf);
+  auto blue = ARG(2, GLclampf);
+  auto alpha = ARG(3, GLclampf);
+  if (ctx->stateShadow().setParameter(GL_BLEND_COLOR, {red, green, blue, alpha})) {
+    ctx->addToNextBatch([=] { glBlendColor(red, green, blue, alpha); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(blendEquationSeparate, glBlendEquationSeparate); // modeRGB, modeAlpha
+NATIVE_METHOD(blendEquation) {
+  CTX();
+  auto mode = ARG(0, GLenum);
+  auto &shadow = ctx->stateShadow();
+  bool rgbChanged = shadow.setParameter(GL_BLEND_EQUATION_RGB, {static_cast<double>(mode)});
+  bool alphaChanged = shadow.setParameter(GL_BLEND_EQUATION_ALPHA, {static_cast<double>(mode)});
+  if (rgbChanged || alphaChanged) {
+    ctx->addToNextBatch([=] { glBlendEquation(mode); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(blendFunc, glBlendFunc); // sfactor, dfactor
+NATIVE_METHOD(blendEquationSeparate) {
+  CTX();
+  auto modeRGB = ARG(0, GLenum);
+  auto modeAlpha = ARG(1, GLenum);
+  auto &shadow = ctx->stateShadow();
+  // GL rejects the whole call if one of the modes is invalid.
+  bool changed = !shadow.isValid(GL_BLEND_EQUATION_RGB, {static_cast<double>(modeRGB)}) ||
+      !shadow.isValid(GL_BLEND_EQUATION_ALPHA, {static_cast<double>(modeAlpha)});
+  if (!changed) {
+    bool rgbChanged = shadow.setParameter(GL_BLEND_EQUATION_RGB, {static_cast<double>(modeRGB)});
+    bool alphaChanged =
+        shadow.setParameter(GL_BLEND_EQUATION_ALPHA, {static_cast<double>(modeAlpha)});
+    changed = rgbChanged || alphaChanged;
+  }
+  if (changed) {
+    ctx->addToNextBatch([=] { glBlendEquationSeparate(modeRGB, modeAlpha); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(blendFuncSeparate, glBlendFuncSeparate); // srcRGB, dstRGB, srcAlpha, dstAlpha
+NATIVE_METHOD(blendFunc) {
+  CTX();
+  auto sfactor = ARG(0, GLenum);
+  auto dfactor = ARG(1, GLenum);
+  auto &shadow = ctx->stateShadow();
+  // GL rejects the whole call if one of the factors is invalid.
+  bool changed = !shadow.isValid(GL_BLEND_SRC_RGB, {static_cast<double>(sfactor)}) ||
+      !shadow.isValid(GL_BLEND_DST_RGB, {static_cast<double>(dfactor)});
+  if (!changed) {
+    changed |= shadow.setParameter(GL_BLEND_SRC_RGB, {static_cast<double>(sfactor)});
+    changed |= shadow.setParameter(GL_BLEND_SRC_ALPHA, {static_cast<double>(sfactor)});
+    changed |= shadow.setParameter(GL_BLEND_DST_RGB, {static_cast<double>(dfactor)});
+    changed |= shadow.setParameter(GL_BLEND_DST_ALPHA, {static_cast<double>(dfactor)});
+  }
+  if (changed) {
+    ctx->addToNextBatch([=] { glBlendFunc(sfactor, dfactor); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(clearColor, glClearColor); // red, green, blue, alpha
+NATIVE_METHOD(blendFuncSeparate) {
+  CTX();
+  auto srcRGB = ARG(0, GLenum);
+  auto dstRGB = ARG(1, GLenum);
+  auto srcAlpha = ARG(2, GLenum);
+  auto dstAlpha = ARG(3, GLenum);
+  auto &shadow = ctx->stateShadow();
+  bool changed = false;
+  for (GLenum factor : {srcRGB, dstRGB, srcAlpha, dstAlpha}) {
+    changed |= !shadow.isValid(GL_BLEND_SRC_RGB, {static_cast<double>(factor)});
+  }
+  if (!changed) {
+    changed |= shadow.setParameter(GL_BLEND_SRC_RGB, {static_cast<double>(srcRGB)});
+    changed |= shadow.setParameter(GL_BLEND_DST_RGB, {static_cast<double>(dstRGB)});
+    changed |= shadow.setParameter(GL_BLEND_SRC_ALPHA, {static_cast<double>(srcAlpha)});
+    changed |= shadow.setParameter(GL_BLEND_DST_ALPHA, {static_cast<double>(dstAlpha)});
+  }
+  if (changed) {
+    ctx->addToNextBatch([=] { glBlendFuncSeparate(srcRGB, dstRGB, srcAlpha, dstAlpha); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(clearDepth, glClearDepthf); // depth
+NATIVE_METHOD(clearColor) {
+  CTX();
+  auto red = ARG(0, GLclampf);
+  auto green = ARG(1, GLclampf);
+  auto blue = ARG(2, GLclampf);
+  auto alpha = ARG(3, GLclampf);
+  if (ctx->stateShadow().setParameter(GL_COLOR_CLEAR_VALUE, {red, green, blue, alpha})) {
+    ctx->addToNextBatch([=] { glClearColor(red, green, blue, alpha); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(clearStencil, glClearStencil); // s
+NATIVE_METHOD(clearDepth) {
+  CTX();
+  auto depth = ARG(0, GLclampf);
+  if (ctx->stateShadow().setParameter(GL_DEPTH_CLEAR_VALUE, {depth})) {
+    ctx->addToNextBatch([=] { glClearDepthf(depth); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(colorMask, glColorMask); // red, green, blue, alpha
+NATIVE_METHOD(clearStencil) {
+  CTX();
+  auto s = ARG(0, GLint);
+  if (ctx->stateShadow().setParameter(GL_STENCIL_CLEAR_VALUE, {static_cast<double>(s)})) {
+    ctx->addToNextBatch([=] { glClearStencil(s); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(cullFace, glCullFace); // mode
+NATIVE_METHOD(colorMask) {
+  CTX();
+  auto red = ARG(0, GLboolean);
+  auto green = ARG(1, GLboolean);
+  auto blue = ARG(2, GLboolean);
+  auto alpha = ARG(3, GLboolean);
+  if (ctx->stateShadow().setParameter(
+          GL_COLOR_WRITEMASK,
+          {static_cast<double>(red),
+           static_cast<double>(green),
+           static_cast<double>(blue),
+           static_cast<double>(alpha)})) {
+    ctx->addToNextBatch([=] { glColorMask(red, green, blue, alpha); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(depthFunc, glDepthFunc); // func
+NATIVE_METHOD(cullFace) {
+  CTX();
+  auto mode = ARG(0, GLenum);
+  if (ctx->stateShadow().setParameter(GL_CULL_FACE_MODE, {static_cast<double>(mode)})) {
+    ctx->addToNextBatch([=] { glCullFace(mode); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(depthMask, glDepthMask); // flag
+NATIVE_METHOD(depthFunc) {
+  CTX();
+  auto func = ARG(0, GLenum);
+  if (ctx->stateShadow().setParameter(GL_DEPTH_FUNC, {static_cast<double>(func)})) {
+    ctx->addToNextBatch([=] { glDepthFunc(func); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(depthRange, glDepthRangef); // zNear, zFar
+NATIVE_METHOD(depthMask) {
+  CTX();
+  auto flag = ARG(0, GLboolean);
+  if (ctx->stateShadow().setParameter(GL_DEPTH_WRITEMASK, {static_cast<double>(flag)})) {
+    ctx->addToNextBatch([=] { glDepthMask(flag); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(disable, glDisable); // cap
+NATIVE_METHOD(depthRange) {
+  CTX();
+  auto zNear = ARG(0, GLclampf);
+  auto zFar = ARG(1, GLclampf);
+  if (ctx->stateShadow().setParameter(GL_DEPTH_RANGE, {zNear, zFar})) {
+    ctx->addToNextBatch([=] { glDepthRangef(zNear, zFar); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(enable, glEnable); // cap
+NATIVE_METHOD(disable) {
+  CTX();
+  auto cap = ARG(0, GLenum);
+  if (ctx->stateShadow().setEnabled(cap, false)) {
+    ctx->addToNextBatch([=] { glDisable(cap); });
+  }
+  return nullptr;
+}
+
+NATIVE_METHOD(enable) {
+  CTX();
+  auto cap = ARG(0, GLenum);
+  if (ctx->stateShadow().setEnabled(cap, true)) {
+    ctx->addToNextBatch([=] { glEnable(cap); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(frontFace, glFrontFace); // mode
+NATIVE_METHOD(frontFace) {
+  CTX();
+  auto mode = ARG(0, GLenum);
+  if (ctx->stateShadow().setParameter(GL_FRONT_FACE, {static_cast<double>(mode)})) {
+    ctx->addToNextBatch([=] { glFrontFace(mode); });
+  }
+  return nullptr;
+}
+
+// WebGL class of objects bound to the binding point, for getParameter.
+static EXWebGLClass bindingClass(GLenum pname) {
+  switch (pname) {
+    case GL_DRAW_FRAMEBUFFER_BINDING:
+    case GL_READ_FRAMEBUFFER_BINDING:
+      return EXWebGLClass::WebGLFramebuffer;
+    case GL_RENDERBUFFER_BINDING:
+      return EXWebGLClass::WebGLRenderbuffer;
+    case GL_TEXTURE_BINDING_2D:
+    case GL_TEXTURE_BINDING_2D_ARRAY:
+    case GL_TEXTURE_BINDING_3D:
+    case GL_TEXTURE_BINDING_CUBE_MAP:
+      return EXWebGLClass::WebGLTexture;
+    case GL_CURRENT_PROGRAM:
+      return EXWebGLClass::WebGLProgram;
+    case GL_VERTEX_ARRAY_BINDING:
+      return EXWebGLClass::WebGLVertexArrayObject;
+    default:
+      return EXWebGLClass::WebGLBuffer;
+  }
+}
 
 NATIVE_METHOD(getParameter) {
   CTX();
@@ -122,33 +378,33 @@ NATIVE_METHOD(getParameter) {
     case GL_ALIASED_POINT_SIZE_RANGE:
     case GL_DEPTH_RANGE: {
       std::vector<TypedArrayBase::ContentType<TypedArrayKind::Float32Array>> glResults(2);
-      ctx->addBlockingToNextBatch([&] { glGetFloatv(pname, glResults.data()); });
+      exglGetParameter(ctx, pname, glResults.data(), 2, glGetFloatv);
       return TypedArray<TypedArrayKind::Float32Array>(runtime, glResults);
     }
       // FLoat32Array[4]
     case GL_BLEND_COLOR:
     case GL_COLOR_CLEAR_VALUE: {
       std::vector<TypedArrayBase::ContentType<TypedArrayKind::Float32Array>> glResults(4);
-      ctx->addBlockingToNextBatch([&] { glGetFloatv(pname, glResults.data()); });
+      exglGetParameter(ctx, pname, glResults.data(), 4, glGetFloatv);
       return TypedArray<TypedArrayKind::Float32Array>(runtime, glResults);
     }
       // Int32Array[2]
     case GL_MAX_VIEWPORT_DIMS: {
       std::vector<TypedArrayBase::ContentType<TypedArrayKind::Int32Array>> glResults(2);
-      ctx->addBlockingToNextBatch([&] { glGetIntegerv(pname, glResults.data()); });
+      exglGetParameter(ctx, pname, glResults.data(), 2, glGetIntegerv);
       return TypedArray<TypedArrayKind::Int32Array>(runtime, glResults);
     }
       // Int32Array[4]
     case GL_SCISSOR_BOX:
     case GL_VIEWPORT: {
       std::vector<TypedArrayBase::ContentType<TypedArrayKind::Int32Array>> glResults(4);
-      ctx->addBlockingToNextBatch([&] { glGetIntegerv(pname, glResults.data()); });
+      exglGetParameter(ctx, pname, glResults.data(), 4, glGetIntegerv);
       return TypedArray<TypedArrayKind::Int32Array>(runtime, glResults);
     }
       // boolean[4]
     case GL_COLOR_WRITEMASK: {
       GLint glResults[4];
-      ctx->addBlockingToNextBatch([&] { glGetIntegerv(pname, glResults); });
+      exglGetParameter(ctx, pname, glResults, 4, glGetIntegerv);
       return jsi::Array::createWithElements(
           runtime,
           {jsi::Value(glResults[0]),
@@ -169,7 +425,7 @@ NATIVE_METHOD(getParameter) {
     case GL_TRANSFORM_FEEDBACK_ACTIVE:
     case GL_TRANSFORM_FEEDBACK_PAUSED: {
       GLint glResult;
-      ctx->addBlockingToNextBatch([&] { glGetIntegerv(pname, &glResult); });
+      exglGetParameter(ctx, pname, &glResult, 1, glGetIntegerv);
       return jsi::Value(glResult);
     }
 
@@ -192,13 +448,19 @@ NATIVE_METHOD(getParameter) {
     case GL_SAMPLE_COVERAGE_VALUE:
     case GL_MAX_TEXTURE_LOD_BIAS: {
       GLfloat glFloat;
-      ctx->addBlockingToNextBatch([&] { glGetFloatv(pname, &glFloat); });
+      exglGetParameter(ctx, pname, &glFloat, 1, glGetFloatv);
       return static_cast<double>(glFloat);
     }
 
       // UEXGLObjectId
     case GL_ARRAY_BUFFER_BINDING:
     case GL_ELEMENT_ARRAY_BUFFER_BINDING: {
+      UEXGLObjectId buffer;
+      if (ctx->stateShadow().getBinding(pname, buffer)) {
+        return buffer == 0
+            ? jsi::Value::null()
+            : createWebGLObject(runtime, EXWebGLClass::WebGLBuffer, {static_cast<double>(buffer)});
+      }
       GLint glInt;
       ctx->addBlockingToNextBatch([&] { glGetIntegerv(pname, &glInt); });
       for (const auto &pair : ctx->objects) {
@@ -211,6 +473,14 @@ NATIVE_METHOD(getParameter) {
     }
 
     case GL_CURRENT_PROGRAM: {
+      UEXGLObjectId program;
+      if (ctx->stateShadow().getBinding(pname, program)) {
+        return program == 0 ? jsi::Value::null()
+                            : createWebGLObject(
+                                  runtime,
+                                  EXWebGLClass::WebGLProgram,
+                                  {static_cast<double>(program)});
+      }
       GLint glInt;
       ctx->addBlockingToNextBatch([&] { glGetIntegerv(pname, &glInt); });
       for (const auto &pair : ctx->objects) {
@@ -222,28 +492,43 @@ NATIVE_METHOD(getParameter) {
       return nullptr;
     }
 
-      // Unimplemented...
+      // Known only from the state shadow
     case GL_COPY_READ_BUFFER_BINDING:
     case GL_COPY_WRITE_BUFFER_BINDING:
     case GL_DRAW_FRAMEBUFFER_BINDING:
     case GL_READ_FRAMEBUFFER_BINDING:
     case GL_RENDERBUFFER_BINDING:
-    case GL_SAMPLER_BINDING:
     case GL_TEXTURE_BINDING_2D_ARRAY:
     case GL_TEXTURE_BINDING_2D:
     case GL_TEXTURE_BINDING_3D:
     case GL_TEXTURE_BINDING_CUBE_MAP:
-    case GL_TRANSFORM_FEEDBACK_BINDING:
     case GL_TRANSFORM_FEEDBACK_BUFFER_BINDING:
     case GL_UNIFORM_BUFFER_BINDING:
-    case GL_VERTEX_ARRAY_BINDING:
+    case GL_VERTEX_ARRAY_BINDING: {
+      UEXGLObjectId object;
+      if (ctx->stateShadow().getBinding(pname, object)) {
+        return object == 0
+            ? jsi::Value::null()
+            : createWebGLObject(runtime, bindingClass(pname), {static_cast<double>(object)});
+      }
+      throw std::runtime_error(
+          "EXGL: getParameter() doesn't support gl." + std::to_string(pname) + " yet!");
+    }
+
+      // Sync objects can only be polled, see clientWaitSync
+    case GL_MAX_CLIENT_WAIT_TIMEOUT_WEBGL:
+      return 0;
+
+      // Unimplemented...
+    case GL_SAMPLER_BINDING:
+    case GL_TRANSFORM_FEEDBACK_BINDING:
       throw std::runtime_error(
           "EXGL: getParameter() doesn't support gl." + std::to_string(pname) + " yet!");
 
       // int
     default: {
       GLint glInt;
-      ctx->addBlockingToNextBatch([&] { glGetIntegerv(pname, &glInt); });
+      exglGetParameter(ctx, pname, &glInt, 1, glGetIntegerv);
       return jsi::Value(glInt);
     }
   }
@@ -256,17 +541,37 @@ NATIVE_METHOD(getError) {
   return static_cast<double>(glResult);
 }
 
-SIMPLE_NATIVE_METHOD(hint, glHint); // target, mode
+NATIVE_METHOD(hint) {
+  CTX();
+  auto target = ARG(0, GLenum);
+  auto mode = ARG(1, GLenum);
+  if (target != GL_GENERATE_MIPMAP_HINT ||
+      ctx->stateShadow().setParameter(target, {static_cast<double>(mode)})) {
+    ctx->addToNextBatch([=] { glHint(target, mode); });
+  }
+  return nullptr;
+}
 
 NATIVE_METHOD(isEnabled) {
   CTX();
   auto cap = ARG(0, GLenum);
-  GLboolean glResult;
-  ctx->addBlockingToNextBatch([&] { glResult = glIsEnabled(cap); });
-  return glResult == GL_TRUE;
+  auto &shadow = ctx->stateShadow();
+  GLint enabled;
+  if (!shadow.getParameter(cap, &enabled, 1)) {
+    ctx->addBlockingToNextBatch([&] { enabled = glIsEnabled(cap) == GL_TRUE; });
+    shadow.didQueryParameter(cap, &enabled, 1);
+  }
+  return enabled != 0;
 }
 
-SIMPLE_NATIVE_METHOD(lineWidth, glLineWidth); // width
+NATIVE_METHOD(lineWidth) {
+  CTX();
+  auto width = ARG(0, GLfloat);
+  if (ctx->stateShadow().setParameter(GL_LINE_WIDTH, {width})) {
+    ctx->addToNextBatch([=] { glLineWidth(width); });
+  }
+  return nullptr;
+}
 
 NATIVE_METHOD(pixelStorei) {
   CTX();
@@ -276,27 +581,178 @@ NATIVE_METHOD(pixelStorei) {
       ctx->unpackFLipY = ARG(1, GLboolean);
       break;
     }
+    case GL_PACK_ALIGNMENT:
+    case GL_UNPACK_ALIGNMENT: {
+      auto param = ARG(1, GLint);
+      if (ctx->stateShadow().setParameter(pname, {static_cast<double>(param)})) {
+        ctx->addToNextBatch([=] { glPixelStorei(pname, param); });
+      }
+      break;
+    }
     default:
       jsConsoleLog(runtime, { jsi::String::createFromUtf8(runtime, "EXGL: gl.pixelStorei() doesn't support this parameter yet!") });
   }
   return nullptr;
 }
 
-SIMPLE_NATIVE_METHOD(polygonOffset, glPolygonOffset); // factor, units
+NATIVE_METHOD(polygonOffset) {
+  CTX();
+  auto factor = ARG(0, GLfloat);
+  auto units = ARG(1, GLfloat);
+  auto &shadow = ctx->stateShadow();
+  bool factorChanged = shadow.setParameter(GL_POLYGON_OFFSET_FACTOR, {factor});
+  bool unitsChanged = shadow.setParameter(GL_POLYGON_OFFSET_UNITS, {units});
+  if (factorChanged || unitsChanged) {
+    ctx->addToNextBatch([=] { glPolygonOffset(factor, units); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(sampleCoverage, glSampleCoverage); // value, invert
+NATIVE_METHOD(sampleCoverage) {
+  CTX();
+  auto value = ARG(0, GLclampf);
+  auto invert = ARG(1, GLboolean);
+  auto &shadow = ctx->stateShadow();
+  bool valueChanged = shadow.setParameter(GL_SAMPLE_COVERAGE_VALUE, {value});
+  bool invertChanged =
+      shadow.setParameter(GL_SAMPLE_COVERAGE_INVERT, {static_cast<double>(invert)});
+  if (valueChanged || invertChanged) {
+    ctx->addToNextBatch([=] { glSampleCoverage(value, invert); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(stencilFunc, glStencilFunc); // func, ref, mask
+NATIVE_METHOD(stencilFunc) {
+  CTX();
+  auto func = ARG(0, GLenum);
+  auto ref = ARG(1, GLint);
+  auto mask = ARG(2, GLuint);
+  auto &shadow = ctx->stateShadow();
+  // The reference and mask aren't set either if the function is invalid.
+  bool changed = !shadow.isValid(GL_STENCIL_FUNC, {static_cast<double>(func)});
+  if (!changed) {
+    changed |= setStencilParameter(
+        shadow, GL_FRONT_AND_BACK, GL_STENCIL_FUNC, GL_STENCIL_BACK_FUNC, func);
+    changed |= setStencilParameter(
+        shadow, GL_FRONT_AND_BACK, GL_STENCIL_REF, GL_STENCIL_BACK_REF, ref);
+    changed |= setStencilParameter(
+        shadow,
+        GL_FRONT_AND_BACK,
+        GL_STENCIL_VALUE_MASK,
+        GL_STENCIL_BACK_VALUE_MASK,
+        static_cast<GLint>(mask));
+  }
+  if (changed) {
+    ctx->addToNextBatch([=] { glStencilFunc(func, ref, mask); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(stencilFuncSeparate, glStencilFuncSeparate); // face, func, ref, mask
+NATIVE_METHOD(stencilFuncSeparate) {
+  CTX();
+  auto face = ARG(0, GLenum);
+  auto func = ARG(1, GLenum);
+  auto ref = ARG(2, GLint);
+  auto mask = ARG(3, GLuint);
+  auto &shadow = ctx->stateShadow();
+  bool changed = !shadow.isValid(GL_STENCIL_FUNC, {static_cast<double>(func)});
+  if (!changed) {
+    changed |= setStencilParameter(shadow, face, GL_STENCIL_FUNC, GL_STENCIL_BACK_FUNC, func);
+    changed |= setStencilParameter(shadow, face, GL_STENCIL_REF, GL_STENCIL_BACK_REF, ref);
+    changed |= setStencilParameter(
+        shadow, face, GL_STENCIL_VALUE_MASK, GL_STENCIL_BACK_VALUE_MASK, static_cast<GLint>(mask));
+  }
+  if (changed) {
+    ctx->addToNextBatch([=] { glStencilFuncSeparate(face, func, ref, mask); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(stencilMask, glStencilMask); // mask
+NATIVE_METHOD(stencilMask) {
+  CTX();
+  auto mask = ARG(0, GLuint);
+  if (setStencilParameter(
+          ctx->stateShadow(),
+          GL_FRONT_AND_BACK,
+          GL_STENCIL_WRITEMASK,
+          GL_STENCIL_BACK_WRITEMASK,
+          static_cast<GLint>(mask))) {
+    ctx->addToNextBatch([=] { glStencilMask(mask); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(stencilMaskSeparate, glStencilMaskSeparate); // face, mask
+NATIVE_METHOD(stencilMaskSeparate) {
+  CTX();
+  auto face = ARG(0, GLenum);
+  auto mask = ARG(1, GLuint);
+  if (setStencilParameter(
+          ctx->stateShadow(),
+          face,
+          GL_STENCIL_WRITEMASK,
+          GL_STENCIL_BACK_WRITEMASK,
+          static_cast<GLint>(mask))) {
+    ctx->addToNextBatch([=] { glStencilMaskSeparate(face, mask); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(stencilOp, glStencilOp) // fail, zfail, zpass
+NATIVE_METHOD(stencilOp) {
+  CTX();
+  auto fail = ARG(0, GLenum);
+  auto zfail = ARG(1, GLenum);
+  auto zpass = ARG(2, GLenum);
+  auto &shadow = ctx->stateShadow();
+  // GL rejects the whole call if one of the operations is invalid.
+  bool changed = false;
+  for (GLenum op : {fail, zfail, zpass}) {
+    changed |= !shadow.isValid(GL_STENCIL_FAIL, {static_cast<double>(op)});
+  }
+  if (!changed) {
+    changed |= setStencilParameter(
+        shadow, GL_FRONT_AND_BACK, GL_STENCIL_FAIL, GL_STENCIL_BACK_FAIL, fail);
+    changed |= setStencilParameter(
+        shadow,
+        GL_FRONT_AND_BACK,
+        GL_STENCIL_PASS_DEPTH_FAIL,
+        GL_STENCIL_BACK_PASS_DEPTH_FAIL,
+        zfail);
+    changed |= setStencilParameter(
+        shadow,
+        GL_FRONT_AND_BACK,
+        GL_STENCIL_PASS_DEPTH_PASS,
+        GL_STENCIL_BACK_PASS_DEPTH_PASS,
+        zpass);
+  }
+  if (changed) {
+    ctx->addToNextBatch([=] { glStencilOp(fail, zfail, zpass); });
+  }
+  return nullptr;
+}
 
-SIMPLE_NATIVE_METHOD(stencilOpSeparate, glStencilOpSeparate); // face, fail, zfail, zpass
+NATIVE_METHOD(stencilOpSeparate) {
+  CTX();
+  auto face = ARG(0, GLenum);
+  auto fail = ARG(1, GLenum);
+  auto zfail = ARG(2, GLenum);
+  auto zpass = ARG(3, GLenum);
+  auto &shadow = ctx->stateShadow();
+  bool changed = false;
+  for (GLenum op : {fail, zfail, zpass}) {
+    changed |= !shadow.isValid(GL_STENCIL_FAIL, {static_cast<double>(op)});
+  }
+  if (!changed) {
+    changed |= setStencilParameter(shadow, face, GL_STENCIL_FAIL, GL_STENCIL_BACK_FAIL, fail);
+    changed |= setStencilParameter(
+        shadow, face, GL_STENCIL_PASS_DEPTH_FAIL, GL_STENCIL_BACK_PASS_DEPTH_FAIL, zfail);
+    changed |= setStencilParameter(
+        shadow, face, GL_STENCIL_PASS_DEPTH_PASS, GL_STENCIL_BACK_PASS_DEPTH_PASS, zpass);
+  }
+  if (changed) {
+    ctx->addToNextBatch([=] { glStencilOpSeparate(face, fail, zfail, zpass); });
+  }
+  return nullptr;
+}
 
 // Buffers
 // -------
@@ -305,7 +761,9 @@ NATIVE_METHOD(bindBuffer) {
   CTX();
   auto target = ARG(0, GLenum);
   auto buffer = ARG(1, EXWebGLClass);
-  ctx->addToNextBatch([=] { glBindBuffer(target, ctx->lookupObject(buffer)); });
+  if (ctx->stateShadow().bindBuffer(target, buffer)) {
+    ctx->addToNextBatch([=] { glBindBuffer(target, ctx->lookupObject(buffer)); });
+  }
   return nullptr;
 }
 
@@ -349,7 +807,9 @@ NATIVE_METHOD(createBuffer) {
 
 NATIVE_METHOD(deleteBuffer) {
   CTX();
-  return exglDeleteObject(ctx, ARG(0, EXWebGLClass), glDeleteBuffers);
+  auto buffer = ARG(0, EXWebGLClass);
+  ctx->stateShadow().didDeleteBuffer(buffer);
+  return exglDeleteObject(ctx, buffer, glDeleteBuffers);
 }
 
 NATIVE_METHOD(getBufferParameter) {
@@ -372,8 +832,29 @@ SIMPLE_NATIVE_METHOD(
     copyBufferSubData,
     glCopyBufferSubData) // readTarget, writeTarget, readOffset, writeOffset, size
 
-// glGetBufferSubData is not available in OpenGL ES
-UNIMPL_NATIVE_METHOD(getBufferSubData);
+// glGetBufferSubData is not available in OpenGL ES, so the buffer is mapped instead
+NATIVE_METHOD(getBufferSubData) {
+  CTX();
+  auto target = ARG(0, GLenum);
+  auto srcByteOffset = ARG(1, GLintptr);
+  auto dstData = ARG(2, TypedArrayBase);
+  auto dstOffset = argc > 3 ? ARG(3, GLuint) : 0;
+  auto length = argc > 4 ? ARG(4, GLuint) : 0;
+  size_t byteLength = typedArrayRangeLength(runtime, dstData, dstOffset, length);
+  if (byteLength == 0) {
+    return nullptr;
+  }
+  uint8_t *destination = typedArrayData(runtime, dstData, dstOffset, byteLength);
+  // The data is copied straight to the ArrayBuffer, which is safe as this call blocks
+  ctx->addBlockingToNextBatch([&] {
+    void *data = glMapBufferRange(target, srcByteOffset, byteLength, GL_MAP_READ_BIT);
+    if (data != nullptr) {
+      std::memcpy(destination, data, byteLength);
+      glUnmapBuffer(target);
+    }
+  });
+  return nullptr;
+}
 
 // Framebuffers
 // ------------
@@ -382,10 +863,12 @@ NATIVE_METHOD(bindFramebuffer) {
   CTX();
   auto target = ARG(0, GLenum);
   auto framebuffer = ARG(1, EXWebGLClass);
-  ctx->addToNextBatch([=] {
-    glBindFramebuffer(
-        target, framebuffer == 0 ? ctx->defaultFramebuffer : ctx->lookupObject(framebuffer));
-  });
+  if (ctx->stateShadow().bindFramebuffer(target, framebuffer)) {
+    ctx->addToNextBatch([=] {
+      glBindFramebuffer(
+          target, framebuffer == 0 ? ctx->defaultFramebuffer : ctx->lookupObject(framebuffer));
+    });
+  }
   return nullptr;
 }
 
@@ -404,7 +887,25 @@ NATIVE_METHOD(createFramebuffer) {
 
 NATIVE_METHOD(deleteFramebuffer) {
   CTX();
-  return exglDeleteObject(ctx, ARG(0, EXWebGLClass), glDeleteFramebuffers);
+  auto framebuffer = ARG(0, EXWebGLClass);
+  if (ctx->stateShadow().didDeleteFramebuffer(framebuffer)) {
+    // Bind the default framebuffer before deleting it, as WebGL does. GL would bind the
+    // framebuffer zero, which is not the default one on every platform.
+    ctx->addToNextBatch([=] {
+      GLint glFramebuffer = ctx->lookupObject(framebuffer);
+      for (GLenum target : {GL_DRAW_FRAMEBUFFER, GL_READ_FRAMEBUFFER}) {
+        GLint bound = 0;
+        glGetIntegerv(
+            target == GL_DRAW_FRAMEBUFFER ? GL_DRAW_FRAMEBUFFER_BINDING
+                                          : GL_READ_FRAMEBUFFER_BINDING,
+            &bound);
+        if (bound == glFramebuffer) {
+          glBindFramebuffer(target, ctx->defaultFramebuffer);
+        }
+      }
+    });
+  }
+  return exglDeleteObject(ctx, framebuffer, glDeleteFramebuffers);
 }
 
 NATIVE_METHOD(framebufferRenderbuffer) {
@@ -448,14 +949,23 @@ NATIVE_METHOD(readPixels) {
   auto height = ARG(3, GLuint);
   auto format = ARG(4, GLenum);
   auto type = ARG(5, GLenum);
-  size_t byteLength = width * height * bytesPerPixel(type, format);
-  std::vector<uint8_t> pixels(byteLength);
-  ctx->addBlockingToNextBatch(
-      [&] { glReadPixels(x, y, width, height, format, type, pixels.data()); });
 
-  TypedArrayBase arr = ARG(6, TypedArrayBase);
-  jsi::ArrayBuffer buffer = arr.getBuffer(runtime);
-  arrayBufferUpdate(runtime, buffer, pixels, arr.byteOffset(runtime));
+  // WebGL2: read to the buffer bound to GL_PIXEL_PACK_BUFFER, which doesn't need to block
+  if (argc > 6 && jsArgv[6].isNumber()) {
+    auto offset = ARG(6, GLintptr);
+    ctx->addToNextBatch([=] {
+      glReadPixels(x, y, width, height, format, type, reinterpret_cast<void *>(offset));
+    });
+    return nullptr;
+  }
+
+  auto dstData = ARG(6, TypedArrayBase);
+  auto dstOffset = argc > 7 ? ARG(7, GLuint) : 0;
+  size_t byteLength = packedImageSize(ctx, width, height, format, type);
+  uint8_t *pixels = typedArrayData(runtime, dstData, dstOffset, byteLength);
+  // Pixels are written straight to the ArrayBuffer, which is safe as this call blocks
+  ctx->addBlockingToNextBatch(
+      [&] { glReadPixels(x, y, width, height, format, type, pixels); });
   return nullptr;
 }
 
@@ -521,7 +1031,9 @@ NATIVE_METHOD(bindRenderbuffer) {
   CTX();
   auto target = ARG(0, GLenum);
   auto fRenderbuffer = ARG(1, EXWebGLClass);
-  ctx->addToNextBatch([=] { glBindRenderbuffer(target, ctx->lookupObject(fRenderbuffer)); });
+  if (ctx->stateShadow().bindRenderbuffer(target, fRenderbuffer)) {
+    ctx->addToNextBatch([=] { glBindRenderbuffer(target, ctx->lookupObject(fRenderbuffer)); });
+  }
   return nullptr;
 }
 
@@ -532,7 +1044,9 @@ NATIVE_METHOD(createRenderbuffer) {
 
 NATIVE_METHOD(deleteRenderbuffer) {
   CTX();
-  return exglDeleteObject(ctx, ARG(0, EXWebGLClass), glDeleteRenderbuffers);
+  auto renderbuffer = ARG(0, EXWebGLClass);
+  ctx->stateShadow().didDeleteRenderbuffer(renderbuffer);
+  return exglDeleteObject(ctx, renderbuffer, glDeleteRenderbuffers);
 }
 
 UNIMPL_NATIVE_METHOD(getRenderbufferParameter)
@@ -586,7 +1100,9 @@ NATIVE_METHOD(bindTexture) {
   CTX();
   auto target = ARG(0, GLenum);
   auto texture = ARG(1, EXWebGLClass);
-  ctx->addToNextBatch([=] { glBindTexture(target, ctx->lookupObject(texture)); });
+  if (ctx->stateShadow().bindTexture(target, texture)) {
+    ctx->addToNextBatch([=] { glBindTexture(target, ctx->lookupObject(texture)); });
+  }
   return nullptr;
 }
 
@@ -609,7 +1125,9 @@ NATIVE_METHOD(createTexture) {
 
 NATIVE_METHOD(deleteTexture) {
   CTX();
-  return exglDeleteObject(ctx, ARG(0, EXWebGLClass), glDeleteTextures);
+  auto texture = ARG(0, EXWebGLClass);
+  ctx->stateShadow().didDeleteTexture(texture);
+  return exglDeleteObject(ctx, texture, glDeleteTextures);
 }
 
 SIMPLE_NATIVE_METHOD(generateMipmap, glGenerateMipmap) // target
@@ -917,7 +1435,9 @@ NATIVE_METHOD(createShader) {
 
 NATIVE_METHOD(deleteProgram) {
   CTX();
-  return exglDeleteObject(ctx, ARG(0, EXWebGLClass), glDeleteProgram);
+  auto program = ARG(0, EXWebGLClass);
+  ctx->stateShadow().didDeleteProgram(program);
+  return exglDeleteObject(ctx, program, glDeleteProgram);
 }
 
 NATIVE_METHOD(deleteShader) {
@@ -975,6 +1495,9 @@ NATIVE_METHOD(getProgramParameter) {
   GLint glResult;
   ctx->addBlockingToNextBatch(
       [&] { glGetProgramiv(ctx->lookupObject(fProgram), pname, &glResult); });
+  if (pname == GL_LINK_STATUS) {
+    ctx->stateShadow().didQueryLinkStatus(fProgram, glResult == GL_TRUE);
+  }
   if (pname == GL_DELETE_STATUS || pname == GL_LINK_STATUS || pname == GL_VALIDATE_STATUS) {
     return glResult == GL_TRUE;
   } else {
@@ -1067,6 +1590,7 @@ NATIVE_METHOD(isProgram) {
 NATIVE_METHOD(linkProgram) {
   CTX();
   auto fProgram = ARG(0, EXWebGLClass);
+  ctx->stateShadow().didLinkProgram(fProgram);
   ctx->addToNextBatch([=] { glLinkProgram(ctx->lookupObject(fProgram)); });
   return nullptr;
 }
@@ -1085,7 +1609,9 @@ NATIVE_METHOD(shaderSource) {
 NATIVE_METHOD(useProgram) {
   CTX();
   auto program = ARG(0, EXWebGLClass);
-  ctx->addToNextBatch([=] { glUseProgram(ctx->lookupObject(program)); });
+  if (ctx->stateShadow().useProgram(program)) {
+    ctx->addToNextBatch([=] { glUseProgram(ctx->lookupObject(program)); });
+  }
   return nullptr;
 }
 
@@ -1141,9 +1667,13 @@ NATIVE_METHOD(getAttribLocation) {
   CTX();
   auto program = ARG(0, EXWebGLClass);
   auto name = ARG(1, std::string);
+  auto &shadow = ctx->stateShadow();
   GLint location;
-  ctx->addBlockingToNextBatch(
-      [&] { location = glGetAttribLocation(ctx->lookupObject(program), name.c_str()); });
+  if (!shadow.getAttribLocation(program, name, location)) {
+    ctx->addBlockingToNextBatch(
+        [&] { location = glGetAttribLocation(ctx->lookupObject(program), name.c_str()); });
+    shadow.setAttribLocation(program, name, location);
+  }
   return jsi::Value(location);
 }
 
@@ -1153,9 +1683,13 @@ NATIVE_METHOD(getUniformLocation) {
   CTX();
   auto program = ARG(0, EXWebGLClass);
   auto name = ARG(1, std::string);
+  auto &shadow = ctx->stateShadow();
   GLint location;
-  ctx->addBlockingToNextBatch(
-      [&] { location = glGetUniformLocation(ctx->lookupObject(program), name.c_str()); });
+  if (!shadow.getUniformLocation(program, name, location)) {
+    ctx->addBlockingToNextBatch(
+        [&] { location = glGetUniformLocation(ctx->lookupObject(program), name.c_str()); });
+    shadow.setUniformLocation(program, name, location);
+  }
   return location == -1
       ? jsi::Value::null()
       : createWebGLObject(runtime, EXWebGLClass::WebGLUniformLocation, {location});
@@ -1677,17 +2211,66 @@ NATIVE_METHOD(getSamplerParameter) {
 // Sync objects (WebGL2)
 // ---------------------
 
-UNIMPL_NATIVE_METHOD(fenceSync)
+NATIVE_METHOD(fenceSync) {
+  CTX();
+  auto condition = ARG(0, GLenum);
+  auto flags = ARG(1, GLbitfield);
+  auto sync = ctx->createObject();
+  ctx->addToNextBatch([=] { ctx->syncs[sync] = glFenceSync(condition, flags); });
+  return createWebGLObject(runtime, EXWebGLClass::WebGLSync, {static_cast<double>(sync)});
+}
 
-UNIMPL_NATIVE_METHOD(isSync)
+NATIVE_METHOD(isSync) {
+  CTX();
+  auto sync = ARG(0, EXWebGLClass);
+  GLboolean glResult;
+  ctx->addBlockingToNextBatch([&] { glResult = glIsSync(ctx->lookupSync(sync)); });
+  return glResult == GL_TRUE;
+}
 
-UNIMPL_NATIVE_METHOD(deleteSync)
+NATIVE_METHOD(deleteSync) {
+  CTX();
+  auto sync = ARG(0, EXWebGLClass);
+  ctx->addToNextBatch([=] {
+    glDeleteSync(ctx->lookupSync(sync));
+    ctx->syncs.erase(sync);
+  });
+  return nullptr;
+}
 
-UNIMPL_NATIVE_METHOD(clientWaitSync)
+// Waiting would block both JS and GL threads, so like in browsers (where
+// MAX_CLIENT_WAIT_TIMEOUT_WEBGL is 0) it can only be used to poll the sync object.
+NATIVE_METHOD(clientWaitSync) {
+  CTX();
+  auto sync = ARG(0, EXWebGLClass);
+  auto flags = ARG(1, GLbitfield);
+  auto timeout = ARG(2, double);
+  if (timeout > 0) {
+    return static_cast<double>(GL_WAIT_FAILED);
+  }
+  GLenum glResult;
+  ctx->addBlockingToNextBatch(
+      [&] { glResult = glClientWaitSync(ctx->lookupSync(sync), flags, 0); });
+  return static_cast<double>(glResult);
+}
 
-UNIMPL_NATIVE_METHOD(waitSync)
+NATIVE_METHOD(waitSync) {
+  CTX();
+  auto sync = ARG(0, EXWebGLClass);
+  auto flags = ARG(1, GLbitfield);
+  ctx->addToNextBatch([=] { glWaitSync(ctx->lookupSync(sync), flags, GL_TIMEOUT_IGNORED); });
+  return nullptr;
+}
 
-UNIMPL_NATIVE_METHOD(getSyncParameter)
+NATIVE_METHOD(getSyncParameter) {
+  CTX();
+  auto sync = ARG(0, EXWebGLClass);
+  auto pname = ARG(1, GLenum);
+  GLint glResult;
+  ctx->addBlockingToNextBatch(
+      [&] { glGetSynciv(ctx->lookupSync(sync), pname, 1, nullptr, &glResult); });
+  return static_cast<double>(glResult);
+}
 
 // Transform feedback (WebGL2)
 // ---------------------------
@@ -1765,6 +2348,8 @@ NATIVE_METHOD(bindBufferBase) {
   auto target = ARG(0, GLenum);
   auto index = ARG(1, GLuint);
   auto buffer = ARG(2, EXWebGLClass);
+  // Binds to the generic binding point too.
+  ctx->stateShadow().bindBuffer(target, buffer);
   ctx->addToNextBatch([=] { glBindBufferBase(target, index, ctx->lookupObject(buffer)); });
   return nullptr;
 }
@@ -1776,6 +2361,7 @@ NATIVE_METHOD(bindBufferRange) {
   auto buffer = ARG(2, EXWebGLClass);
   auto offset = ARG(3, GLint);
   auto size = ARG(4, GLsizei);
+  ctx->stateShadow().bindBuffer(target, buffer);
   ctx->addToNextBatch(
       [=] { glBindBufferRange(target, index, ctx->lookupObject(buffer), offset, size); });
   return nullptr;
@@ -1884,7 +2470,9 @@ NATIVE_METHOD(createVertexArray) {
 
 NATIVE_METHOD(deleteVertexArray) {
   CTX();
-  return exglDeleteObject(ctx, ARG(0, EXWebGLClass), glDeleteVertexArrays);
+  auto vertexArray = ARG(0, EXWebGLClass);
+  ctx->stateShadow().didDeleteVertexArray(vertexArray);
+  return exglDeleteObject(ctx, vertexArray, glDeleteVertexArrays);
 }
 
 NATIVE_METHOD(isVertexArray) {
@@ -1895,7 +2483,9 @@ NATIVE_METHOD(isVertexArray) {
 NATIVE_METHOD(bindVertexArray) {
   CTX();
   auto vertexArray = ARG(0, EXWebGLClass);
-  ctx->addToNextBatch([=] { glBindVertexArray(ctx->lookupObject(vertexArray)); });
+  if (ctx->stateShadow().bindVertexArray(vertexArray)) {
+    ctx->addToNextBatch([=] { glBindVertexArray(ctx->lookupObject(vertexArray)); });
+  }
   return nullptr;
 }
 
@@ -1959,6 +2549,79 @@ NATIVE_METHOD(flushEXP) {
   return nullptr;
 }
 
+// Like readPixels, but returns a promise which resolves once the pixels are in `dstData`.
+// The pixels are read to a pixel pack buffer and copied out once a fence after the read
+// signals, so neither JS nor GL threads wait for the GPU.
+NATIVE_METHOD(readPixelsAsyncEXP) {
+  CTX();
+  auto x = ARG(0, GLint);
+  auto y = ARG(1, GLint);
+  auto width = ARG(2, GLuint);
+  auto height = ARG(3, GLuint);
+  auto format = ARG(4, GLenum);
+  auto type = ARG(5, GLenum);
+  auto dstData = ARG(6, TypedArrayBase);
+  size_t byteLength = packedImageSize(ctx, width, height, format, type);
+  // Throws synchronously if the pixels don't fit.
+  typedArrayData(runtime, dstData, 0, byteLength);
+  auto readback = std::make_shared<EXGLReadbackQueue::Result>();
+  ctx->addToNextBatch([=] {
+    GLint packBuffer = 0;
+    glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &packBuffer);
+    GLuint buffer = ctx->readbacks.acquireBuffer(byteLength);
+    glReadPixels(x, y, width, height, format, type, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, packBuffer);
+    ctx->readbacks.add(buffer, byteLength, readback);
+  });
+  return exglReadbackPromise(runtime, ctx, std::move(readback), std::move(dstData), 0);
+}
+
+// Like getBufferSubData, but returns a promise which resolves once the data is in `dstData`.
+// The data is the buffer's content at the time of the call, even if it's changed afterwards.
+NATIVE_METHOD(getBufferSubDataAsyncEXP) {
+  CTX();
+  auto target = ARG(0, GLenum);
+  auto srcByteOffset = ARG(1, GLintptr);
+  auto dstData = ARG(2, TypedArrayBase);
+  auto dstOffset = argc > 3 ? ARG(3, GLuint) : 0;
+  auto length = argc > 4 ? ARG(4, GLuint) : 0;
+  GLenum bindingPname = EXGLStateShadow::bufferBindingPname(target);
+  if (bindingPname == 0) {
+    throw std::runtime_error(
+        "EXGL: getBufferSubDataAsyncEXP() doesn't support gl." + std::to_string(target) + "!");
+  }
+  size_t byteLength = typedArrayRangeLength(runtime, dstData, dstOffset, length);
+  typedArrayData(runtime, dstData, dstOffset, byteLength);
+  auto readback = std::make_shared<EXGLReadbackQueue::Result>();
+  ctx->addToNextBatch([=] {
+    GLint source = 0;
+    glGetIntegerv(bindingPname, &source);
+    GLint64 sourceSize = 0;
+    if (source != 0) {
+      glGetBufferParameteri64v(target, GL_BUFFER_SIZE, &sourceSize);
+    }
+    if (source == 0 || srcByteOffset < 0 ||
+        srcByteOffset + static_cast<GLint64>(byteLength) > sourceSize) {
+      readback->status = EXGLReadbackStatus::Failed;
+      return;
+    }
+
+    // Copy the range to a pooled buffer now, so that changing (or deleting) the buffer after
+    // this call doesn't affect the data read back.
+    GLint copyReadBuffer = 0;
+    GLint packBuffer = 0;
+    glGetIntegerv(GL_COPY_READ_BUFFER_BINDING, &copyReadBuffer);
+    glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &packBuffer);
+    glBindBuffer(GL_COPY_READ_BUFFER, source);
+    GLuint buffer = ctx->readbacks.acquireBuffer(byteLength);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_PIXEL_PACK_BUFFER, srcByteOffset, 0, byteLength);
+    glBindBuffer(GL_COPY_READ_BUFFER, copyReadBuffer);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, packBuffer);
+    ctx->readbacks.add(buffer, byteLength, readback);
+  });
+  return exglReadbackPromise(runtime, ctx, std::move(readback), std::move(dstData), dstOffset);
+}
+
 } // namespace method
 } // namespace gl_cpp
 } // namespace expo
@@ -2,6 +2,8 @@
 // it should be included only in EXWebGLMethods.cpp
 
 #include "EXGLContext.h"
+#include "EXGLContextManager.h"
+#include "EXGLImageUtils.h"
 #include "EXWebGLRenderer.h"
 
 #ifdef __ANDROID__
@@ -14,6 +16,8 @@
 #include <OpenGLES/ES3/glext.h>
 #endif
 
+#include <algorithm>
+
 namespace expo {
 namespace gl_cpp {
 
@@ -139,6 +143,119 @@ inline jsi::Value exglDeleteObject(
   return nullptr;
 }
 
+// Reads a value of getParameter from the state shadow, or from GL if it's not known there.
+template <typename T, typename Func>
+inline void
+exglGetParameter(EXGLContext *ctx, GLenum pname, T *values, size_t count, Func glFunc) {
+  auto &shadow = ctx->stateShadow();
+  if (!shadow.getParameter(pname, values, count)) {
+    ctx->addBlockingToNextBatch([&] { glFunc(pname, values); });
+    shadow.didQueryParameter(pname, values, count);
+  }
+}
+
+// Size of pixels read with glReadPixels, whose rows are aligned to GL_PACK_ALIGNMENT.
+inline size_t
+packedImageSize(EXGLContext *ctx, GLuint width, GLuint height, GLenum format, GLenum type) {
+  size_t pixelSize = bytesPerPixel(type, format);
+  if (pixelSize == 0) {
+    throw std::runtime_error("EXGL: Reading pixels of this format and type isn't supported yet!");
+  }
+  if (width == 0 || height == 0) {
+    return 0;
+  }
+  GLint alignment;
+  exglGetParameter(ctx, GL_PACK_ALIGNMENT, &alignment, 1, glGetIntegerv);
+  size_t rowSize = width * pixelSize;
+  size_t alignedRowSize =
+      (rowSize + static_cast<size_t>(alignment) - 1) / alignment * alignment;
+  return alignedRowSize * (height - 1) + rowSize;
+}
+
+inline size_t typedArrayElementSize(jsi::Runtime &runtime, const TypedArrayBase &array) {
+  size_t length = array.length(runtime);
+  return length == 0 ? 1 : array.byteLength(runtime) / length;
+}
+
+// Byte length of `length` elements of the array starting at `offset`, or of all elements
+// after `offset` if `length` is 0 (like in WebGL2 methods taking dstOffset and length).
+inline size_t typedArrayRangeLength(
+    jsi::Runtime &runtime,
+    const TypedArrayBase &array,
+    size_t offset,
+    size_t length) {
+  size_t arrayLength = array.length(runtime);
+  if (offset > arrayLength || length > arrayLength - offset) {
+    throw std::runtime_error("EXGL: Offset and length are out of the array's bounds!");
+  }
+  return (length == 0 ? arrayLength - offset : length) * typedArrayElementSize(runtime, array);
+}
+
+// Pointer to `byteLength` bytes of the array's data, starting at the element at `offset`.
+// Data can be written to it directly, instead of copying it to the array afterwards.
+inline uint8_t *typedArrayData(
+    jsi::Runtime &runtime,
+    const TypedArrayBase &array,
+    size_t offset,
+    size_t byteLength) {
+  size_t arrayByteLength = array.byteLength(runtime);
+  size_t byteOffset = offset * typedArrayElementSize(runtime, array);
+  if (byteOffset > arrayByteLength || byteLength > arrayByteLength - byteOffset) {
+    throw std::runtime_error("EXGL: The array is too small to fit the data!");
+  }
+  return array.getBuffer(runtime).data(runtime) + array.byteOffset(runtime) + byteOffset;
+}
+
+// Sends the queued readback to the GL thread and returns a promise resolved once its data is
+// copied to `dstData` (from `dstOffset` elements on). The GL thread never writes to `dstData`
+// itself, so nothing is left pointing to it if the runtime is destroyed first.
+inline jsi::Value exglReadbackPromise(
+    jsi::Runtime &runtime,
+    EXGLContext *ctx,
+    EXGLReadbackQueue::ResultRef result,
+    TypedArrayBase &&dstData,
+    size_t dstOffset) {
+  ctx->endNextBatch();
+  ctx->flushOnGLThread();
+
+  auto ctxId = ctx->ctxId;
+  auto dstDataRef = std::make_shared<TypedArrayBase>(std::move(dstData));
+  auto poll = jsi::Function::createFromHostFunction(
+      runtime,
+      jsi::PropNameID::forAscii(runtime, "poll"),
+      0,
+      [ctxId, result, dstDataRef, dstOffset](
+          jsi::Runtime &runtime, const jsi::Value &, const jsi::Value *, size_t) -> jsi::Value {
+        switch (result->status.load()) {
+          case EXGLReadbackStatus::Done: {
+            auto &data = result->data;
+            if (!data.empty()) {
+              uint8_t *destination =
+                  typedArrayData(runtime, *dstDataRef, dstOffset, data.size());
+              std::copy(data.begin(), data.end(), destination);
+            }
+            return true;
+          }
+          case EXGLReadbackStatus::Failed:
+            throw std::runtime_error("EXGL: Reading data back from the GPU failed!");
+          case EXGLReadbackStatus::Pending:
+            break;
+        }
+        auto result = EXGLContextGet(ctxId);
+        if (result.first == nullptr) {
+          throw std::runtime_error("EXGL: The context was destroyed before the data was read!");
+        }
+        // Readbacks are finished at the end of a flush, so make sure one happens even if JS
+        // doesn't queue anything else.
+        result.first->flushOnGLThread();
+        return false;
+      });
+  // See `evalReadbackPromise` in EXWebGLRenderer.cpp
+  return runtime.global()
+      .getPropertyAsFunction(runtime, "__EXGLReadbackPromise")
+      .call(runtime, std::move(poll));
+}
+
 inline jsi::Value exglUnimplemented(std::string name) {
   throw std::runtime_error("EXGL: " + name + "() isn't implemented yet!");
 }
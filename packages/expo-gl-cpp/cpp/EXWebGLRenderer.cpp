@@ -33,6 +33,31 @@ WebGLTransformFeedback = function() {};
 WebGLVertexArrayObject = function() {};
 )";
 
+// Promise returned by methods reading data back from the GPU asynchronously (e.g.
+// readPixelsAsyncEXP). `poll` returns true once the data is ready and throws if reading it
+// failed. There is no way to create a promise using jsi api either.
+constexpr const char *evalReadbackPromise = R"(
+__EXGLReadbackPromise = function(poll) {
+  var schedule = typeof setTimeout === 'function'
+    ? function(callback) { setTimeout(callback, 4); }
+    : requestAnimationFrame;
+  return new Promise(function(resolve, reject) {
+    function check() {
+      try {
+        if (poll()) {
+          resolve();
+        } else {
+          schedule(check);
+        }
+      } catch (error) {
+        reject(error);
+      }
+    }
+    schedule(check);
+  });
+};
+)";
+
 void installConstants(jsi::Runtime &runtime, jsi::Object &gl);
 void installWebGLMethods(jsi::Runtime &runtime, jsi::Object &gl);
 void installWebGL2Methods(jsi::Runtime &runtime, jsi::Object &gl);
@@ -51,6 +76,11 @@ void createWebGLRenderer(jsi::Runtime &runtime, EXGLContext *ctx, initGlesContex
   gl.setProperty(runtime, "drawingBufferHeight", viewport.viewportHeight);
   gl.setProperty(runtime, "supportsWebGL2", ctx->supportsWebGL2);
   gl.setProperty(runtime, "contextId", static_cast<double>(ctx->ctxId));
+  gl.setProperty(
+      runtime,
+      EXGLContextHandlePropertyName,
+      jsi::Object::createFromHostObject(
+          runtime, std::make_shared<EXGLContextHandle>(EXGLContextGetRef(ctx->ctxId))));
 
   // Legacy case for older SDKs in Expo Go
   bool legacyJs = !runtime.global().getProperty(runtime, "__EXGLConstructorReady").isBool();
@@ -181,6 +211,8 @@ void ensurePrototypes(jsi::Runtime &runtime) {
   
   auto evalBuffer = std::make_shared<jsi::StringBuffer>(evalStubConstructors);
   runtime.evaluateJavaScript(evalBuffer, "expo-gl-cpp");
+  runtime.evaluateJavaScript(
+      std::make_shared<jsi::StringBuffer>(evalReadbackPromise), "expo-gl-cpp");
 
   auto inheritFromJsObject = [&runtime](EXWebGLClass classEnum) {
     auto objectClass = runtime.global().getPropertyAsObject(runtime, "Object");
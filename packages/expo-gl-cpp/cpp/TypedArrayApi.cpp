@@ -8,27 +8,6 @@ namespace gl_cpp {
 template <TypedArrayKind T>
 using ContentType = typename typedArrayTypeMap<T>::type;
 
-enum class Prop {
-  Buffer, // "buffer"
-  Constructor, // "constructor"
-  Name, // "name"
-  Proto, // "__proto__"
-  Length, // "length"
-  ByteLength, // "byteLength"
-  ByteOffset, // "offset"
-  IsView, // "isView"
-  ArrayBuffer, // "ArrayBuffer"
-  Int8Array, // "Int8Array"
-  Int16Array, // "Int16Array"
-  Int32Array, // "Int32Array"
-  Uint8Array, // "Uint8Array"
-  Uint8ClampedArray, // "Uint8ClampedArray"
-  Uint16Array, // "Uint16Array"
-  Uint32Array, // "Uint32Array"
-  Float32Array, // "Float32Array"
-  Float64Array, // "Float64Array"
-};
-
 class PropNameIDCache {
  public:
   const jsi::PropNameID &get(jsi::Runtime &runtime, Prop prop) {
@@ -58,6 +37,10 @@ class PropNameIDCache {
 
 PropNameIDCache propNameIDCache;
 
+const jsi::PropNameID &getPropNameID(jsi::Runtime &runtime, Prop prop) {
+  return propNameIDCache.get(runtime, prop);
+}
+
 InvalidateCacheOnDestroy::InvalidateCacheOnDestroy(jsi::Runtime &runtime) {
   key = reinterpret_cast<uintptr_t>(&runtime);
 }
@@ -174,7 +157,7 @@ void arrayBufferUpdate(
     size_t offset) {
   uint8_t *dataBlock = buffer.data(runtime);
   size_t blockSize = buffer.size(runtime);
-  if (data.size() > blockSize) {
+  if (offset > blockSize || data.size() > blockSize - offset) {
     throw jsi::JSError(runtime, "ArrayBuffer is to small to fit data");
   }
   std::copy(data.begin(), data.end(), dataBlock + offset);
@@ -275,6 +258,8 @@ jsi::PropNameID PropNameIDCache::createProp(jsi::Runtime &runtime, Prop prop) {
       return create("Float32Array");
     case Prop::Float64Array:
       return create("Float64Array");
+    case Prop::EXGLContextHandle:
+      return create("__EXGLContextHandle");
   }
 }
 
@@ -57,6 +57,13 @@ void UEXGLContextSetDefaultFramebuffer(UEXGLContextId exglCtxId, GLint framebuff
   }
 }
 
+void UEXGLContextInvalidateState(UEXGLContextId exglCtxId) {
+  auto [exglCtx, lock] = EXGLContextGet(exglCtxId);
+  if (exglCtx) {
+    exglCtx->invalidateStateShadow();
+  }
+}
+
 UEXGLObjectId UEXGLContextCreateObject(UEXGLContextId exglCtxId) {
   auto [exglCtx, lock] = EXGLContextGet(exglCtxId);
   if (exglCtx) {
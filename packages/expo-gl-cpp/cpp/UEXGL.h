@@ -68,6 +68,10 @@ void UEXGLContextFlush(UEXGLContextId exglCtxId);
 // platform-specific extensions on the default framebuffer, such as MSAA.
 void UEXGLContextSetDefaultFramebuffer(UEXGLContextId exglCtxId, GLint framebuffer);
 
+// [Any thread] Tell cpp that GL state observable by JS (e.g. the viewport) was changed
+// outside of the GL methods, so it has to be queried again.
+void UEXGLContextInvalidateState(UEXGLContextId exglCtxId);
+
 // [Any thread] Create an EXGL object. Initially maps to the OpenGL object zero.
 UEXGLObjectId UEXGLContextCreateObject(UEXGLContextId exglCtxId);
 
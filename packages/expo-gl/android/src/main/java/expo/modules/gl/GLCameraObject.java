@@ -11,6 +11,7 @@ import expo.modules.interfaces.camera.CameraViewInterface;
 import static android.opengl.GLES11Ext.GL_TEXTURE_EXTERNAL_OES;
 import static android.opengl.GLES30.GL_ACTIVE_TEXTURE;
 import static android.opengl.GLES30.GL_ARRAY_BUFFER;
+import static android.opengl.GLES30.GL_ARRAY_BUFFER_BINDING;
 import static android.opengl.GLES30.GL_CLAMP_TO_EDGE;
 import static android.opengl.GLES30.GL_COLOR_ATTACHMENT0;
 import static android.opengl.GLES30.GL_CURRENT_PROGRAM;
@@ -178,6 +179,7 @@ public class GLCameraObject extends GLObject implements SurfaceTexture.OnFrameAv
         int[] prevActiveTexture = new int[1];
         int[] prevTexture = new int[1];
         int[] prevVertexArray = new int[1];
+        int[] prevArrayBuffer = new int[1];
         int[] viewport = new int[4];
         float[] transformMatrix = new float[16];
 
@@ -187,6 +189,7 @@ public class GLCameraObject extends GLObject implements SurfaceTexture.OnFrameAv
         glGetIntegerv(GL_ACTIVE_TEXTURE, prevActiveTexture, 0);
         glGetIntegerv(GL_TEXTURE_BINDING_2D, prevTexture, 0);
         glGetIntegerv(GL_VERTEX_ARRAY_BINDING, prevVertexArray, 0);
+        glGetIntegerv(GL_ARRAY_BUFFER_BINDING, prevArrayBuffer, 0);
         glGetIntegerv(GL_VIEWPORT, viewport, 0);
 
         glUseProgram(mProgram);
@@ -222,6 +225,7 @@ public class GLCameraObject extends GLObject implements SurfaceTexture.OnFrameAv
           glBufferData(GL_ARRAY_BUFFER, textureCoords.length * 4, vertexBuffer, GL_STATIC_DRAW);
           glEnableVertexAttribArray(positionLocation);
           glVertexAttribPointer(positionLocation, 2, GL_FLOAT, false, 4 * 2, 0);
+          glBindBuffer(GL_ARRAY_BUFFER, prevArrayBuffer[0]);
         }
 
         // reallocate destination texture if preview size has changed
@@ -213,6 +213,7 @@
       glBindFramebuffer(GL_FRAMEBUFFER, prevFramebuffer);
     }
     glBindRenderbuffer(GL_RENDERBUFFER, prevRenderbuffer);
+    UEXGLContextInvalidateState(self->_glContext.contextId);
 
     // TODO(nikki): Notify JS component of resize
   }];
@@ -31,6 +31,22 @@ export interface ExpoWebGLRenderingContext extends WebGL2RenderingContext {
   contextId: number;
   endFrameEXP(): void;
   flushEXP(): void;
+  readPixelsAsyncEXP(
+    x: number,
+    y: number,
+    width: number,
+    height: number,
+    format: number,
+    type: number,
+    dstData: ArrayBufferView
+  ): Promise<void>;
+  getBufferSubDataAsyncEXP(
+    target: number,
+    srcByteOffset: number,
+    dstData: ArrayBufferView,
+    dstOffset?: number,
+    length?: number
+  ): Promise<void>;
   __expoSetLogging(option: GLLoggingOption): void;
 }
 